@@ -0,0 +1,86 @@
+import
+  # Internals
+  constantine/ciphers/chacha20,
+  constantine/csprngs/[sysrand, csprng_chacha20],
+  # Helpers
+  helpers/prng_unsafe,
+  ./bench_blueprint
+
+proc separator*() = separator(69)
+
+# --------------------------------------------------------------------
+
+proc report(op: string, bytes: int, startTime, stopTime: MonoTime, startClk, stopClk: int64, iters: int) =
+  let ns = inNanoseconds((stopTime-startTime) div iters)
+  let throughput = 1e9 / float64(ns)
+  when SupportsGetTicks:
+    let cycles = (stopClk - startClk) div iters
+    let cyclePerByte = cycles.float64 / bytes.float64
+    echo &"{op:<40}     {throughput:>15.3f} ops/s    {ns:>9} ns/op    {cycles:>10} cycles    {cyclePerByte:>5.2f} cycles/byte"
+  else:
+    echo &"{op:<40}     {throughput:>15.3f} ops/s    {ns:>9} ns/op"
+
+template bench(op: string, bytes: int, iters: int, body: untyped): untyped =
+  measure(iters, startTime, stopTime, startClk, stopClk, body)
+  report(op, bytes, startTime, stopTime, startClk, stopClk, iters)
+
+proc benchChaCha20_constantine(msg: var seq[byte], msgComment: string, iters: int) =
+  let key = [
+      byte 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+           0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+           0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+           0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+    ]
+  let nonce = [byte 0, 0, 0, 0, 0, 0, 0, 0x4a, 0, 0, 0, 0]
+  bench("ChaCha20 - Constantine - " & msgComment, msg.len, iters):
+    discard chacha20_cipher(key, counter = 1, nonce, msg)
+
+proc benchSysrand(numScalars, scalarSize: int, iters: int) =
+  var scalars = newSeq[byte](numScalars*scalarSize)
+  bench("sysrand - " & $numScalars & " scalars of " & $scalarSize & "B", scalars.len, iters):
+    for i in 0 ..< numScalars:
+      discard sysrand(scalars[i*scalarSize].addr, csize_t scalarSize)
+
+proc benchCsprng(numScalars, scalarSize: int, iters: int) =
+  var scalars = newSeq[byte](numScalars*scalarSize)
+  var csprng: ChaCha20Csprng
+  doAssert csprng.init()
+  bench("ChaCha20 CSPRNG - " & $numScalars & " scalars of " & $scalarSize & "B", scalars.len, iters):
+    csprng.fill(scalars)
+
+proc benchCsprng_oneByOne(numScalars, scalarSize: int, iters: int) =
+  var scalars = newSeq[byte](numScalars*scalarSize)
+  var csprng: ChaCha20Csprng
+  doAssert csprng.init()
+  bench("ChaCha20 CSPRNG - " & $numScalars & " x 1 scalar of " & $scalarSize & "B", scalars.len, iters):
+    for i in 0 ..< numScalars:
+      csprng.fill(scalars.toOpenArray(i*scalarSize, (i+1)*scalarSize-1))
+
+when isMainModule:
+  proc main() =
+    block:
+      var msg64B = rng.random_byte_seq(64)
+      benchChaCha20_constantine(msg64B, "64B", 1000)
+    block:
+      var msg576B = rng.random_byte_seq(576)
+      benchChaCha20_constantine(msg576B, "576B", 1000)
+    block:
+      var msg8192B = rng.random_byte_seq(8192)
+      benchChaCha20_constantine(msg8192B, "8192B", 500)
+    block:
+      var msg1MB = rng.random_byte_seq(1_000_000)
+      benchChaCha20_constantine(msg1MB, "1MB", 16)
+    block:
+      var msg100MB = rng.random_byte_seq(100_000_000)
+      benchChaCha20_constantine(msg100MB, "100MB", 3)
+    separator()
+    # Blinding factors for batch verification are 128-bit or 256-bit
+    for numScalars in [64, 1024, 8192]:
+      benchSysrand(numScalars, 16, 10)
+      benchCsprng(numScalars, 16, 100)
+      benchCsprng_oneByOne(numScalars, 16, 100)
+      benchSysrand(numScalars, 32, 10)
+      benchCsprng(numScalars, 32, 100)
+      benchCsprng_oneByOne(numScalars, 32, 100)
+      separator()
+  main()
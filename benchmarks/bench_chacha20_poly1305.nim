@@ -0,0 +1,79 @@
+import
+  # Internals
+  constantine/ciphers/[chacha20, aead_chacha20_poly1305],
+  constantine/mac/mac_poly1305,
+  # Helpers
+  helpers/prng_unsafe,
+  ./bench_blueprint
+
+proc separator*() = separator(69)
+
+# --------------------------------------------------------------------
+
+proc report(op: string, bytes: int, startTime, stopTime: MonoTime, startClk, stopClk: int64, iters: int) =
+  let ns = inNanoseconds((stopTime-startTime) div iters)
+  let throughput = 1e9 / float64(ns)
+  when SupportsGetTicks:
+    let cycles = (stopClk - startClk) div iters
+    let cyclePerByte = cycles.float64 / bytes.float64
+    echo &"{op:<50}     {throughput:>15.3f} ops/s    {ns:>9} ns/op    {cycles:>10} cycles    {cyclePerByte:>5.2f} cycles/byte"
+  else:
+    echo &"{op:<50}     {throughput:>15.3f} ops/s    {ns:>9} ns/op"
+
+template bench(op: string, bytes: int, iters: int, body: untyped): untyped =
+  measure(iters, startTime, stopTime, startClk, stopClk, body)
+  report(op, bytes, startTime, stopTime, startClk, stopClk, iters)
+
+const key = [
+    byte 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+         0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+         0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+         0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+  ]
+const nonce = [byte 0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47]
+const aad = [byte 0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7]
+
+proc benchSeal(msg: var seq[byte], msgComment: string, iters: int) =
+  var tag: array[16, byte]
+  bench("ChaCha20-Poly1305 seal - " & msgComment, msg.len, iters):
+    chacha20poly1305.seal(tag, msg, key, nonce, aad)
+
+proc benchOpen(msg: var seq[byte], msgComment: string, iters: int) =
+  var tag: array[16, byte]
+  var ciphertext = msg
+  chacha20poly1305.seal(tag, ciphertext, key, nonce, aad)
+  # open decrypts in-place, prepare one ciphertext per iteration
+  # so that the copies are not measured.
+  var ciphertexts = newSeq[seq[byte]](iters)
+  for i in 0 ..< iters:
+    ciphertexts[i] = ciphertext
+  var i = 0
+  bench("ChaCha20-Poly1305 open - " & msgComment, msg.len, iters):
+    doAssert chacha20poly1305.open(ciphertexts[i], tag, key, nonce, aad)
+    i += 1
+
+proc benchTwoPass(msg: var seq[byte], msgComment: string, iters: int) =
+  ## Encrypt the whole message then authenticate it,
+  ## for comparison with the interleaved single pass.
+  var tag: array[16, byte]
+  bench("ChaCha20 then Poly1305 (2 passes) - " & msgComment, msg.len, iters):
+    var polyKey: array[32, byte]
+    discard chacha20_keystream(key, counter = 0, nonce, polyKey)
+    discard chacha20_cipher(key, counter = 1, nonce, msg)
+    poly1305.mac(tag, msg, polyKey)
+
+when isMainModule:
+  proc main() =
+    for (len, comment, iters) in [
+          (64, "64B", 1000),
+          (576, "576B", 1000),
+          (8192, "8192B", 500),
+          (65536, "64KiB", 100),
+          (1_000_000, "1MB", 16),
+          (100_000_000, "100MB", 3)]:
+      var msg = rng.random_byte_seq(len)
+      benchSeal(msg, comment, iters)
+      benchOpen(msg, comment, iters)
+      benchTwoPass(msg, comment, iters)
+      separator()
+  main()
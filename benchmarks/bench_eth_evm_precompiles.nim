@@ -9,7 +9,7 @@
 import
   # Internals
   constantine/ethereum_evm_precompiles,
-  constantine/serialization/codecs,
+  constantine/serialization/[codecs, endians],
   constantine/named/algebras,
   constantine/math/[arithmetic, ec_shortweierstrass, extension_fields],
   constantine/math/io/[io_bigints, io_fields],
@@ -82,6 +82,10 @@ func gasRipeMD160(length: int): int =
   # 600 gas + 120 gas per 32 byte word
   return 600 + 120 * ((length+31) div 32)
 
+func gasBlake2f(rounds: int): int =
+  # 1 gas per round
+  return rounds
+
 func gasBN254PairingCheck(length: int): int =
   return 34000*length + 45000
 
@@ -188,6 +192,19 @@ proc benchRipeMD160(words, iters: int) =
   bench(opName, gasRipeMD160(length), iters):
     discard output.eth_evm_ripemd160(inputs)
 
+proc benchBlake2f(rounds, iters: int) =
+  # EIP-152 test vector 5 with a custom number of rounds
+  let inputhex = "0000000c48c9bdf267e6096a3ba7ca8485ae67bb2bf894fe72f36e3cf1361d5f3af54fa5d182e6ad7f520e511f6c3e2b8c68059b6bbd41fbabd9831f79217e1319cde05b61626300000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000300000000000000000000000000000001"
+  var input = newSeq[byte](inputhex.len div 2)
+  input.paddedFromHex(inputhex, bigEndian)
+  input.dumpRawInt(uint32 rounds, 0, bigEndian)
+  var output = newSeq[byte](64)
+
+  # As gas cost is 1 per round, MGas/s is also millions of rounds per second
+  let opName = &"BLAKE2F - {rounds:>8} rounds"
+  bench(opName, gasBlake2f(rounds), iters):
+    discard output.eth_evm_blake2f(input)
+
 # EcRecover
 # -----------------------------------------------------------------------------------------------------
 
@@ -379,6 +396,9 @@ proc main() =
   for words in 1..8:
     benchRipeMD160(words, Iters)
   separator()
+  for rounds in [1, 12, 100, 1000, 10_000, 100_000]:
+    benchBlake2f(rounds, max(1, 12_000_000 div (rounds+1000)))
+  separator()
   benchEcRecover(Iters)
   separator()
   benchBn254G1Add(Iters)
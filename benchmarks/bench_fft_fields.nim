@@ -168,6 +168,162 @@ proc bench_Fr_FFT_NN_Stockham*() =
       let status = fft_nn_stockham(fftDesc, freq, data)
       doAssert status == FFT_Success
 
+proc bench_Fr_FFT_NR_FourStep*() =
+  echo "\n=== Fr FFT (Natural → Bit-Reversed, Four-Step) Benchmark ==="
+  separator()
+
+  const NumIters = 3
+
+  for scale in countup(3, 13, 2):
+    let order = 1 shl scale
+    let fftDesc = FrFFT_Descriptor[F].new(order = order, ctt_eth_kzg_fr_pow2_roots_of_unity[scale])
+
+    var data = newSeq[F](order)
+    for i in 0 ..< order:
+      data[i].fromUint(uint64(i + 1))
+
+    var freq = newSeq[F](order)
+
+    bench("Fr FFT NR Four-Step", "Fr[BLS12-381]", order, NumIters):
+      let status = fft_nr_four_step(fftDesc, freq, data)
+      doAssert status == FFT_Success
+
+proc bench_Fr_FFT_NR_Large*() =
+  echo "\n=== Fr FFT (Natural → Bit-Reversed, Large sizes: Iterative DIF vs Four-Step) Benchmark ==="
+  separator()
+
+  const NumIters = 3
+
+  for scale in countup(14, 20, 2):
+    let order = 1 shl scale
+    let fftDesc = FrFFT_Descriptor[F].new(order = order, ctt_eth_kzg_fr_pow2_roots_of_unity[scale])
+
+    var data = newSeq[F](order)
+    for i in 0 ..< order:
+      data[i].fromUint(uint64(i + 1))
+
+    var freq = newSeq[F](order)
+
+    bench("Fr FFT NR DIF", "Fr[BLS12-381]", order, NumIters):
+      let status = fft_nr_iterative_dif(fftDesc, freq, data)
+      doAssert status == FFT_Success
+
+    bench("Fr FFT NR Four-Step", "Fr[BLS12-381]", order, NumIters):
+      let status = fft_nr_four_step(fftDesc, freq, data)
+      doAssert status == FFT_Success
+
+proc bench_Fr_FFT_Radix*() =
+  echo "\n=== Fr FFT (Iterative DIF/DIT, Radix-2 vs Radix-4 vs Radix-8) Benchmark ==="
+  separator()
+
+  const NumIters = 3
+
+  for scale in countup(3, 13, 2):
+    let order = 1 shl scale
+
+    var data = newSeq[F](order)
+    for i in 0 ..< order:
+      data[i].fromUint(uint64(i + 1))
+
+    var freq = newSeq[F](order)
+
+    for radix in FFTRadix:
+      let fftDesc = FrFFT_Descriptor[F].new(order = order, ctt_eth_kzg_fr_pow2_roots_of_unity[scale], radix)
+
+      bench("Fr FFT NR DIF " & $radix, "Fr[BLS12-381]", order, NumIters):
+        let status = fft_nr_iterative_dif(fftDesc, freq, data)
+        doAssert status == FFT_Success
+
+      bench("Fr FFT RN DIT " & $radix, "Fr[BLS12-381]", order, NumIters):
+        let status = fft_rn_iterative_dit(fftDesc, freq, data)
+        doAssert status == FFT_Success
+
+proc bench_Fr_FFT_Batch*() =
+  echo "\n=== Fr FFT (Natural → Bit-Reversed, 64 transforms: Loop vs Batched) Benchmark ==="
+  separator()
+
+  const NumIters = 3
+  const BatchSize = 64
+
+  for scale in countup(3, 13, 2):
+    let order = 1 shl scale
+    let fftDesc = FrFFT_Descriptor[F].new(order = order, ctt_eth_kzg_fr_pow2_roots_of_unity[scale])
+
+    var data = newSeq[F](order*BatchSize)
+    for i in 0 ..< data.len:
+      data[i].fromUint(uint64(i + 1))
+
+    var freq = newSeq[F](order*BatchSize)
+
+    bench("Fr FFT NR loop x64", "Fr[BLS12-381]", order, NumIters):
+      for b in 0 ..< BatchSize:
+        let status = fft_nr(fftDesc,
+          freq.toOpenArray(b*order, (b+1)*order-1),
+          data.toOpenArray(b*order, (b+1)*order-1))
+        doAssert status == FFT_Success
+
+    bench("Fr FFT NR batch row-major x64", "Fr[BLS12-381]", order, NumIters):
+      let status = fft_nr_batch(fftDesc, freq, data, BatchSize, kRowMajor)
+      doAssert status == FFT_Success
+
+    bench("Fr FFT NR batch col-major x64", "Fr[BLS12-381]", order, NumIters):
+      let status = fft_nr_batch(fftDesc, freq, data, BatchSize, kColMajor)
+      doAssert status == FFT_Success
+
+    let cosetShift = F.fromUint(5'u32)
+
+    bench("Fr Coset FFT NR loop x64", "Fr[BLS12-381]", order, NumIters):
+      for b in 0 ..< BatchSize:
+        let status = coset_fft_nr(fftDesc,
+          freq.toOpenArray(b*order, (b+1)*order-1),
+          data.toOpenArray(b*order, (b+1)*order-1),
+          cosetShift)
+        doAssert status == FFT_Success
+
+    bench("Fr Coset FFT NR batch row-major x64", "Fr[BLS12-381]", order, NumIters):
+      let status = coset_fft_nr_batch(fftDesc, freq, data, BatchSize, cosetShift, kRowMajor)
+      doAssert status == FFT_Success
+
+    bench("Fr Coset IFFT RN batch row-major x64", "Fr[BLS12-381]", order, NumIters):
+      let status = coset_ifft_rn_batch(fftDesc, freq, data, BatchSize, cosetShift, kRowMajor)
+      doAssert status == FFT_Success
+
+proc bench_Fr_Coset_FFT*() =
+  echo "\n=== Fr Coset FFT (Shift pass + FFT vs Fused twiddles) Benchmark ==="
+  separator()
+
+  const NumIters = 3
+
+  for scale in countup(3, 13, 2):
+    let order = 1 shl scale
+    let plainDesc = FrFFT_Descriptor[F].new(order = order, ctt_eth_kzg_fr_pow2_roots_of_unity[scale])
+    var fusedDesc = FrFFT_Descriptor[F].new(order = order, ctt_eth_kzg_fr_pow2_roots_of_unity[scale])
+
+    let cosetShift = F.fromUint(5'u32)
+    fusedDesc.precomputeCosetTwiddles(cosetShift, order)
+
+    var data = newSeq[F](order)
+    for i in 0 ..< order:
+      data[i].fromUint(uint64(i + 1))
+
+    var freq = newSeq[F](order)
+
+    bench("Fr Coset FFT NR", "Fr[BLS12-381]", order, NumIters):
+      let status = coset_fft_nr(plainDesc, freq, data, cosetShift)
+      doAssert status == FFT_Success
+
+    bench("Fr Coset FFT NR fused", "Fr[BLS12-381]", order, NumIters):
+      let status = coset_fft_nr(fusedDesc, freq, data, cosetShift)
+      doAssert status == FFT_Success
+
+    bench("Fr Coset IFFT RN", "Fr[BLS12-381]", order, NumIters):
+      let status = coset_ifft_rn(plainDesc, data, freq, cosetShift)
+      doAssert status == FFT_Success
+
+    bench("Fr Coset IFFT RN fused", "Fr[BLS12-381]", order, NumIters):
+      let status = coset_ifft_rn(fusedDesc, data, freq, cosetShift)
+      doAssert status == FFT_Success
+
 proc bench_Fr_FFT_NR_via_Recursive_and_BitRev*() =
   echo "\n=== Fr FFT (Natural → Bit-Reversed, Recursive + BitRev) Benchmark ==="
   separator()
@@ -355,6 +511,12 @@ when isMainModule:
   echo "  - Fr FFT NR DIF:       Natural → Bit-Reversed (iterative DIF)"
   echo "  - Fr FFT RN DIT:       Bit-Reversed → Natural (iterative DIT)"
   echo "  - Fr FFT NN Stockham:  Natural → Natural (Stockham)"
+  echo "  - Fr FFT NR Four-Step: Natural → Bit-Reversed (four-step, cache-friendly)"
+  echo "  - Fr FFT NR DIF kRadixN: Natural → Bit-Reversed (iterative DIF, radix-2/4/8 kernels)"
+  echo "  - Fr FFT RN DIT kRadixN: Bit-Reversed → Natural (iterative DIT, radix-2/4/8 kernels)"
+  echo "  - Fr FFT NR batch x64:   64 transforms of the same size, sharing roots of unity"
+  echo "  - Fr Coset FFT batch x64: 64 coset transforms sharing the shift powers and the batched kernels"
+  echo "  - Fr Coset FFT NR fused: Coset shift folded into the first DIF stage (cached twiddles)"
   echo ""
   echo "  COMBINATIONS (algorithm + bit-reversal):"
   echo "  - Fr FFT NR Rec+BR:    Natural → Bit-Reversed (Recursive + BitRev)"
@@ -377,6 +539,10 @@ when isMainModule:
   bench_Fr_FFT_NR_Iterative_DIF()
   bench_Fr_FFT_RN_Iterative_DIT()
   bench_Fr_FFT_NN_Stockham()
+  bench_Fr_FFT_NR_FourStep()
+  bench_Fr_FFT_Radix()
+  bench_Fr_FFT_Batch()
+  bench_Fr_Coset_FFT()
   echo ""
   echo "--- Combinations (Algorithm + Bit-Reversal) ---"
   bench_Fr_FFT_NR_via_Recursive_and_BitRev()
@@ -391,5 +557,8 @@ when isMainModule:
   bench_Fr_IFFT_NN_Dispatch()
   bench_Fr_IFFT_RN_Iterative_DIT()
   bench_Fr_IFFT_NN_via_BitRev_and_Iterative_DIT()
+  echo ""
+  echo "--- Large sizes ---"
+  bench_Fr_FFT_NR_Large()
 
   echo ""
\ No newline at end of file
@@ -60,6 +60,11 @@ proc main() =
     separator()
     gtExpEndo_constanttimeBench(Fp12[curve], ExpIters)
     separator()
+    gtExp_fixedBaseBench(Fp12[curve], numBlocks = 4, ExpIters)
+    gtExp_fixedBaseBench(Fp12[curve], numBlocks = 16, ExpIters)
+    gtExp_fixedBaseTorusBench(Fp12[curve], numBlocks = 16, ExpIters)
+    gtExp_fixedBase_vartimeBench(Fp12[curve], numBlocks = 16, ExpIters)
+    separator()
 
 
 main()
@@ -21,7 +21,8 @@ import
     pairings_generic,
     cyclotomic_subgroups,
     gt_exponentiations,
-    gt_exponentiations_vartime
+    gt_exponentiations_vartime,
+    gt_exponentiations_fixed_base
   ],
   # Helpers
   helpers/prng_unsafe,
@@ -172,3 +173,32 @@ proc gtExpEndo_constanttimeBench*(T: typedesc, iters: int) =
   var r {.noInit.}: T
   bench("𝔾ₜ Exponentiation " & $exponent.bits & "-bit (endomorphism, constant-time)", T, iters):
     r.gtExpEndo(x, exponent)
+
+proc gtExp_fixedBaseBench*(T: typedesc, numBlocks: int, iters: int) =
+  let x = rng.random_gt(T)
+  let exponent = rng.random_unsafe(BigInt[Fr[T.Name].bits()])
+  var table: GtFixedBaseTable[T.Name]
+  table.init(x, numBlocks)
+  var r {.noInit.}: T
+  bench("𝔾ₜ Exponentiation " & $exponent.bits & "-bit (fixed-base, " & $numBlocks & " blocks, constant-time)", T, iters):
+    r.gtExp_fixedBase(table, exponent)
+
+proc gtExp_fixedBaseTorusBench*(T: typedesc, numBlocks: int, iters: int) =
+  let x = rng.random_gt(T)
+  let exponent = rng.random_unsafe(BigInt[Fr[T.Name].bits()])
+  var table: GtFixedBaseTable[T.Name]
+  var torusTable: GtFixedBaseTorusTable[T.Name]
+  table.init(x, numBlocks)
+  doAssert torusTable.compress(table)
+  var r {.noInit.}: T
+  bench("𝔾ₜ Exponentiation " & $exponent.bits & "-bit (fixed-base torus, " & $numBlocks & " blocks, constant-time)", T, iters):
+    r.gtExp_fixedBase(torusTable, exponent)
+
+proc gtExp_fixedBase_vartimeBench*(T: typedesc, numBlocks: int, iters: int) =
+  let x = rng.random_gt(T)
+  let exponent = rng.random_unsafe(BigInt[Fr[T.Name].bits()])
+  var table: GtFixedBaseTable[T.Name]
+  table.init(x, numBlocks)
+  var r {.noInit.}: T
+  bench("𝔾ₜ Exponentiation " & $exponent.bits & "-bit (fixed-base, " & $numBlocks & " blocks, vartime)", T, iters):
+    r.gtExp_fixedBase_vartime(table, exponent)
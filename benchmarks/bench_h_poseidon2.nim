@@ -0,0 +1,83 @@
+import
+  # Internals
+  constantine/named/algebras,
+  constantine/math/arithmetic,
+  constantine/hashes,
+  constantine/hashes/poseidon2/poseidon2,
+  # Helpers
+  helpers/prng_unsafe,
+  ./bench_blueprint
+
+proc separator*() = separator(83)
+
+# --------------------------------------------------------------------
+#
+# Poseidon2 2-to-1 compression vs SHA256 of 64 bytes,
+# i.e. the cost of hashing a node of a Merkle tree.
+
+proc report(op: string, startTime, stopTime: MonoTime, startClk, stopClk: int64, iters, hashesPerIter: int) =
+  let ns = inNanoseconds((stopTime-startTime) div (iters*hashesPerIter))
+  let throughput = 1e9 / float64(ns)
+  when SupportsGetTicks:
+    let cycles = (stopClk - startClk) div (iters*hashesPerIter)
+    echo &"{op:<55}     {throughput:>15.3f} hashes/s    {ns:>9} ns/hash    {cycles:>10} cycles/hash"
+  else:
+    echo &"{op:<55}     {throughput:>15.3f} hashes/s    {ns:>9} ns/hash"
+
+template bench(op: string, iters, hashesPerIter: int, body: untyped): untyped =
+  measure(iters, startTime, stopTime, startClk, stopClk, body)
+  report(op, startTime, stopTime, startClk, stopClk, iters, hashesPerIter)
+
+proc benchPoseidon2_compress(F: typedesc, iters: int) =
+  const D = poseidon2.digestLen(F)
+  var left, right, digest: array[D, F]
+  for i in 0 ..< D:
+    left[i] = rng.random_unsafe(F)
+    right[i] = rng.random_unsafe(F)
+  bench("Poseidon2 " & $F.Name & " - compress", iters, 1):
+    poseidon2.compress(digest, left, right)
+
+proc benchPoseidon2_compressMany(F: typedesc, numParents: int, iters: int) =
+  const D = poseidon2.digestLen(F)
+  var children = newSeq[array[D, F]](2*numParents)
+  var parents = newSeq[array[D, F]](numParents)
+  for i in 0 ..< children.len:
+    for j in 0 ..< D:
+      children[i][j] = rng.random_unsafe(F)
+  bench("Poseidon2 " & $F.Name & " - compressMany " & $numParents, iters, numParents):
+    poseidon2.compressMany(parents, children)
+
+proc benchSHA256_64B(iters: int) =
+  let msg = rng.random_byte_seq(64)
+  var buf: array[64, byte]
+  for i in 0 ..< 64:
+    buf[i] = msg[i]
+  var digest: array[32, byte]
+  bench("SHA256 - hash_64B", iters, 1):
+    sha256.hash_64B(digest, buf)
+
+proc benchSHA256_many(numMessages: int, iters: int) =
+  let msgs = rng.random_byte_seq(64*numMessages)
+  var digests = newSeq[array[32, byte]](numMessages)
+  bench("SHA256 - hashMany " & $numMessages & "x64B", iters, numMessages):
+    sha256.hashMany(digests, msgs)
+
+when isMainModule:
+  proc main() =
+    const iters = 10_000
+    const numParents = 1024
+    const itersMany = 20
+
+    benchSHA256_64B(iters)
+    benchSHA256_many(numParents, itersMany)
+    separator()
+    benchPoseidon2_compress(Fr[BN254_Snarks], iters)
+    benchPoseidon2_compressMany(Fr[BN254_Snarks], numParents, itersMany)
+    benchPoseidon2_compress(Fr[BLS12_381], iters)
+    benchPoseidon2_compressMany(Fr[BLS12_381], numParents, itersMany)
+    separator()
+    benchPoseidon2_compress(Fp[Goldilocks], iters)
+    benchPoseidon2_compressMany(Fp[Goldilocks], numParents, itersMany)
+    separator()
+
+  main()
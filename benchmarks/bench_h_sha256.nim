@@ -37,6 +37,12 @@ proc benchSHA256_constantine[T](msg: openarray[T], msgComment: string, iters: in
   bench("SHA256 - Constantine - " & msgComment, msg.len, iters):
     sha256.hash(digest, msg)
 
+proc benchSHA256_many(msgLen, numMessages: int, iters: int) =
+  let msgs = rng.random_byte_seq(msgLen*numMessages)
+  var digests = newSeq[array[32, byte]](numMessages)
+  bench("SHA256 - Constantine - hashMany " & $numMessages & "x" & $msgLen & "B", msgLen*numMessages, iters):
+    sha256.hashMany(digests, msgs)
+
 proc benchSHA256_openssl[T](msg: openarray[T], msgComment: string, iters: int) =
   var digest: array[32, byte]
   bench("SHA256 - OpenSSL     - " & msgComment, msg.len, iters):
@@ -59,4 +65,9 @@ when isMainModule:
       when not defined(windows): # not available on Windows in GH actions atm
         benchSHA256_openssl(msg, $s & "B", iters)
 
+    separator()
+    for numMessages in [8, 16, 1024]:
+      let iters = int(target_cycles div (64'i64 * numMessages.int64 * worst_cycles_per_bytes))
+      benchSHA256_many(64, numMessages, iters)
+
   main()
@@ -63,6 +63,36 @@ proc bench_BLS12_381_hash_to_G2(iters: int) =
       domainSepTag = dst
     )
 
+proc bench_BLS12_381_hash_to_G1_XOF(iters: int) =
+  const dst = "BLS_SIG_BLS12381G1-SHAKE128-SSWU-RO_POP_"
+  let msg = "Mr F was here"
+
+  var P: EC_ShortW_Jac[Fp[BLS12_381], G1]
+
+  bench("Hash to G1 (SSWU method - SHAKE128 XOF)", BLS12_381, iters):
+    shake128.hashToCurve(
+      k = 128,
+      output = P,
+      augmentation = "",
+      message = msg,
+      domainSepTag = dst
+    )
+
+proc bench_BLS12_381_hash_to_G2_XOF(iters: int) =
+  const dst = "BLS_SIG_BLS12381G2-SHAKE128-SSWU-RO_POP_"
+  let msg = "Mr F was here"
+
+  var P: EC_ShortW_Jac[Fp2[BLS12_381], G2]
+
+  bench("Hash to G2 (SSWU method - SHAKE128 XOF)", BLS12_381, iters):
+    shake128.hashToCurve(
+      k = 128,
+      output = P,
+      augmentation = "",
+      message = msg,
+      domainSepTag = dst
+    )
+
 proc bench_BLS12_381_hash_to_G1_SVDW(iters: int) =
   const dst = "BLS_SIG_BLS12381G1-SHA256-SVDW-RO_POP_"
   let msg = "Mr F was here"
@@ -123,6 +153,21 @@ proc bench_BN254_Snarks_hash_to_G2(iters: int) =
       domainSepTag = dst
     )
 
+proc bench_hash_to_curve_batch(EC: typedesc, dst: string, numMessages, iters: int) =
+  var msgs = newSeq[array[32, byte]](numMessages)
+  for i in 0 ..< numMessages:
+    for j in 0 ..< 32:
+      msgs[i][j] = byte rng.next()
+
+  var points = newSeq[EC](numMessages)
+
+  bench("Batch hash to " & $EC.G & " (" & $numMessages & " messages)", EC.F.Name, iters):
+    sha256.hashToCurve_batch(
+      k = 128,
+      output = points,
+      messages = msgs,
+      domainSepTag = dst
+    )
 
 proc bench_BLS12_381_G1_jac_aff_conversion(iters: int) =
   const dst = "BLS_SIG_BLS12381G1-SHA256-SSWU-RO_POP_"
@@ -166,10 +211,17 @@ proc main() =
   separator()
   bench_BLS12_381_hash_to_G1(Iters)
   bench_BLS12_381_hash_to_G2(Iters)
+  bench_BLS12_381_hash_to_G1_XOF(Iters)
+  bench_BLS12_381_hash_to_G2_XOF(Iters)
   bench_BLS12_381_hash_to_G1_SVDW(Iters)
   bench_BLS12_381_hash_to_G2_SVDW(Iters)
   bench_BN254_Snarks_hash_to_G1(Iters)
   bench_BN254_Snarks_hash_to_G2(Iters)
+  separator()
+  bench_hash_to_curve_batch(EC_ShortW_Aff[Fp[BLS12_381], G1], "BLS_SIG_BLS12381G1-SHA256-SSWU-RO_POP_", 64, Iters div 64)
+  bench_hash_to_curve_batch(EC_ShortW_Aff[Fp2[BLS12_381], G2], "BLS_SIG_BLS12381G2-SHA256-SSWU-RO_POP_", 64, Iters div 64)
+  bench_hash_to_curve_batch(EC_ShortW_Aff[Fp[BN254_Snarks], G1], "BLS_SIG_BN254SNARKSG1-SHA256-SVDW-RO_POP_", 64, Iters div 64)
+  separator()
   bench_BLS12_381_G1_jac_aff_conversion(Iters)
   bench_BLS12_381_G2_jac_aff_conversion(Iters)
   separator()
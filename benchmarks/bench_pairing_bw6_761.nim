@@ -0,0 +1,48 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/named/algebras,
+  constantine/math/arithmetic,
+  constantine/math/extension_fields,
+  # Helpers
+  ./bench_pairing_template
+
+# ############################################################
+#
+#               Benchmark of pairings
+#                   for BW6-761
+#
+# ############################################################
+
+
+const Iters = 20
+const AvailableCurves = [
+  BW6_761,
+]
+
+proc main() =
+  separator()
+  staticFor i, 0, AvailableCurves.len:
+    const curve = AvailableCurves[i]
+    millerLoopBW6_761Bench(curve, Iters)
+    finalExpBW6_761Bench(curve, Iters)
+    separator()
+    pairingBW6_761Bench(curve, Iters)
+    pairing_multipairing_BW6_761Bench(curve, 1, Iters)
+    separator()
+    staticFor j, 2, 4:
+      pairing_multisingle_BW6_761Bench(curve, j, Iters div j)
+      pairing_multipairing_BW6_761Bench(curve, j, Iters div j)
+    separator()
+    staticFor j, 4, 9:
+      pairing_multipairing_BW6_761Bench(curve, j, max(1, Iters div j))
+
+main()
+notes()
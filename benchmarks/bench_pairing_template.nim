@@ -24,7 +24,8 @@ import
     cyclotomic_subgroups,
     lines_eval,
     pairings_bls12,
-    pairings_bn
+    pairings_bn,
+    pairings_bw6_761
   ],
   constantine/named/zoo_pairings,
   # Helpers
@@ -307,3 +308,59 @@ proc pairing_multipairing_BNBench*(Name: static Algebra, N: static int, iters: i
   var f: Fp12[Name]
   bench("Pairing BN batched:     " & $N, Name, iters):
     f.pairing_bn(Ps, Qs)
+
+proc millerLoopBW6_761Bench*(Name: static Algebra, iters: int) =
+  let
+    P = rng.random_point(EC_ShortW_Aff[Fp[Name], G1])
+    Q = rng.random_point(EC_ShortW_Aff[Fp[Name], G2])
+
+  var f: Fp6[Name]
+  bench("Miller Loop BW6", Name, iters):
+    f.millerLoopBW6_761(Q, P)
+
+proc finalExpBW6_761Bench*(Name: static Algebra, iters: int) =
+  var r = rng.random_unsafe(Fp6[Name])
+  bench("Final Exponentiation BW6", Name, iters):
+    r.finalExp_BW6_761()
+
+proc pairingBW6_761Bench*(Name: static Algebra, iters: int) =
+  let
+    P = rng.random_point(EC_ShortW_Aff[Fp[Name], G1])
+    Q = rng.random_point(EC_ShortW_Aff[Fp[Name], G2])
+
+  var f: Fp6[Name]
+  bench("Pairing BW6", Name, iters):
+    f.pairing_bw6_761(P, Q)
+
+proc pairing_multisingle_BW6_761Bench*(Name: static Algebra, N: static int, iters: int) =
+  var
+    Ps {.noInit.}: array[N, EC_ShortW_Aff[Fp[Name], G1]]
+    Qs {.noInit.}: array[N, EC_ShortW_Aff[Fp[Name], G2]]
+
+    GTs {.noInit.}: array[N, Fp6[Name]]
+
+  for i in 0 ..< N:
+    Ps[i] = rng.random_point(typeof(Ps[0]))
+    Qs[i] = rng.random_point(typeof(Qs[0]))
+
+  var f: Fp6[Name]
+  bench("Pairing BW6 non-batched: " & $N, Name, iters):
+    for i in 0 ..< N:
+      GTs[i].pairing_bw6_761(Ps[i], Qs[i])
+
+    f = GTs[0]
+    for i in 1 ..< N:
+      f *= GTs[i]
+
+proc pairing_multipairing_BW6_761Bench*(Name: static Algebra, N: static int, iters: int) =
+  var
+    Ps {.noInit.}: array[N, EC_ShortW_Aff[Fp[Name], G1]]
+    Qs {.noInit.}: array[N, EC_ShortW_Aff[Fp[Name], G2]]
+
+  for i in 0 ..< N:
+    Ps[i] = rng.random_point(typeof(Ps[0]))
+    Qs[i] = rng.random_point(typeof(Qs[0]))
+
+  var f: Fp6[Name]
+  bench("Pairing BW6 batched:     " & $N, Name, iters):
+    f.pairing_bw6_761(Ps, Qs)
@@ -8,9 +8,10 @@
 
 import
   constantine/lowlevel_elliptic_curves_parallel,
+  constantine/lowlevel_pairing_curves_parallel,
   constantine/threadpool
 
-export lowlevel_elliptic_curves_parallel
+export lowlevel_elliptic_curves_parallel, lowlevel_pairing_curves_parallel
 
 template genParallelBindings_EC_ShortW_NonAffine*(EC, EcAff, ScalarField: untyped) =
   # TODO: remove the need of explicit ScalarField
@@ -43,3 +44,20 @@ template genParallelBindings_EC_ShortW_NonAffine*(EC, EcAff, ScalarField: untype
           points: ptr UncheckedArray[EcAff],
           len: csize_t) {.libExport.} =
     tp.multiScalarMul_vartime_parallel(r.addr, coefs, points, cast[int](len))
+
+template genParallelBindings_Pairing*(G1Aff, G2Aff: untyped, curve: untyped) =
+  when appType == "lib":
+    {.pragma: libExport, dynlib, exportc,  raises: [].} # No exceptions allowed
+  else:
+    {.pragma: libExport, exportc,  raises: [].} # No exceptions allowed
+
+  # --------------------------------------------------------------------------------------
+  proc `ctt _ curve _ pairing_check_parallel`(
+          tp: Threadpool,
+          Ps: ptr UncheckedArray[G1Aff],
+          Qs: ptr UncheckedArray[G2Aff],
+          len: csize_t): bool {.libExport.} =
+    tp.pairing_check_parallel(
+      Ps.toOpenArray(0, cast[int](len)-1),
+      Qs.toOpenArray(0, cast[int](len)-1))
+
@@ -65,6 +65,7 @@ collectBindings(cBindings_bls12_381):
 collectBindings(cBindings_bls12_381_parallel):
   genParallelBindings_EC_ShortW_NonAffine(bls12_381_g1_jac, bls12_381_g1_aff, bls12_381_fr)
   genParallelBindings_EC_ShortW_NonAffine(bls12_381_g1_prj, bls12_381_g1_aff, bls12_381_fr)
+  genParallelBindings_Pairing(bls12_381_g1_aff, bls12_381_g2_aff, bls12_381)
 # ----------------------------------------------------------
 
 type
@@ -100,6 +101,7 @@ collectBindings(cBindings_bn254_snarks):
 collectBindings(cBindings_bn254_snarks_parallel):
   genParallelBindings_EC_ShortW_NonAffine(bn254_snarks_g1_jac, bn254_snarks_g1_aff, bn254_snarks_fr)
   genParallelBindings_EC_ShortW_NonAffine(bn254_snarks_g1_prj, bn254_snarks_g1_aff, bn254_snarks_fr)
+  genParallelBindings_Pairing(bn254_snarks_g1_aff, bn254_snarks_g2_aff, bn254_snarks)
 
 # ----------------------------------------------------------
 
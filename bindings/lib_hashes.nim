@@ -46,3 +46,31 @@ func sha256_hash(digest: var array[32, byte], message: openArray[byte], clearMem
   # - Can be tail-call optimized into a goto jump instead of call/return
   # - Can be LTO-optimized
   sha256.hash(digest, message, clearMem)
+
+func keccak256_hash_many(
+       digests: ptr UncheckedArray[array[32, byte]],
+       messages: ptr UncheckedArray[byte],
+       msgLen, numMessages: csize_t) {.used, libPrefix: "ctt_".} =
+  ## Compute the Keccak256 hash of `numMessages` independent messages
+  ## of the same length `msgLen`, stored contiguously in `messages`
+  ## and store the results in digests.
+  keccak256.hashMany(digests, messages, int msgLen, int numMessages)
+
+func keccak256_hash_many_varlen(
+       digests: ptr UncheckedArray[array[32, byte]],
+       messages: ptr UncheckedArray[ptr UncheckedArray[byte]],
+       msgLens: ptr UncheckedArray[csize_t],
+       numMessages: csize_t) {.used, libPrefix: "ctt_".} =
+  ## Compute the Keccak256 hash of `numMessages` independent messages
+  ## of variable lengths and store the results in digests.
+  static: doAssert sizeof(csize_t) == sizeof(int)
+  keccak256.hashMany(digests, messages, cast[ptr UncheckedArray[int]](msgLens), int numMessages)
+
+func sha256_hash_many(
+       digests: ptr UncheckedArray[array[32, byte]],
+       messages: ptr UncheckedArray[byte],
+       msgLen, numMessages: csize_t) {.used, libPrefix: "ctt_".} =
+  ## Compute the SHA-256 hash of `numMessages` independent messages
+  ## of the same length `msgLen`, stored contiguously in `messages`
+  ## and store the results in digests.
+  sha256.hashMany(digests, messages, int msgLen, int numMessages)
@@ -0,0 +1,255 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  ../platforms/[abstractions, views],
+  ../serialization/endians,
+  ../mac/mac_poly1305,
+  ./chacha20
+
+# ############################################################
+#
+#          ChaCha20-Poly1305 Authenticated Encryption
+#                 with Associated Data (AEAD)
+#
+# ############################################################
+
+# Implementation of IETF ChaCha20-Poly1305 AEAD
+# https://datatracker.ietf.org/doc/html/rfc8439#section-2.8
+# ---------------------------------------------------------
+#
+# - The Poly1305 one-time key is the first 32 bytes of the ChaCha20 block 0.
+# - Data is encrypted with the keystream starting from block 1.
+# - The tag authenticates
+#     AAD | pad16 | ciphertext | pad16 | le64(len(AAD)) | le64(len(ciphertext))
+#
+# Encryption and authentication are done in a single pass:
+# data is processed in chunks that fit in L1 cache,
+# each chunk is encrypted then authenticated (seal)
+# or authenticated then decrypted (open) while still hot in cache,
+# with the multi-block SIMD ChaCha20 and the vectorized Poly1305 when available.
+
+{.push raises:[].}  # No exceptions for crypto
+{.push checks:off.} # We want unchecked int and array accesses
+
+const
+  ChunkSize = 4096
+    ## Data is encrypted and authenticated in chunks of 4KiB
+    ## to stay in L1 cache between the cipher and MAC passes.
+    ## Must be a multiple of the ChaCha20 block size.
+
+type ChaCha20Poly1305_CTX = object
+  key: array[32, byte]
+  nonce: array[12, byte]
+  counter: uint32
+  ks: array[64, byte] # Keystream of the current partial block
+  ksPos: uint8        # Keystream bytes consumed, 64 if none left
+  aadPadded: bool
+  mac: poly1305
+  aadLen: uint64
+  dataLen: uint64
+
+type chacha20poly1305* = ChaCha20Poly1305_CTX
+
+# Internals
+# ----------------------------------------------------------------
+
+func pad16(ctx: var ChaCha20Poly1305_CTX, len: uint64) =
+  ## Authenticate zero padding up to a 16-byte boundary
+  const zeros = default(array[16, byte])
+  let rem = int(len and 15)
+  if rem != 0:
+    ctx.mac.update(zeros.toOpenArray(0, 16-rem-1))
+
+func xorKeystream(ctx: var ChaCha20Poly1305_CTX, data: var openArray[byte]) =
+  ## data <- data ⊕ keystream
+  ## continuing the keystream where the previous call stopped.
+  var cur = 0
+
+  # 1. Leftover keystream of a partial block, erased on the way
+  while ctx.ksPos < 64 and cur < data.len:
+    data[cur] = data[cur] xor ctx.ks[ctx.ksPos]
+    ctx.ks[ctx.ksPos] = byte 0
+    ctx.ksPos += 1
+    cur += 1
+
+  # 2. Full blocks
+  let full = (data.len - cur) and not 63
+  if full > 0:
+    ctx.counter = chacha20_cipher(
+      ctx.key, ctx.counter, ctx.nonce,
+      data.toOpenArray(cur, cur+full-1))
+    cur += full
+
+  # 3. Partial block, the remaining keystream is kept for the next call
+  if cur < data.len:
+    ctx.counter = chacha20_keystream(ctx.key, ctx.counter, ctx.nonce, ctx.ks)
+    ctx.ksPos = 0
+    while cur < data.len:
+      data[cur] = data[cur] xor ctx.ks[ctx.ksPos]
+      ctx.ks[ctx.ksPos] = byte 0
+      ctx.ksPos += 1
+      cur += 1
+
+func startData(ctx: var ChaCha20Poly1305_CTX, len: int) =
+  ## Pad the AAD on the first data update
+  ## and account for the data length.
+  if not ctx.aadPadded:
+    ctx.pad16(ctx.aadLen)
+    ctx.aadPadded = true
+  ctx.dataLen += uint64(len)
+
+func nextChunkLen(ctx: ChaCha20Poly1305_CTX, remaining: int): int =
+  ## The first chunk also consumes the leftover keystream
+  ## so that following chunks are aligned on ChaCha20 blocks.
+  let leftover = (64 - ctx.ksPos.int) and 63
+  return min(remaining, leftover + ChunkSize)
+
+func finishTag(ctx: var ChaCha20Poly1305_CTX, tag: var array[16, byte]) =
+  ctx.startData(0)
+  ctx.pad16(ctx.dataLen)
+
+  var lengths{.noInit.}: array[16, byte]
+  lengths.dumpRawInt(ctx.aadLen, 0, littleEndian)
+  lengths.dumpRawInt(ctx.dataLen, 8, littleEndian)
+  ctx.mac.update(lengths)
+  ctx.mac.finish(tag)
+
+# Public API
+# ----------------------------------------------------------------
+
+func init*(ctx: var ChaCha20Poly1305_CTX, key: array[32, byte], nonce: array[12, byte]) =
+  ## Initialize a ChaCha20-Poly1305 context
+  ## for incremental encryption or decryption.
+  ## - `key` is a 256-bit (32 bytes) secret shared encryption/decryption key.
+  ## - `nonce` (Number-used-once), nonce MUST NOT be reused for the same key.
+  ##   If multiple senders are using the same key,
+  ##   `nonce` MUST be made unique per sender.
+  ##
+  ## A message is limited to 2³²-1 blocks of 64 bytes, i.e. 256GiB.
+  ctx.key = key
+  ctx.nonce = nonce
+
+  var polyKey{.noInit.}: array[32, byte]
+  ctx.counter = chacha20_keystream(key, counter = 0, nonce, polyKey)
+  ctx.mac.init(polyKey)
+  polyKey.setZero()
+
+  ctx.ks.setZero()
+  ctx.ksPos = 64
+  ctx.aadPadded = false
+  ctx.aadLen = 0
+  ctx.dataLen = 0
+
+func clear*(ctx: var ChaCha20Poly1305_CTX) =
+  ## Clear the context internal buffers
+  ctx.key.setZero()
+  ctx.nonce.setZero()
+  ctx.counter = 0
+  ctx.ks.setZero()
+  ctx.ksPos = 64
+  ctx.aadPadded = false
+  ctx.mac.clear()
+  ctx.aadLen = 0
+  ctx.dataLen = 0
+
+func updateAAD*(ctx: var ChaCha20Poly1305_CTX, aad: openArray[byte]) {.genCharAPI.} =
+  ## Append additional authenticated data (AAD).
+  ## AAD is authenticated but not encrypted, for example a header or a key identifier.
+  ##
+  ## All AAD MUST be appended before any data is sealed or opened.
+  debug:
+    doAssert not ctx.aadPadded, "AAD must be appended before data"
+  ctx.mac.update(aad)
+  ctx.aadLen += uint64(aad.len)
+
+func sealUpdate*(ctx: var ChaCha20Poly1305_CTX, data: var openArray[byte]) {.genCharAPI.} =
+  ## Encrypt and authenticate `data` in-place.
+  ## This can be called repeatedly to encrypt a stream.
+  ctx.startData(data.len)
+  var pos = 0
+  while pos < data.len:
+    let n = ctx.nextChunkLen(data.len - pos)
+    ctx.xorKeystream(data.toOpenArray(pos, pos+n-1))
+    ctx.mac.update(data.toOpenArray(pos, pos+n-1))
+    pos += n
+
+func sealFinish*(ctx: var ChaCha20Poly1305_CTX, tag: var array[16, byte]) =
+  ## Finalize encryption and output the authentication tag
+  ## to be sent alongside the ciphertext.
+  ##
+  ## The context is cleared.
+  ctx.finishTag(tag)
+  ctx.clear()
+
+func openUpdate*(ctx: var ChaCha20Poly1305_CTX, data: var openArray[byte]) {.genCharAPI.} =
+  ## Authenticate and decrypt `data` in-place.
+  ## This can be called repeatedly to decrypt a stream.
+  ##
+  ## Security note: the plaintext is unauthenticated until `openFinish` succeeds.
+  ## It MUST NOT be used or released before then
+  ## and MUST be discarded if `openFinish` fails.
+  ctx.startData(data.len)
+  var pos = 0
+  while pos < data.len:
+    let n = ctx.nextChunkLen(data.len - pos)
+    ctx.mac.update(data.toOpenArray(pos, pos+n-1))
+    ctx.xorKeystream(data.toOpenArray(pos, pos+n-1))
+    pos += n
+
+func openFinish*(ctx: var ChaCha20Poly1305_CTX, tag: array[16, byte]): bool =
+  ## Finalize decryption and verify the authentication tag
+  ## in constant-time.
+  ## Returns true if the ciphertext and AAD are authentic, false otherwise.
+  ##
+  ## The context is cleared.
+  var expected{.noInit.}: array[16, byte]
+  ctx.finishTag(expected)
+  ctx.clear()
+
+  var diff = Zero
+  for i in 0 ..< 16:
+    diff = diff or SecretWord(expected[i] xor tag[i])
+  expected.setZero()
+  return bool(diff.isZero())
+
+func seal*(
+       T: type chacha20poly1305,
+       tag: var array[16, byte],
+       data: var openArray[byte],
+       key: array[32, byte],
+       nonce: array[12, byte],
+       aad: openArray[byte]) =
+  ## Encrypt `data` in-place and produce an authentication tag
+  ## over the ciphertext and the additional authenticated data `aad`.
+  ## - `key` is a 256-bit (32 bytes) secret shared encryption/decryption key.
+  ## - `nonce` (Number-used-once), nonce MUST NOT be reused for the same key.
+  var ctx {.noInit.}: chacha20poly1305
+  ctx.init(key, nonce)
+  ctx.updateAAD(aad)
+  ctx.sealUpdate(data)
+  ctx.sealFinish(tag)
+
+func open*(
+       T: type chacha20poly1305,
+       data: var openArray[byte],
+       tag: array[16, byte],
+       key: array[32, byte],
+       nonce: array[12, byte],
+       aad: openArray[byte]): bool =
+  ## Verify the authentication tag and decrypt `data` in-place.
+  ## Returns true on success.
+  ## On failure, false is returned and `data` is zeroed
+  ## so that unauthenticated plaintext is never exposed.
+  var ctx {.noInit.}: chacha20poly1305
+  ctx.init(key, nonce)
+  ctx.updateAAD(aad)
+  ctx.openUpdate(data)
+  result = ctx.openFinish(tag)
+  if not result:
+    data.setZero()
@@ -7,9 +7,12 @@
 # at your option. This file may not be copied, modified, or distributed except according to those terms.
 
 import
-  ../platforms/views,
+  ../platforms/[abstractions, views],
   ../serialization/endians
 
+when UseASM_X86_32:
+  import ./[chacha20_x86_avx2, chacha20_x86_avx512]
+
 # ############################################################
 #
 #                     ChaCha20 stream cipher
@@ -60,33 +63,78 @@ template inner_block(s: var array[16, uint32]) =
   state.qround(2, 7, 8, 13)
   state.qround(3, 4, 9, 14)
 
-func chacha20_block(
-       key_stream: var array[64, byte],
-       key: array[8, uint32],
-       block_counter: uint32,
-       nonce: array[3, uint32]) =
+func chacha20_init(
+       state: var array[16, uint32],
+       key: array[32, byte],
+       counter: uint32,
+       nonce: array[12, byte]) =
+  ## Initialize the ChaCha20 input state
+  ##  cccc  cccc  cccc  cccc
+  ##  kkkk  kkkk  kkkk  kkkk
+  ##  kkkk  kkkk  kkkk  kkkk
+  ##  bbbb  nnnn  nnnn  nnnn
   const cccc = [uint32 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574]
-  var state{.noInit.}: array[16, uint32]
-
   for i in 0 ..< 4:
     state[i] = cccc[i]
+  var pos = 0
   for i in 4 ..< 12:
-    state[i] = key[i-4]
-  state[12] = block_counter
+    state[i] = uint32.fromBytes(key, pos, littleEndian)
+    pos += sizeof(uint32)
+  state[12] = counter
+  pos = 0
   for i in 13 ..< 16:
-    state[i] = nonce[i-13]
+    state[i] = uint32.fromBytes(nonce, pos, littleEndian)
+    pos += sizeof(uint32)
+
+func chacha20_block(
+       key_stream: var array[64, byte],
+       input: array[16, uint32]) =
+  var state = input
 
   for i in 0 ..< 10:
     state.inner_block()
 
   # uint32 are 4 bytes so multiply destination by 4
-  for i in 0 ..< 4:
-    key_stream.dumpRawInt(state[i] + cccc[i], i shl 2, littleEndian)
-  for i in 4 ..< 12:
-    key_stream.dumpRawInt(state[i] + key[i-4], i shl 2, littleEndian)
-  key_stream.dumpRawInt(state[12] + block_counter, 12 shl 2, littleEndian)
-  for i in 13 ..< 16:
-    key_stream.dumpRawInt(state[i] + nonce[i-13], i shl 2, littleEndian)
+  for i in 0 ..< 16:
+    key_stream.dumpRawInt(state[i] + input[i], i shl 2, littleEndian)
+
+func chacha20_stream(
+       dst, src: ptr UncheckedArray[byte],
+       len: int,
+       state: var array[16, uint32]) =
+  ## dst = src ⊕ keystream or dst = keystream if src is nil.
+  ## dst and src may alias.
+  ##
+  ## The block counter state[12] is incremented by the number of blocks used.
+  var eaten = 0
+
+  when UseASM_X86_32:
+    template process(numBlocks: static int, kernel: untyped) =
+      while len - eaten >= numBlocks*64:
+        kernel(dst +% eaten, if src.isNil: src else: src +% eaten, state)
+        eaten += numBlocks*64
+        state[12] += numBlocks
+
+    if ({.noSideEffect.}: hasAvx512f()):
+      process(16, chacha20_blocks_avx512_x16)
+    if ({.noSideEffect.}: hasAvx2()):
+      process(8, chacha20_blocks_avx2_x8)
+
+  while eaten < len:
+    var key_stream{.noInit.}: array[64, byte]
+    key_stream.chacha20_block(state)
+
+    # Plaintext length can be leaked, it doesn't reveal the content.
+    let n = min(64, len-eaten)
+    if src.isNil:
+      for i in 0 ..< n:
+        dst[eaten+i] = key_stream[i]
+    else:
+      for i in 0 ..< n:
+        dst[eaten+i] = src[eaten+i] xor key_stream[i]
+
+    eaten += 64
+    state[12] += 1
 
 func chacha20_cipher*(
        key: array[32, byte],
@@ -103,29 +151,35 @@ func chacha20_cipher*(
   ##
   ## Encryption/decryption is done in-place.
   ## Returns the new counter
-  var keyU{.noInit.}: array[8, uint32]
-  var nonceU{.noInit.}: array[3, uint32]
-
-  var pos = 0
-  for i in 0 ..< 8:
-    keyU[i] = uint32.fromBytes(key, pos, littleEndian)
-    pos += sizeof(uint32)
-  pos = 0
-  for i in 0 ..< 3:
-    nonceU[i] = uint32.fromBytes(nonce, pos, littleEndian)
-    pos += sizeof(uint32)
-
-  var counter = counter
-  var eaten = 0
-  while eaten < data.len:
-    var key_stream{.noInit.}: array[64, byte]
-    key_stream.chacha20_block(keyU, counter, nonceU)
+  var state{.noInit.}: array[16, uint32]
+  state.chacha20_init(key, counter, nonce)
 
-    # Plaintext length can be leaked, it doesn't reveal the content.
-    for i in eaten ..< min(eaten+64, data.len):
-      data[i].byte() ^= key_stream[i-eaten]
+  let p = data.asUnchecked()
+  chacha20_stream(p, p, data.len, state)
+  return state[12]
 
-    eaten += 64
-    counter += 1
+func chacha20_keystream*(
+       key: array[32, byte],
+       counter: uint32,
+       nonce: array[12, byte],
+       output: ptr UncheckedArray[byte],
+       len: int): uint32 =
+  ## Write `len` bytes of ChaCha20 keystream to `output`
+  ## starting from block `counter`.
+  ##
+  ## Returns the new counter
+  var state{.noInit.}: array[16, uint32]
+  state.chacha20_init(key, counter, nonce)
+  chacha20_stream(output, nil, len, state)
+  return state[12]
 
-  return counter
+func chacha20_keystream*(
+       key: array[32, byte],
+       counter: uint32,
+       nonce: array[12, byte],
+       output: var openArray[byte]): uint32 {.inline.} =
+  ## Write ChaCha20 keystream to `output`
+  ## starting from block `counter`.
+  ##
+  ## Returns the new counter
+  chacha20_keystream(key, counter, nonce, output.asUnchecked(), output.len)
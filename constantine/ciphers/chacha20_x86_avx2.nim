@@ -0,0 +1,118 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/isa_x86/simd_x86,
+  constantine/platforms/primitives
+
+{.localpassC:"-mavx2".}
+
+# ChaCha20, AVX2, 8 blocks in parallel
+# --------------------------------------------------------------------------------
+#
+# References:
+# - Martin Goll, Shay Gueron, 2014
+#   Vectorization on ChaCha Stream Cipher
+# - Daniel J. Bernstein, 2008
+#   ChaCha, a variant of Salsa20
+#   https://cr.yp.to/chacha/chacha-20080128.pdf
+#
+# Register x[w] holds the state word w of 8 consecutive blocks,
+# lane i being the block of counter `state[12] + i`.
+# The 20 rounds are then the scalar quarter rounds with each word replaced by a register
+# and no cross-lane shuffle is needed.
+#
+# Rotations by 16 and 8 are byte shuffles, rotations by 12 and 7 are shift+or.
+#
+# The keystream is then transposed in-register, 8 words at a time,
+# to recover the block-major serialization.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+template rotl(x: m256i, n: static int): m256i =
+  or_u256(shl_u32x8(x, int32 n), shr_u32x8(x, int32(32 - n)))
+
+template xorStore(dst, src: ptr UncheckedArray[byte], offset: int, ks: m256i) =
+  if src.isNil:
+    storeu_u256(dst[offset].addr, ks)
+  else:
+    storeu_u256(dst[offset].addr, xor_u256(ks, loadu_u256(src[offset].addr)))
+
+func chacha20_blocks_avx2_x8*(
+       dst, src: ptr UncheckedArray[byte],
+       state: array[16, uint32]) =
+  ## Process 8 consecutive ChaCha20 blocks, i.e. 512 bytes,
+  ## from the initial state `state` whose block counter is state[12].
+  ##
+  ## dst = src ⊕ keystream or dst = keystream if src is nil.
+  ## dst and src may alias.
+  let rot16 = setr_u64x4(0x0504070601000302'u64, 0x0d0c0f0e09080b0a'u64,
+                         0x0504070601000302'u64, 0x0d0c0f0e09080b0a'u64)
+  let rot8  = setr_u64x4(0x0605040702010003'u64, 0x0e0d0c0f0a09080b'u64,
+                         0x0605040702010003'u64, 0x0e0d0c0f0a09080b'u64)
+
+  template qround(x: var array[16, m256i], a, b, c, d: static int) =
+    x[a] = add_u32x8(x[a], x[b]); x[d] = shuf_u8x32(xor_u256(x[d], x[a]), rot16)
+    x[c] = add_u32x8(x[c], x[d]); x[b] = rotl(xor_u256(x[b], x[c]), 12)
+    x[a] = add_u32x8(x[a], x[b]); x[d] = shuf_u8x32(xor_u256(x[d], x[a]), rot8)
+    x[c] = add_u32x8(x[c], x[d]); x[b] = rotl(xor_u256(x[b], x[c]), 7)
+
+  var s{.noInit.}, x{.noInit.}: array[16, m256i]
+  staticFor w, 0, 16:
+    s[w] = set1_u32x8(state[w])
+  s[12] = add_u32x8(s[12], setr_u32x8(0'u32, 1, 2, 3, 4, 5, 6, 7))
+  x = s
+
+  for _ in 0 ..< 10:
+    # Column rounds
+    x.qround(0, 4, 8, 12)
+    x.qround(1, 5, 9, 13)
+    x.qround(2, 6, 10, 14)
+    x.qround(3, 7, 11, 15)
+    # Diagonal rounds
+    x.qround(0, 5, 10, 15)
+    x.qround(1, 6, 11, 12)
+    x.qround(2, 7, 8, 13)
+    x.qround(3, 4, 9, 14)
+
+  staticFor w, 0, 16:
+    x[w] = add_u32x8(x[w], s[w])
+
+  # 8x8 transpose of 32-bit words, for words 0..7 then 8..15,
+  # i.e. the first then second 32-byte half of each block.
+  staticFor half, 0, 2:
+    const w = 8*half
+    let t0 = unpacklo_u32x8(x[w+0], x[w+1])  # [b0w0, b0w1, b1w0, b1w1 | b4w0, b4w1, b5w0, b5w1]
+    let t1 = unpackhi_u32x8(x[w+0], x[w+1])  # [b2w0, b2w1, b3w0, b3w1 | b6w0, b6w1, b7w0, b7w1]
+    let t2 = unpacklo_u32x8(x[w+2], x[w+3])
+    let t3 = unpackhi_u32x8(x[w+2], x[w+3])
+    let t4 = unpacklo_u32x8(x[w+4], x[w+5])
+    let t5 = unpackhi_u32x8(x[w+4], x[w+5])
+    let t6 = unpacklo_u32x8(x[w+6], x[w+7])
+    let t7 = unpackhi_u32x8(x[w+6], x[w+7])
+
+    let u0 = unpacklo_u64x4(t0, t2)          # [b0w0..b0w3 | b4w0..b4w3]
+    let u1 = unpackhi_u64x4(t0, t2)          # [b1w0..b1w3 | b5w0..b5w3]
+    let u2 = unpacklo_u64x4(t1, t3)          # [b2w0..b2w3 | b6w0..b6w3]
+    let u3 = unpackhi_u64x4(t1, t3)          # [b3w0..b3w3 | b7w0..b7w3]
+    let u4 = unpacklo_u64x4(t4, t6)          # [b0w4..b0w7 | b4w4..b4w7]
+    let u5 = unpackhi_u64x4(t4, t6)
+    let u6 = unpacklo_u64x4(t5, t7)
+    let u7 = unpackhi_u64x4(t5, t7)
+
+    const o = 32*half
+    xorStore(dst, src, 0*64 + o, permute2x128_u256(u0, u4, 0x20))
+    xorStore(dst, src, 1*64 + o, permute2x128_u256(u1, u5, 0x20))
+    xorStore(dst, src, 2*64 + o, permute2x128_u256(u2, u6, 0x20))
+    xorStore(dst, src, 3*64 + o, permute2x128_u256(u3, u7, 0x20))
+    xorStore(dst, src, 4*64 + o, permute2x128_u256(u0, u4, 0x31))
+    xorStore(dst, src, 5*64 + o, permute2x128_u256(u1, u5, 0x31))
+    xorStore(dst, src, 6*64 + o, permute2x128_u256(u2, u6, 0x31))
+    xorStore(dst, src, 7*64 + o, permute2x128_u256(u3, u7, 0x31))
@@ -0,0 +1,90 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/isa_x86/simd_x86,
+  constantine/platforms/primitives
+
+{.localpassC:"-mavx512f".}
+
+# ChaCha20, AVX512, 16 blocks in parallel
+# --------------------------------------------------------------------------------
+#
+# See chacha20_x86_avx2.nim for the layout.
+# Lane i of register x[w] holds the state word w of the block of counter `state[12] + i`.
+# All rotations are a single vprold.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+template xorStore(dst, src: ptr UncheckedArray[byte], offset: int, ks: m512i) =
+  if src.isNil:
+    storeu_u512(dst[offset].addr, ks)
+  else:
+    storeu_u512(dst[offset].addr, xor_u512(ks, loadu_u512(src[offset].addr)))
+
+template qround(x: var array[16, m512i], a, b, c, d: static int) =
+  x[a] = add_u32x16(x[a], x[b]); x[d] = rotl_u32x16(xor_u512(x[d], x[a]), 16)
+  x[c] = add_u32x16(x[c], x[d]); x[b] = rotl_u32x16(xor_u512(x[b], x[c]), 12)
+  x[a] = add_u32x16(x[a], x[b]); x[d] = rotl_u32x16(xor_u512(x[d], x[a]), 8)
+  x[c] = add_u32x16(x[c], x[d]); x[b] = rotl_u32x16(xor_u512(x[b], x[c]), 7)
+
+func chacha20_blocks_avx512_x16*(
+       dst, src: ptr UncheckedArray[byte],
+       state: array[16, uint32]) =
+  ## Process 16 consecutive ChaCha20 blocks, i.e. 1024 bytes,
+  ## from the initial state `state` whose block counter is state[12].
+  ##
+  ## dst = src ⊕ keystream or dst = keystream if src is nil.
+  ## dst and src may alias.
+  var s{.noInit.}, x{.noInit.}: array[16, m512i]
+  staticFor w, 0, 16:
+    s[w] = set1_u32x16(state[w])
+  s[12] = add_u32x16(s[12], setr_u32x16(0'u32, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))
+  x = s
+
+  for _ in 0 ..< 10:
+    # Column rounds
+    x.qround(0, 4, 8, 12)
+    x.qround(1, 5, 9, 13)
+    x.qround(2, 6, 10, 14)
+    x.qround(3, 7, 11, 15)
+    # Diagonal rounds
+    x.qround(0, 5, 10, 15)
+    x.qround(1, 6, 11, 12)
+    x.qround(2, 7, 8, 13)
+    x.qround(3, 4, 9, 14)
+
+  staticFor w, 0, 16:
+    x[w] = add_u32x16(x[w], s[w])
+
+  # 16x16 transpose of 32-bit words
+  # 1. Within each group g of 4 words, 4x4 transposes in each 128-bit lane:
+  #    v[g][j] 128-bit lane L holds words 4g..4g+3 of block 4L+j
+  var v{.noInit.}: array[4, array[4, m512i]]
+  staticFor g, 0, 4:
+    let t0 = unpacklo_u32x16(x[4*g+0], x[4*g+1])
+    let t1 = unpackhi_u32x16(x[4*g+0], x[4*g+1])
+    let t2 = unpacklo_u32x16(x[4*g+2], x[4*g+3])
+    let t3 = unpackhi_u32x16(x[4*g+2], x[4*g+3])
+    v[g][0] = unpacklo_u64x8(t0, t2)
+    v[g][1] = unpackhi_u64x8(t0, t2)
+    v[g][2] = unpacklo_u64x8(t1, t3)
+    v[g][3] = unpackhi_u64x8(t1, t3)
+
+  # 2. Gather the 128-bit lanes L of v[0..3][j] to get block 4L+j
+  staticFor j, 0, 4:
+    let x0 = shuf_u128x4(v[0][j], v[1][j], 0x44)  # [g0 L0, g0 L1, g1 L0, g1 L1]
+    let x1 = shuf_u128x4(v[0][j], v[1][j], 0xEE)  # [g0 L2, g0 L3, g1 L2, g1 L3]
+    let x2 = shuf_u128x4(v[2][j], v[3][j], 0x44)
+    let x3 = shuf_u128x4(v[2][j], v[3][j], 0xEE)
+    xorStore(dst, src, (j+ 0)*64, shuf_u128x4(x0, x2, 0x88))
+    xorStore(dst, src, (j+ 4)*64, shuf_u128x4(x0, x2, 0xDD))
+    xorStore(dst, src, (j+ 8)*64, shuf_u128x4(x1, x3, 0x88))
+    xorStore(dst, src, (j+12)*64, shuf_u128x4(x1, x3, 0xDD))
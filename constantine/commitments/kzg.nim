@@ -225,14 +225,34 @@ func kzg_prove*[N: static int, Name: static Algebra; Ord](
 # KZG - Verifier
 # ------------------------------------------------------------
 
-func kzg_verify*[F2; Name: static Algebra](
+type KZGPreparedG2*[Name: static Algebra] = object
+  ## The fixed 𝔾2 points of a KZG verifier, [τ]₂ and [-1]₂,
+  ## with their Miller loop lines precomputed.
+  tauG2*: EC_ShortW_Aff[Fp2[Name], G2]
+  preparedTauG2*: PreparedG2[Name]
+  preparedNegG2*: PreparedG2[Name]
+
+func init*[Name: static Algebra](
+       g2: var KZGPreparedG2[Name],
+       tauG2: EC_ShortW_Aff[Fp2[Name], G2]) =
+  ## Precompute the Miller loop lines of [τ]₂ and [-1]₂
+  ## for repeated verifications against the same trusted setup.
+  var negG2 {.noInit.}: EC_ShortW_Aff[Fp2[Name], G2]
+  negG2.neg(Name.getGenerator("G2"))
+  g2.tauG2 = tauG2
+  g2.preparedTauG2.prepare(tauG2)
+  g2.preparedNegG2.prepare(negG2)
+
+func kzg_verify_operands[F2; Name: static Algebra](
+       tau_minus_challenge_G2: var EC_ShortW_Jac[F2, G2],
+       commitment_minus_eval_at_challenge_G1: var EC_ShortW_Jac[Fp[Name], G1],
        commitment: EC_ShortW_Aff[Fp[Name], G1],
        opening_challenge: BigInt, # Fr[Name].getBigInt(),
        eval_at_challenge: BigInt, # Fr[Name].getBigInt(),
-       proof: EC_ShortW_Aff[Fp[Name], G1],
-       tauG2: EC_ShortW_Aff[F2, G2]): bool {.tags:[Alloca, Vartime].} =
-  ## Verify a short KZG proof that ``p(opening_challenge) = eval_at_challenge``
-  ## without doing the whole p(opening_challenge) computation
+       tauG2: EC_ShortW_Aff[F2, G2]) {.tags:[Vartime].} =
+  ## Compute the operands of the KZG verification pairings
+  ##   [τ]₂ - [opening_challenge]₂
+  ##   [commitment]₁ - [eval_at_challenge]₁
   #
   # Scalar inputs
   #   opening_challenge
@@ -255,16 +275,11 @@ func kzg_verify*[F2; Name: static Algebra](
   # Finally
   #   e([proof]₁, [τ]₂ - [opening_challenge]₂) . e([commitment]₁ - [eval_at_challenge]₁, [-1]₂) = 1
   var
-    tau_minus_challenge_G2 {.noInit.}: EC_ShortW_Jac[F2, G2]
-    commitment_minus_eval_at_challenge_G1 {.noInit.}: EC_ShortW_Jac[Fp[Name], G1]
-    negG2 {.noInit.}: EC_ShortW_Aff[F2, G2]
-
     tauG2Jac {.noInit.}: EC_ShortW_Jac[F2, G2]
     commitmentJac {.noInit.}: EC_ShortW_Jac[Fp[Name], G1]
 
   tau_minus_challenge_G2.setGenerator()
   commitment_minus_eval_at_challenge_G1.setGenerator()
-  negG2.neg(Name.getGenerator("G2"))
   tauG2Jac.fromAffine(tauG2)
   commitmentJac.fromAffine(commitment)
 
@@ -274,19 +289,87 @@ func kzg_verify*[F2; Name: static Algebra](
   commitment_minus_eval_at_challenge_G1.scalarMul_vartime(eval_at_challenge)
   commitment_minus_eval_at_challenge_G1.diff(commitmentJac, commitment_minus_eval_at_challenge_G1)
 
+func kzg_verify*[F2; Name: static Algebra](
+       commitment: EC_ShortW_Aff[Fp[Name], G1],
+       opening_challenge: BigInt, # Fr[Name].getBigInt(),
+       eval_at_challenge: BigInt, # Fr[Name].getBigInt(),
+       proof: EC_ShortW_Aff[Fp[Name], G1],
+       tauG2: EC_ShortW_Aff[F2, G2]): bool {.tags:[Alloca, Vartime].} =
+  ## Verify a short KZG proof that ``p(opening_challenge) = eval_at_challenge``
+  ## without doing the whole p(opening_challenge) computation
+  var
+    tau_minus_challenge_G2 {.noInit.}: EC_ShortW_Jac[F2, G2]
+    commitment_minus_eval_at_challenge_G1 {.noInit.}: EC_ShortW_Jac[Fp[Name], G1]
+    negG2 {.noInit.}: EC_ShortW_Aff[F2, G2]
+
+  kzg_verify_operands(
+    tau_minus_challenge_G2, commitment_minus_eval_at_challenge_G1,
+    commitment, opening_challenge, eval_at_challenge, tauG2)
+  negG2.neg(Name.getGenerator("G2"))
+
   # e([proof]₁, [τ]₂ - [opening_challenge]₂) * e([commitment]₁ - [eval_at_challenge]₁, [-1]₂)
   return pairing_check(
     proof, tau_minus_challenge_G2,
     commitment_minus_eval_at_challenge_G1, negG2)
 
-func kzg_verify_batch*[bits: static int, F2; Name: static Algebra](
+func kzg_verify*[Name: static Algebra](
+       commitment: EC_ShortW_Aff[Fp[Name], G1],
+       opening_challenge: BigInt, # Fr[Name].getBigInt(),
+       eval_at_challenge: BigInt, # Fr[Name].getBigInt(),
+       proof: EC_ShortW_Aff[Fp[Name], G1],
+       g2: KZGPreparedG2[Name]): bool {.tags:[Alloca, Vartime].} =
+  ## Verify a short KZG proof that ``p(opening_challenge) = eval_at_challenge``
+  ## without doing the whole p(opening_challenge) computation
+  ##
+  ## The Miller loop lines of [-1]₂ are precomputed in `g2`.
+  var
+    tau_minus_challenge_G2 {.noInit.}: EC_ShortW_Jac[Fp2[Name], G2]
+    commitment_minus_eval_at_challenge_G1 {.noInit.}: EC_ShortW_Jac[Fp[Name], G1]
+    Q0 {.noInit.}: EC_ShortW_Aff[Fp2[Name], G2]
+    P1 {.noInit.}: EC_ShortW_Aff[Fp[Name], G1]
+
+  kzg_verify_operands(
+    tau_minus_challenge_G2, commitment_minus_eval_at_challenge_G1,
+    commitment, opening_challenge, eval_at_challenge, g2.tauG2)
+  Q0.affine(tau_minus_challenge_G2)
+  P1.affine(commitment_minus_eval_at_challenge_G1)
+
+  # e([proof]₁, [τ]₂ - [opening_challenge]₂) * e([commitment]₁ - [eval_at_challenge]₁, [-1]₂)
+  return pairing_check(proof, Q0, P1, g2.preparedNegG2)
+
+func kzg_batch_pairing_check[F2; Name: static Algebra](
+       sum_rand_proofs, sum_of_sums: EC_ShortW_Jac[Fp[Name], G1],
+       tauG2: EC_ShortW_Aff[F2, G2]): bool =
+  ## e(∑ [rᵢ][proofᵢ]₁, [τ]₂) . e(∑[rᵢ]([commitmentᵢ]₁ - [eval_at_challengeᵢ]₁) + ∑[rᵢ][zᵢ][proofᵢ]₁, [-1]₂) = 1
+  var negG2 {.noInit.}: EC_ShortW_Aff[F2, G2]
+  negG2.neg(Name.getGenerator("G2"))
+
+  return pairing_check(
+    sum_rand_proofs, tauG2,
+    sum_of_sums, negG2
+  )
+
+func kzg_batch_pairing_check[Name: static Algebra](
+       sum_rand_proofs, sum_of_sums: EC_ShortW_Jac[Fp[Name], G1],
+       g2: KZGPreparedG2[Name]): bool =
+  ## e(∑ [rᵢ][proofᵢ]₁, [τ]₂) . e(∑[rᵢ]([commitmentᵢ]₁ - [eval_at_challengeᵢ]₁) + ∑[rᵢ][zᵢ][proofᵢ]₁, [-1]₂) = 1
+  ## with [τ]₂ and [-1]₂ prepared
+  var Ps {.noInit.}: array[2, EC_ShortW_Aff[Fp[Name], G1]]
+  Ps.batchAffine([sum_rand_proofs, sum_of_sums])
+
+  return pairing_check(
+    Ps[0], g2.preparedTauG2,
+    Ps[1], g2.preparedNegG2
+  )
+
+func kzg_verify_batch*[bits: static int, VerifierG2; Name: static Algebra](
        commitments: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
        challenges: ptr UncheckedArray[Fr[Name]],
        evals_at_challenges: ptr UncheckedArray[BigInt[bits]],
        proofs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
        linearIndepRandNumbers: ptr UncheckedArray[Fr[Name]],
        n: int,
-       tauG2: EC_ShortW_Aff[F2, G2]): bool {.tags:[HeapAlloc, Alloca, Vartime].} =
+       tauG2: VerifierG2): bool {.tags:[HeapAlloc, Alloca, Vartime].} =
   ## Verify multiple KZG proofs efficiently
   ##
   ## Parameters
@@ -306,6 +389,8 @@ func kzg_verify_batch*[bits: static int, F2; Name: static Algebra](
   ## - `linearIndepRandNumbers`: `n` linearly independant numbers that are not in control
   ##                               of a prover (potentially malicious).
   ## - `n`: the number of verification sets
+  ## - `tauG2`: [τ]₂ from the trusted setup
+  ##            or a `KZGPreparedG2` with precomputed Miller loop lines
   ##
   ## For all (commitmentᵢ, challengeᵢ, eval_at_challengeᵢ, proofᵢ),
   ## we verify the relation
@@ -380,10 +465,4 @@ func kzg_verify_batch*[bits: static int, F2; Name: static Algebra](
 
   sum_of_sums.sum_vartime(sum_commit_minus_evals_G1, sum_rand_challenge_proofs)
 
-  var negG2 {.noInit.}: EC_ShortW_Aff[F2, G2]
-  negG2.neg(Name.getGenerator("G2"))
-
-  return pairing_check(
-    sum_rand_proofs, tauG2,
-    sum_of_sums, negG2
-  )
+  return kzg_batch_pairing_check(sum_rand_proofs, sum_of_sums, tauG2)
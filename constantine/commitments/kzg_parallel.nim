@@ -77,7 +77,7 @@ proc kzg_prove_parallel*[N: static int, Name: static Algebra; Ord: static PolyOr
 
   freeHeapAligned(quotientPoly)
 
-proc kzg_verify_batch_parallel*[bits: static int, F2; Name: static Algebra](
+proc kzg_verify_batch_parallel*[bits: static int, VerifierG2; Name: static Algebra](
        tp: Threadpool,
        commitments: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
        opening_challenges: ptr UncheckedArray[Fr[Name]],
@@ -85,7 +85,7 @@ proc kzg_verify_batch_parallel*[bits: static int, F2; Name: static Algebra](
        proofs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
        linearIndepRandNumbers: ptr UncheckedArray[Fr[Name]],
        n: int,
-       tauG2: EC_ShortW_Aff[F2, G2]): bool =
+       tauG2: VerifierG2): bool =
   ## Verify multiple KZG proofs efficiently
   ##
   ## Parameters
@@ -105,6 +105,8 @@ proc kzg_verify_batch_parallel*[bits: static int, F2; Name: static Algebra](
   ## - `linearIndepRandNumbers`: `n` linearly independant numbers that are not in control
   ##                               of a prover (potentially malicious).
   ## - `n`: the number of verification sets
+  ## - `tauG2`: [τ]₂ from the trusted setup
+  ##            or a `KZGPreparedG2` with precomputed Miller loop lines
   ##
   ## For all (commitmentᵢ, challengeᵢ, eval_at_challengeᵢ, proofᵢ),
   ## we verify the relation
@@ -220,10 +222,4 @@ proc kzg_verify_batch_parallel*[bits: static int, F2; Name: static Algebra](
   discard sync sum_rand_proofs_fv
   freeHeapAligned(coefs)
 
-  var negG2 {.noInit.}: EC_ShortW_Aff[F2, G2]
-  negG2.neg(Name.getGenerator("G2"))
-
-  return pairing_check(
-    sum_rand_proofs, tauG2,
-    sum_of_sums, negG2
-  )
+  return kzg_batch_pairing_check(sum_rand_proofs, sum_of_sums, tauG2)
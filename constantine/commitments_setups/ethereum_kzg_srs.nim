@@ -14,7 +14,7 @@ import
   constantine/math/io/io_fields,
   constantine/platforms/[allocs, bithacks, fileio, views, abstractions],
   constantine/serialization/[codecs, codecs_status_codes, codecs_bls12_381],
-  constantine/commitments/kzg_multiproofs
+  constantine/commitments/[kzg, kzg_multiproofs]
 
 # Ensure all exceptions are converted to error codes
 {.push raises: [], checks: off.}
@@ -204,6 +204,10 @@ type
     # For most schemes (Marlin, Plonk, Sonic, Ethereum's Deneb), only [τ]H is needed
     # but Ethereum's sharding will need 64 (65 with the generator H)
 
+    g2_prepared*{.align: 64.}: KZGPreparedG2[BLS12_381]
+    # [τ]H and -H with their Miller loop lines precomputed
+    # for EIP-4844 proof verification.
+
     domain_brp*{.align: 64.}: PolyEvalRootsDomain[FIELD_ELEMENTS_PER_BLOB, Fr[BLS12_381], kBitReversed]
     # The domain field holds the roots of unity of the polynomial evaluation domain.
     # Important: for Ethereum, roots of unity are used in bit-reversed order
@@ -300,7 +304,9 @@ proc load_ckzg4844(ctx: ptr EthereumKZGContext, f: File): TrustedSetupStatus =
     # Original ceremony files:
     # - https://github.com/ethereum/kzg-ceremony-verifier/blob/master/output_setups/trusted_setup_4096.json
     # - https://github.com/ethereum/c-kzg-4844/blob/v2.1.7/src/trusted_setup.txt
-    # On disk, G1 points are stored in natural order and will need bit-reversal
+    # On disk, G1 points are stored in natural order,
+    # they are deserialized directly at their bit-reversed position.
+    const logBlobSize = log2_vartime(uint32 FIELD_ELEMENTS_PER_BLOB)
     var bufG1Hex {.noInit.}: array[2*g1Bytes+1, char] # On MacOS, an extra byte seems to be needed for fscanf or AddressSanitizer complains
     var bufG1bytes {.noInit.}: array[g1Bytes, byte]
     var charsRead: cint
@@ -309,7 +315,8 @@ proc load_ckzg4844(ctx: ptr EthereumKZGContext, f: File): TrustedSetupStatus =
       if num_matches != 1 or charsRead != 2*g1Bytes:
         return tsInvalidFile
       bufG1bytes.fromHex(bufG1Hex.toOpenArray(0, 2*g1Bytes-1))
-      let status = ctx.srs_lagrange_brp_g1.evals[i].deserialize_g1_compressed(bufG1bytes)
+      let iRev = int reverseBits(uint32 i, logBlobSize)
+      let status = ctx.srs_lagrange_brp_g1.evals[iRev].deserialize_g1_compressed(bufG1bytes)
       if status != cttCodecEcc_Success:
         c_printf("[Constantine Trusted Setup] Invalid G1 point on line %d: CttCodecEccStatus code %d\n", cint(2+i), status)
         return tsInvalidFile
@@ -380,8 +387,8 @@ proc setupKzg4844ProtoDanksharding(ctx: ptr EthereumKZGContext) =
   block:
     # Powers of tau: [G, [τ]G, [τ²]G, ... [τ⁴⁰⁹⁶]G]
 
-    # Bit-reverse the Lagrange form points (for EIP-4844 commitments)
-    ctx.srs_lagrange_brp_g1.evals.bit_reversal_permutation()
+    # The Lagrange form points (for EIP-4844 commitments)
+    # are bit-reversed while loading the trusted setup file.
 
     # G1 Monomial points are already loaded from the trusted setup file
 
@@ -393,6 +400,10 @@ proc setupKzg4844ProtoDanksharding(ctx: ptr EthereumKZGContext) =
     ctx.domain_brp.invMaxDegree.fromUint(ctx.domain_brp.rootsOfUnity.len.uint64)
     ctx.domain_brp.invMaxDegree.inv_vartime()
 
+  block:
+    # Precompute the Miller loop lines of the verifier 𝔾2 points
+    ctx.g2_prepared.init(tauG2 = ctx.srs_monomial_g2.coefs[1])
+
 proc setupKzg7594PeerDAS(ctx: ptr EthereumKZGContext, t, b: int) =
   # Initialize FFT descriptors
   ctx.ecfft_desc_ext = ECFFT_Descriptor[EC_ShortW_Jac[Fp[BLS12_381], G1]].new(
@@ -406,6 +417,19 @@ proc setupKzg7594PeerDAS(ctx: ptr EthereumKZGContext, t, b: int) =
     generatorRootOfUnity = getRootOfUnityForSize(FIELD_ELEMENTS_PER_EXT_BLOB)
   )
 
+  # Cache the fused coset FFT twiddles
+  # - compute_cells evaluates the second half of the extended blob
+  #   over the coset of shift ω₈₁₉₂
+  # - cell recovery evaluates over the coset of shift 5 (same as c-kzg-4844)
+  ctx.fft_desc_ext.precomputeCosetTwiddles(
+    cosetShift = ctx.fft_desc_ext.rootsOfUnity[1],
+    size = FIELD_ELEMENTS_PER_BLOB
+  )
+  ctx.fft_desc_ext.precomputeCosetTwiddles(
+    cosetShift = Fr[BLS12_381].fromUint(5'u32),
+    size = FIELD_ELEMENTS_PER_EXT_BLOB
+  )
+
   ctx.setupPolyphaseSpectrumBank(t, b)
 
 proc load_from_file(ctx: var ptr EthereumKZGContext, filepath: cstring, format: TrustedSetupFormat, t = 64, b = 12): TrustedSetupStatus =
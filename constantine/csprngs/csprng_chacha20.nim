@@ -0,0 +1,176 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/abstractions,
+  constantine/ciphers/chacha20,
+  ./sysrand
+
+# ############################################################
+#
+#                    Userspace ChaCha20
+#   Cryptographically Secure Pseudo-Random Number Generator
+#
+# ############################################################
+
+# References:
+# - Daniel J. Bernstein, 2017
+#   Fast-key-erasure random-number generators
+#   https://blog.cr.yp.to/20170723-random.html
+#
+# Batch verification (BLS signatures, KZG proofs, PeerDAS cells)
+# needs hundreds to thousands of random blinding scalars per call.
+# A syscall per scalar is costly, instead the OS CSPRNG
+# is used once to seed a ChaCha20 keystream.
+#
+# Fast key erasure:
+#   Each refill generates 16 blocks of keystream with the current key,
+#   nonce 0 and counters 0..15.
+#   The first 32 bytes immediately replace the key and are wiped
+#   and the following 992 bytes are served as random output,
+#   wiped from the buffer as soon as they are consumed.
+#   A compromise of the generator state does not reveal past outputs.
+#
+# Large requests bypass the buffer: a fresh key is taken from block 0
+# and blocks 1 and onward are written directly to the destination
+# with the multi-block SIMD keystream.
+#
+# The generator is not thread-safe, each thread should use its own state,
+# for example obtained with `fork`.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+const
+  ChaCha20Csprng_BufSize = 16 * 64
+  ChaCha20Csprng_BulkThreshold = ChaCha20Csprng_BufSize
+  ChaCha20Csprng_MaxBulk = 1 shl 30
+    ## A key is used for at most 1GiB of bulk output,
+    ## far below the 2³² blocks (256GiB) limit of the 32-bit block counter.
+  ZeroNonce = default(array[12, byte])
+
+type
+  ChaCha20Csprng* = object
+    ## ChaCha20-based userspace CSPRNG with fast key erasure
+    buf{.align: 64.}: array[ChaCha20Csprng_BufSize, byte]
+    key: array[32, byte]
+    pos: int
+
+# Internals
+# ------------------------------------------------
+
+func refill(rng: var ChaCha20Csprng) =
+  ## Generate a new buffer of keystream and rekey
+  discard chacha20_keystream(rng.key, counter = 0, ZeroNonce, rng.buf)
+  for i in 0 ..< rng.key.len:
+    rng.key[i] = rng.buf[i]
+  rng.buf.toOpenArray(0, rng.key.len-1).setZero()
+  rng.pos = rng.key.len
+
+func fillBytes(rng: var ChaCha20Csprng, dst: ptr UncheckedArray[byte], len: int) =
+  var cur = 0
+
+  # 1. Serve buffered bytes, erasing them on the way
+  let buffered = min(len, ChaCha20Csprng_BufSize - rng.pos)
+  for i in 0 ..< buffered:
+    dst[i] = rng.buf[rng.pos+i]
+    rng.buf[rng.pos+i] = byte 0
+  rng.pos += buffered
+  cur += buffered
+
+  # 2. Large requests, write the keystream directly to the destination
+  while len - cur >= ChaCha20Csprng_BulkThreshold:
+    let chunk = min(len - cur, ChaCha20Csprng_MaxBulk)
+    var nextKey{.noInit.}: array[32, byte]
+    discard chacha20_keystream(rng.key, counter = 0, ZeroNonce, nextKey)
+    discard chacha20_keystream(rng.key, counter = 1, ZeroNonce, dst +% cur, chunk)
+    rng.key = nextKey
+    nextKey.setZero()
+    cur += chunk
+
+  # 3. Remainder
+  while cur < len:
+    rng.refill()
+    let n = min(len - cur, ChaCha20Csprng_BufSize - rng.pos)
+    for i in 0 ..< n:
+      dst[cur+i] = rng.buf[rng.pos+i]
+      rng.buf[rng.pos+i] = byte 0
+    rng.pos += n
+    cur += n
+
+# Seeding
+# ------------------------------------------------
+
+func seed*(rng: var ChaCha20Csprng, seed: array[32, byte]) =
+  ## Deterministically seed the generator.
+  ##
+  ## Security note: `seed` MUST have 256-bit of entropy
+  ## and MUST NOT be reused.
+  ## This is intended for derived generators and reproducible tests,
+  ## use `init` to seed from the operating system.
+  rng.key = seed
+  rng.buf.setZero()
+  rng.pos = ChaCha20Csprng_BufSize
+
+proc init*(rng: var ChaCha20Csprng): bool =
+  ## Seed the generator from the operating system CSPRNG
+  ## Returns true on success, false otherwise
+  var entropy{.noInit.}: array[32, byte]
+  if not sysrand(entropy):
+    return false
+  rng.seed(entropy)
+  entropy.setZero()
+  return true
+
+proc reseed*(rng: var ChaCha20Csprng): bool =
+  ## Mix fresh entropy from the operating system CSPRNG into the generator.
+  ## Buffered output is discarded.
+  ## Returns true on success, false otherwise
+  var entropy{.noInit.}: array[32, byte]
+  if not sysrand(entropy):
+    return false
+  for i in 0 ..< rng.key.len:
+    rng.key[i] = rng.key[i] xor entropy[i]
+  entropy.setZero()
+  rng.buf.setZero()
+  rng.pos = ChaCha20Csprng_BufSize
+  return true
+
+func fork*(rng: var ChaCha20Csprng, children: var openArray[ChaCha20Csprng]) =
+  ## Derive independent generators, for example one per threadpool worker,
+  ## each seeded with 32 bytes from `rng`.
+  for i in 0 ..< children.len:
+    var childSeed{.noInit.}: array[32, byte]
+    rng.fillBytes(childSeed.asUnchecked(), childSeed.len)
+    children[i].seed(childSeed)
+    childSeed.setZero()
+
+func clear*(rng: var ChaCha20Csprng) =
+  ## Erase the generator state
+  rng.key.setZero()
+  rng.buf.setZero()
+  rng.pos = ChaCha20Csprng_BufSize
+
+# Generation
+# ------------------------------------------------
+
+func fill*[T](rng: var ChaCha20Csprng, dst: var openArray[T]) =
+  ## Fill `dst` with random bytes.
+  ## `T` must be a plain-old-data type, for example
+  ## bytes, machine words, BigInt or arrays thereof.
+  ##
+  ## Large buffers are filled at the speed of the SIMD ChaCha20 keystream.
+  static: doAssert supportsCopyMem(T), "Only plain-old-data types can be filled with random bytes"
+  if dst.len == 0:
+    return
+  rng.fillBytes(cast[ptr UncheckedArray[byte]](dst[0].addr), dst.len * sizeof(T))
+
+func next*(rng: var ChaCha20Csprng, T: typedesc[SomeUnsignedInt]): T =
+  ## Returns a random unsigned integer
+  rng.fillBytes(cast[ptr UncheckedArray[byte]](result.addr), sizeof(T))
@@ -0,0 +1,75 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+when not compileOption("threads"):
+  {.error: "This requires --threads:on compilation flag".}
+
+# Reexport the serial API
+import ./csprng_chacha20
+export csprng_chacha20
+
+import
+  constantine/platforms/abstractions,
+  constantine/ciphers/chacha20,
+  constantine/threadpool/[threadpool, partitioners]
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# ############################################################
+#
+#                    Userspace ChaCha20
+#   Cryptographically Secure Pseudo-Random Number Generator
+#                    Parallel Edition
+#
+# ############################################################
+
+const
+  ParallelFillThreshold = 64 * 1024
+    ## Below 64KiB the keystream is faster than scheduling tasks
+  MaxChunkSize = 1 shl 30
+    ## A key is used for at most 1GiB of output,
+    ## far below the 2³² blocks (256GiB) limit of the 32-bit block counter.
+
+proc fill_parallel*[T](tp: Threadpool, rng: var ChaCha20Csprng, dst: var openArray[T]) =
+  ## Fill `dst` with random bytes.
+  ## `T` must be a plain-old-data type, for example
+  ## bytes, machine words, BigInt or arrays thereof.
+  ##
+  ## The destination is split into one chunk per thread,
+  ## each chunk is filled with the keystream of an independent key drawn from `rng`.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  static: doAssert supportsCopyMem(T), "Only plain-old-data types can be filled with random bytes"
+  let len = dst.len * sizeof(T)
+  if len < ParallelFillThreshold:
+    rng.fill(dst)
+    return
+
+  let p = cast[ptr UncheckedArray[byte]](dst[0].addr)
+  let chunkDesc = balancedChunksPrioNumber(
+    start = 0, stopEx = len,
+    numChunks = max(tp.numThreads.int, (len + MaxChunkSize - 1) div MaxChunkSize))
+
+  # The chunk keys live on the heap until the tasks consume them,
+  # each task wipes its own key once its keystream is generated.
+  let chunkKeys = allocHeapArray(array[32, byte], chunkDesc.numChunks)
+
+  syncScope:
+    for iter in items(chunkDesc):
+      proc keystream_wrapper(chunk: ptr UncheckedArray[byte], chunkLen: int, chunkKey: ptr array[32, byte]) {.nimcall.} =
+        # The borrow checker prevents capturing `var` and `openArray`
+        # so we capture pointers instead.
+        discard chacha20_keystream(chunkKey[], counter = 0, default(array[12, byte]), chunk, chunkLen)
+        chunkKey[].setZero()
+
+      rng.fill(chunkKeys[iter.chunkID])
+      tp.spawn keystream_wrapper(p +% iter.start, iter.size, chunkKeys[iter.chunkID].addr)
+
+  freeHeap(chunkKeys)
@@ -11,8 +11,7 @@ import
   constantine/named/[algebras],
   constantine/math/[arithmetic, ec_shortweierstrass],
   constantine/math/polynomials/[polynomials, fft_fields],
-  constantine/platforms/allocs,
-  constantine/platforms/views
+  constantine/platforms/[abstractions, allocs, views]
 
 ## ############################################################
 ##
@@ -175,10 +174,15 @@ func recoverPolynomialCoeff*[N, N2, L, CDS: static int](
 
   fillMissingCellIndices[CDS](missing_cell_indices.toOpenArray(missing_cell_count), missing_cells)
 
-  # Build vanishing polynomial directly into zero_poly_coeff using strided view
-  let zero_poly_coeff = alloc0HeapArrayAligned(Fr[BLS12_381], ext_size, alignment = 64)
-  defer: freeHeapAligned(zero_poly_coeff)
+  # (E*Z)(x) and Z(x) are evaluated over the same coset in Step 5,
+  # they are stored as the 2 rows of a single batch: [ (E*Z)(x) | Z(x) ]
+  let coset_evals = alloc0HeapArrayAligned(Fr[BLS12_381], 2*ext_size, alignment = 64)
+  defer: freeHeapAligned(coset_evals)
+
+  let extended_times_zero = coset_evals
+  let zero_poly_coeff = coset_evals +% ext_size
 
+  # Build vanishing polynomial directly into zero_poly_coeff using strided view
   var vanishing_poly_view = zero_poly_coeff.toStridedView(missing_cell_count + 1).slice(0, missing_cell_count * L, L)
   buildVanishingPolynomial[L, CDS](vanishing_poly_view, missing_cell_indices.toOpenArray(missing_cell_count), fft_desc, ext_size, CDS)
 
@@ -189,9 +193,6 @@ func recoverPolynomialCoeff*[N, N2, L, CDS: static int](
   check fft_desc.fft_nr(zero_poly_eval_fft.toOpenArray(ext_size), zero_poly_coeff.toOpenArray(ext_size))
 
   # Step 3: Compute (E*Z)(x) in evaluation form
-  let extended_times_zero = allocHeapArrayAligned(Fr[BLS12_381], ext_size, alignment = 64)
-  defer: freeHeapAligned(extended_times_zero)
-
   for i in 0 ..< ext_size:
     extended_times_zero[i].prod(extended_evaluation_brp[i], zero_poly_eval_fft[i])
 
@@ -203,15 +204,11 @@ func recoverPolynomialCoeff*[N, N2, L, CDS: static int](
   # Coset shift = 5 (same as c-kzg-4844)
   let cosetShift {.noInit.} = Fr[BLS12_381].fromUint(5'u32)
 
-  let ext_eval_over_coset = allocHeapArrayAligned(Fr[BLS12_381], ext_size, alignment = 64)
-  defer: freeHeapAligned(ext_eval_over_coset)
-
-  check fft_desc.coset_fft_nr(ext_eval_over_coset.toOpenArray(ext_size), extended_times_zero.toOpenArray(ext_size), cosetShift)
-
-  let zero_poly_over_coset = allocHeapArrayAligned(Fr[BLS12_381], ext_size, alignment = 64)
-  defer: freeHeapAligned(zero_poly_over_coset)
+  # Both rows are transformed in-place as a batch, with the cached shift-5 twiddles
+  check fft_desc.coset_fft_nr_batch(coset_evals.toOpenArray(2*ext_size), coset_evals.toOpenArray(2*ext_size), batchSize = 2, cosetShift)
 
-  check fft_desc.coset_fft_nr(zero_poly_over_coset.toOpenArray(ext_size), zero_poly_coeff.toOpenArray(ext_size), cosetShift)
+  let ext_eval_over_coset = extended_times_zero
+  let zero_poly_over_coset = zero_poly_coeff
 
   # Step 6: Pointwise divide P_eval = (E*Z)_coset / Z_coset
   let reconstructed_over_coset = allocHeapArrayAligned(Fr[BLS12_381], ext_size, alignment = 64)
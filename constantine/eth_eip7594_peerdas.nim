@@ -185,15 +185,14 @@ func compute_cells_impl(
   # Step 2: Second 64 cells - shift + FFT (no IFFT needed!)
   # ============================================================
 
-  # Shift coefficients by w_8192^k
+  # Coset FFT with shift w_8192 of the coefficients
   # w_8192 = primitive 8192nd root of unity (coset shift factor)
-  var poly_coef_shifted = poly_coef_nat
+  # The shift is fused in the FFT, the twiddles are cached in the context.
   let w_8192 = ctx.fft_desc_ext.rootsOfUnity[1]
-  poly_coef_shifted.coefs.shift_vals(poly_coef_shifted.coefs, w_8192)
 
-  # FFT of shifted coefficients -> evaluations directly into cells 64-127
+  # Evaluations directly into cells 64-127
   let pHalfCells = cells_evals[HALF_CDS].asUnchecked()
-  let fft_status = ctx.fft_desc_ext.fft_nr(pHalfCells.toOpenArray(N), poly_coef_shifted.coefs)
+  let fft_status = ctx.fft_desc_ext.coset_fft_nr(pHalfCells.toOpenArray(N), poly_coef_nat.coefs, w_8192)
   doAssert fft_status == FFT_Success
 
   # ============================================================
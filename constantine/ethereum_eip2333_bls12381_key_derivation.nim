@@ -82,7 +82,7 @@ iterator ikm_to_lamport_SK(
            ikm: array[32, byte], salt: array[4, byte]): int =
   ## Generate a Lamport secret key
   ## This uses an iterator to stream HKDF
-  ## instead of allocating 255*32 bytes ~= 8KB
+  ## 32-byte chunk by 32-byte chunk.
   var ctx{.noInit.}: HKDF[sha256]
   var prk{.noInit.}: array[32, byte]
 
@@ -98,6 +98,33 @@ iterator ikm_to_lamport_SK(
 
   ctx.clear()
 
+func lamport_PK_append(
+       ctx: var sha256,
+       lamport: var array[255, array[32, byte]],
+       ikm: array[32, byte], salt: array[4, byte]) =
+  ## lamport_PK = lamport_PK | SHA256(lamport_SK[i]) for i in [0, 255)
+  ## with lamport_SK = IKM_to_lamport_SK(IKM, salt)
+  ##
+  ## `lamport` is a scratch buffer, it holds lamport_SK
+  ## which is then hashed in-place into lamport_PK chunks.
+  var chunk{.noInit.}: array[32, byte]
+  for i in ikm_to_lamport_SK(chunk, ikm, salt):
+    lamport[i] = chunk
+  chunk.setZero()
+
+  # The 255 chunks are independent 32-byte messages,
+  # they are hashed through the multi-buffer SHA256 kernels.
+  # Digests overwrite their own message only
+  # and messages are fully read before digests are written,
+  # so the secret key chunks can be hashed in-place.
+  sha256.hashMany(
+    lamport.asUnchecked(),
+    cast[ptr UncheckedArray[byte]](lamport.addr),
+    msgLen = sizeof(lamport[0]),
+    numMessages = lamport.len)
+
+  ctx.update(cast[ptr array[sizeof(lamport), byte]](lamport.addr)[])
+
 func parent_SK_to_lamport_PK(
        lamportPublicKey: var array[32, byte],
        parentSecretKey: SecretKey,
@@ -112,24 +139,20 @@ func parent_SK_to_lamport_PK(
   var ikm {.noinit.}: array[32, byte]
   ikm.marshal(parentSecretKey, bigEndian)
 
-  # Reorganized the spec to save on stack allocations
-  # by reusing buffers and using streaming HKDF
+  # Reorganized the spec to hash each half with the multi-buffer SHA256:
+  # a single 255*32 bytes ~= 8KB buffer is reused for
+  # lamport_0, lamport_1 and their hashes.
 
   # 5. lamport_PK = ""
   var ctx{.noInit.}: sha256
   ctx.init()
 
-  var tmp{.noInit.}, chunk{.noInit.}: array[32, byte]
+  var lamport{.noInit.}: array[255, array[32, byte]]
 
   # 2. lamport_0 = IKM_to_lamport_SK(IKM, salt)
   # 6. for i = 1, .., 255 (inclusive)
   #        lamport_PK = lamport_PK | SHA256(lamport_0[i])
-  for i in ikm_to_lamport_SK(chunk, ikm, salt):
-    sha256.hash(tmp, chunk)
-    ctx.update(tmp)
-    if i == 254:
-      # We iterate from 0
-      break
+  ctx.lamport_PK_append(lamport, ikm, salt)
 
   # 3. not_IKM = flip_bits(parent_SK)
   for i in 0 ..< 32:
@@ -138,12 +161,8 @@ func parent_SK_to_lamport_PK(
   # 4. lamport_1 = IKM_to_lamport_SK(not_IKM, salt)
   # 7. for i = 1, .., 255 (inclusive)
   #        lamport_PK = lamport_PK | SHA256(lamport_1[i])
-  for i in ikm_to_lamport_SK(chunk, ikm, salt):
-    sha256.hash(tmp, chunk)
-    ctx.update(tmp)
-    if i == 254:
-      # We iterate from 0
-      break
+  ctx.lamport_PK_append(lamport, ikm, salt)
+  ikm.setZero()
 
   # 8. compressed_lamport_PK = SHA256(lamport_PK)
   # 9. return compressed_lamport_PK
@@ -164,6 +183,26 @@ func derive_child_secretKey*(
   compressed_lamport_PK.setZero()
   return true
 
+func derive_child_secretKeys*(
+        childSecretKeys: var openArray[SecretKey],
+        parentSecretKey: SecretKey,
+        indices: openArray[uint32]): bool =
+  ## EIP2333 Child Key derivation function
+  ## for several children of the same parent
+  ##
+  ## childSecretKeys[i] is the child of index indices[i]
+  ##
+  ## This is a convenience loop over `derive_child_secretKey`,
+  ## there is no batching across children,
+  ## the multi-buffer hashing happens within each derivation.
+  ##
+  ## Returns false if `childSecretKeys` and `indices` have different lengths.
+  if childSecretKeys.len != indices.len:
+    return false
+  for i in 0 ..< indices.len:
+    discard childSecretKeys[i].derive_child_secretKey(parentSecretKey, indices[i])
+  return true
+
 func derive_master_secretKey*(
         masterSecretKey: var SecretKey,
         ikm: openArray[byte]): bool =
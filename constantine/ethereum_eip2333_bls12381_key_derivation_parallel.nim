@@ -0,0 +1,58 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+## ############################################################
+##
+##              EIP2333: BLS12-381 Key Generation
+##                     Parallel edition
+##
+## ############################################################
+
+when not compileOption("threads"):
+  {.error: "This requires --threads:on compilation flag".}
+
+# Reexport the serial API
+import ./ethereum_eip2333_bls12381_key_derivation
+export ethereum_eip2333_bls12381_key_derivation
+
+import
+  constantine/named/algebras,
+  ./platforms/primitives,
+  ./threadpool/threadpool
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+type SecretKey = Fr[BLS12_381].getBigInt()
+
+proc derive_child_secretKeys_parallel*(
+        tp: Threadpool,
+        childSecretKeys: var openArray[SecretKey],
+        parentSecretKey: SecretKey,
+        indices: openArray[uint32]): bool =
+  ## EIP2333 Child Key derivation function
+  ## for several children of the same parent
+  ##
+  ## childSecretKeys[i] is the child of index indices[i]
+  ## Returns false if `childSecretKeys` and `indices` have different lengths.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  if childSecretKeys.len != indices.len:
+    return false
+
+  let children = childSecretKeys.asUnchecked()
+  let parent = parentSecretKey.unsafeAddr
+  let idx = indices.asUnchecked()
+
+  syncScope:
+    tp.parallelFor i in 0 ..< indices.len:
+      captures: {children, parent, idx}
+      discard children[i].derive_child_secretKey(parent[], idx[i])
+
+  return true
@@ -400,7 +400,7 @@ func verify_kzg_proof*(
   let verif = kzg_verify(EC_ShortW_Aff[Fp[BLS12_381], G1](commitment),
                          opening_challenge, eval_at_challenge,
                          EC_ShortW_Aff[Fp[BLS12_381], G1](proof),
-                         ctx.srs_monomial_g2.coefs[1])
+                         ctx.g2_prepared)
   if verif:
     return cttEthKzg_Success
   else:
@@ -475,7 +475,7 @@ func verify_blob_kzg_proof*(
     let verif = kzg_verify(EC_ShortW_Aff[Fp[BLS12_381], G1](commitment),
                           opening_challenge.toBig(), eval_at_challenge.toBig(),
                           EC_ShortW_Aff[Fp[BLS12_381], G1](proof),
-                          ctx.srs_monomial_g2.coefs[1])
+                          ctx.g2_prepared)
     if verif:
       result = cttEthKzg_Success
     else:
@@ -553,7 +553,7 @@ func verify_blob_kzg_proof_batch*(
                   cast[EcAffArray](proofs),
                   linearIndepRandNumbers,
                   n,
-                  ctx.srs_monomial_g2.coefs[1])
+                  ctx.g2_prepared)
     if verif:
       result =  cttEthKzg_Success
     else:
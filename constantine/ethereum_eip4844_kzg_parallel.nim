@@ -287,7 +287,7 @@ proc verify_blob_kzg_proof_parallel*(
     let verif = kzg_verify(EC_ShortW_Aff[Fp[BLS12_381], G1](commitment),
                           opening_challenge.toBig(), eval_at_challenge.toBig(),
                           EC_ShortW_Aff[Fp[BLS12_381], G1](proof),
-                          ctx.srs_monomial_g2.coefs[1])
+                          ctx.g2_prepared)
     if verif:
       result =  cttEthKzg_Success
     else:
@@ -405,7 +405,7 @@ proc verify_blob_kzg_proof_batch_parallel*(
                   cast[EcAffArray](proofs),
                   linearIndepRandNumbers,
                   n,
-                  ctx.srs_monomial_g2.coefs[1])
+                  ctx.g2_prepared)
     if verif:
       result =  cttEthKzg_Success
     else:
@@ -9,7 +9,7 @@
 import
   ./hashes,
   ./platforms/abstractions,
-  ./serialization/io_limbs,
+  ./serialization/[io_limbs, endians],
   constantine/named/algebras,
   ./math/[arithmetic, extension_fields],
   ./math/arithmetic/limbs_montgomery,
@@ -55,6 +55,7 @@ type
     cttEVM_PointNotInSubgroup
     cttEVM_VerificationFailure
     cttEVM_MalformedSignature
+    cttEVM_InvalidFinalFlag
 
 func eth_evm_sha256*(r: var openArray[byte], inputs: openArray[byte]): CttEVMStatus {.libPrefix: prefix_ffi, meter.} =
   ## SHA256
@@ -94,6 +95,59 @@ func eth_evm_ripemd160*(r: var openArray[byte], inputs: openArray[byte]): CttEVM
   ripemd160.hash(cast[ptr array[20, byte]](toOpenArray(r, 12, 31)[0].addr)[], inputs)
   return cttEVM_Success
 
+func eth_evm_blake2f*(r: var openArray[byte], inputs: openArray[byte]): CttEVMStatus {.libPrefix: prefix_ffi, meter.} =
+  ## BLAKE2b compression function F
+  ##
+  ## Name: BLAKE2F
+  ##
+  ## Inputs:
+  ## - rounds | h | m | t | f |
+  ## - The length MUST be 213 bytes with the following breakdown:
+  ##   - 4 bytes, the number of rounds, a 32-bit unsigned big-endian integer
+  ##   - 64 bytes, the state vector h, 8 64-bit unsigned little-endian integers
+  ##   - 128 bytes, the message block m, 16 64-bit unsigned little-endian integers
+  ##   - 16 bytes, the offset counter t, 2 64-bit unsigned little-endian integers
+  ##   - 1 byte, the final block indicator flag f, 0 or 1
+  ##
+  ## Output:
+  ## - 64-byte updated state vector h, 8 64-bit unsigned little-endian integers
+  ## - status code:
+  ##   cttEVM_Success
+  ##   cttEVM_InvalidInputSize
+  ##   cttEVM_InvalidOutputSize
+  ##   cttEVM_InvalidFinalFlag
+  ##
+  ## The number of rounds is chosen by the caller, gas cost is 1 per round.
+  ##
+  ## Spec https://eips.ethereum.org/EIPS/eip-152
+
+  if inputs.len != 213:
+    return cttEVM_InvalidInputSize
+  if r.len != 64:
+    return cttEVM_InvalidOutputSize
+
+  let f = inputs[212]
+  if f > 1:
+    return cttEVM_InvalidFinalFlag
+
+  let rounds = uint32.fromBytes(inputs, 0, bigEndian)
+
+  var h {.noInit.}: array[8, uint64]
+  var m {.noInit.}: array[16, uint64]
+  var t {.noInit.}: array[2, uint64]
+  for i in 0 ..< 8:
+    h[i] = uint64.fromBytes(inputs, 4 + i*sizeof(uint64), littleEndian)
+  for i in 0 ..< 16:
+    m[i] = uint64.fromBytes(inputs, 68 + i*sizeof(uint64), littleEndian)
+  for i in 0 ..< 2:
+    t[i] = uint64.fromBytes(inputs, 196 + i*sizeof(uint64), littleEndian)
+
+  blake2b.compress(h, m, t, lastBlock = f == 1, rounds = rounds)
+
+  for i in 0 ..< 8:
+    r.dumpRawInt(h[i], i*sizeof(uint64), littleEndian)
+  return cttEVM_Success
+
 func eth_evm_modexp_result_size*(size: var uint64, inputs: openArray[byte]): CttEVMStatus {.noInline, tags:[Alloca, Vartime], libPrefix: prefix_ffi, meter.} =
   ## Helper for `eth_evm_modexp`. Returns the size required to be allocated based on the
   ## given input. Call this function first, then allocate space for the result buffer
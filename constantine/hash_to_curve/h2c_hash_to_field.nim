@@ -46,6 +46,10 @@ func shortDomainSepTag*[DigestSize: static int](
   ## from a domain separation tag larger than 255 bytes
   ##
   ## https://tools.ietf.org/html/draft-irtf-cfrg-hash-to-curve-14#section-5.4.3
+  ##
+  ## For SHAKE128 and SHAKE256, the 32-byte output
+  ## is the ceil(2k/8) bytes required for k = 128.
+  ## Suites with a higher security level are rejected by `hashToField`.
   static: doAssert DigestSize == H.type.digestSize
   var ctx {.noInit.}: H
   ctx.init()
@@ -53,6 +57,29 @@ func shortDomainSepTag*[DigestSize: static int](
   ctx.update oversizedDST
   ctx.finish(output)
 
+func expandMessageXMD_b0[DigestSize: static int](
+       H: type CryptoHash,
+       b0: var array[DigestSize, byte],
+       len_in_bytes: int,
+       augmentation: openArray[byte],
+       message: openArray[byte],
+       domainSepTag: openArray[byte]) =
+  ## Compute b_0 = H(msg_prime) of expand_message_xmd
+  ## msg_prime = Z_pad || msg || l_i_b_str || I2OSP(0, 1) || DST_prime
+  var l_i_b_str0 {.noInit.}: array[3, byte]
+  l_i_b_str0.dumpRawInt(len_in_bytes.uint16, cursor = 0, bigEndian)
+  l_i_b_str0[2] = 0
+
+  var ctx {.noInit.}: H
+  ctx.initZeroPadded()
+  ctx.update augmentation
+  ctx.update message
+  ctx.update l_i_b_str0
+  # ctx.update [byte 0] # already appended to l_i_b_str
+  ctx.update domainSepTag
+  ctx.update [byte domainSepTag.len] # DST_prime
+  ctx.finish(b0)
+
 func expandMessageXMD*[len_in_bytes: static int](
        H: type CryptoHash,
        output: var array[len_in_bytes, byte],
@@ -109,23 +136,13 @@ func expandMessageXMD*[len_in_bytes: static int](
     doAssert output.len mod 32 == 0 # Assumed by copy optimization
 
   let ell = output.len.ceilDiv_vartime(DigestSize)
-  var l_i_b_str0 {.noInit.}: array[3, byte]
-  l_i_b_str0.dumpRawInt(output.len.uint16, cursor = 0, bigEndian)
-  l_i_b_str0[2] = 0
 
   var b0 {.noinit, align: DigestSize.}: array[DigestSize, byte]
-  var ctx {.noInit.}: Hash
-  ctx.initZeroPadded()
-  ctx.update augmentation
-  ctx.update message
-  ctx.update l_i_b_str0
-  # ctx.update [byte 0] # already appended to l_i_b_str
-  ctx.update domainSepTag
-  ctx.update [byte domainSepTag.len] # DST_prime
-  ctx.finish(b0)
+  H.expandMessageXMD_b0(b0, output.len, augmentation, message, domainSepTag)
 
   var cur = 0'u
   var bi {.noinit, align: DigestSize.}: array[DigestSize, byte]
+  var ctx {.noInit.}: Hash
   # b1
   ctx.init()
   ctx.update(b0)
@@ -147,6 +164,50 @@ func expandMessageXMD*[len_in_bytes: static int](
     if cur == output.len.uint:
       return
 
+func expandMessageXOF*[len_in_bytes: static int](
+       H: type (shake128 or shake256),
+       output: var array[len_in_bytes, byte],
+       augmentation: openArray[byte],
+       message: openArray[byte],
+       domainSepTag: openArray[byte]
+     ) {.genCharAPI.} =
+  ## The expand_message_xof function produces a uniformly random byte
+  ## string using an extendable-output function (XOF) H.
+  ##
+  ## https://www.rfc-editor.org/rfc/rfc9380#section-5.3.2
+  ##
+  ## Arguments:
+  ## - `Hash` an extendable-output function, SHAKE128 or SHAKE256.
+  ## - `output`, a buffer dimensioned the requested length.
+  ##   it will be filled with bits indifferentiable from a random oracle.
+  ## - `augmentation`, an optional augmentation to the message. This will be prepended,
+  ##   prior to hashing.
+  ## - `message` is the message to hash
+  ## - `domainSepTag` is the protocol domain separation tag (DST).
+  ##   `domainSepTag` MUST be at most 255 bytes.
+  ##   The function `shortDomainSepTag` MUST be used to compute an adequate DST
+  ##   for an oversized source DST.
+  ##   That DST can be cached.
+  # Steps:
+  # 1. ABORT if len_in_bytes > 65535 or len(DST) > 255
+  # 2. DST_prime = DST || I2OSP(len(DST), 1)
+  # 3. msg_prime = msg || I2OSP(len_in_bytes, 2) || DST_prime
+  # 4. uniform_bytes = H(msg_prime, len_in_bytes)
+  # 5. return uniform_bytes
+  static: doAssert len_in_bytes <= 65535
+
+  var l_i_b_str {.noInit.}: array[2, byte]
+  l_i_b_str.dumpRawInt(len_in_bytes.uint16, cursor = 0, bigEndian)
+
+  var ctx {.noInit.}: H
+  ctx.init()
+  ctx.absorb augmentation
+  ctx.absorb message
+  ctx.absorb l_i_b_str
+  ctx.absorb domainSepTag
+  ctx.absorb [byte domainSepTag.len] # DST_prime
+  ctx.squeeze(output)
+
 func redc2x[FF](r: var FF, big2x: BigInt) {.inline.} =
   r.mres.limbs.redc2xMont(
     big2x.limbs,
@@ -163,6 +224,52 @@ func mulMont(r: var BigInt, a, b: BigInt, FF: type) {.inline.} =
     FF.getSpareBits()
   )
 
+template hashToFieldParams(Field: typedesc, k: static int): untyped {.dirty.} =
+  ## L, the length in bytes of a uniform string to sample a base field element
+  ## m, the extension degree
+  when Field is Fp:
+    const L = ceilDiv_vartime(Field.bits() + k, 8)
+    const m = 1
+    type Big2x = BigInt[2 * Field.bits()]
+  elif Field is Fp2:
+    const L = ceilDiv_vartime(Fp[Field.Name].bits() + k, 8)
+    const m = 2
+    type Big2x = BigInt[2 * Fp[Field.Name].bits()]
+  else:
+    {.error: "Unconfigured".}
+
+func fromUniformBytes[Field; count, len_in_bytes: static int](
+       output: var array[count, Field],
+       k: static int,
+       uniform_bytes: array[len_in_bytes, byte]) =
+  ## Convert uniform bytes to field elements
+  ## https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-hash-to-curve-11#section-5.3
+  hashToFieldParams(Field, k)
+  static: doAssert len_in_bytes == count * m * L
+
+  for i in 0 ..< count:
+    for j in 0 ..< m:
+      let elm_offset = L * (j + i * m)
+      template tv: untyped = uniform_bytes.toOpenArray(elm_offset, elm_offset + L-1)
+
+      var big2x {.noInit.}: Big2x
+      big2x.unmarshal(tv, bigEndian)
+
+      # Reduces modulo p and output in Montgomery domain
+      when m == 1:
+        output[i].redc2x(big2x)
+        output[i].mres.mulMont(
+          output[i].mres,
+          Fp[Field.Name].getR3modP(),
+          Fp[Field.Name])
+
+      else:
+        output[i].coords[j].redc2x(big2x)
+        output[i].coords[j].mres.mulMont(
+          output[i].coords[j].mres,
+          Fp[Field.Name].getR3modP(),
+          Fp[Field.Name])
+
 func hashToField*[Field; count: static int](
        H: type CryptoHash,
        k: static int,
@@ -181,6 +288,8 @@ func hashToField*[Field; count: static int](
   ##   - Otherwise, H MUST be a hash function that has been proved
   ##    indifferentiable from a random oracle [MRH04] under a reasonable
   ##    cryptographic assumption.
+  ##   SHAKE128 and SHAKE256 use expand_message_xof,
+  ##   other hash functions use expand_message_xmd.
   ## - k the security parameter of the suite in bits (for example 128)
   ## - `output`, an array of fields or extension fields.
   ## - `augmentation`, an optional augmentation to the message. This will be prepended,
@@ -194,46 +303,120 @@ func hashToField*[Field; count: static int](
   ##   If a domainSepTag larger than 255-bit is required,
   ##   it is recommended to cache the reduced DST.
 
-  when Field is Fp:
-    const L = ceilDiv_vartime(Field.bits() + k, 8)
-    const m = 1
-    type Big2x = BigInt[2 * Field.bits()]
-  elif Field is Fp2:
-    const L = ceilDiv_vartime(Fp[Field.Name].bits() + k, 8)
-    const m = 2
-    type Big2x = BigInt[2 * Fp[Field.Name].bits()]
-  else:
-    {.error: "Unconfigured".}
-
+  hashToFieldParams(Field, k)
   const len_in_bytes = count * m * L
 
   var uniform_bytes{.noInit.}: array[len_in_bytes, byte]
-  H.expandMessageXMD(
-    uniform_bytes,
-    augmentation = augmentation,
-    message = message,
-    domainSepTag = domainSepTag
-  )
+  when H is (shake128 or shake256):
+    # An oversized DST is shortened to the 32-byte digest size of SHAKE
+    # while RFC 9380 requires ceil(2k/8) bytes.
+    static: doAssert k <= 128, "Oversized DST reduction with SHAKE only supports k <= 128"
+    H.expandMessageXOF(
+      uniform_bytes,
+      augmentation = augmentation,
+      message = message,
+      domainSepTag = domainSepTag
+    )
+  else:
+    H.expandMessageXMD(
+      uniform_bytes,
+      augmentation = augmentation,
+      message = message,
+      domainSepTag = domainSepTag
+    )
 
-  for i in 0 ..< count:
-    for j in 0 ..< m:
-      let elm_offset = L * (j + i * m)
-      template tv: untyped = uniform_bytes.toOpenArray(elm_offset, elm_offset + L-1)
+  output.fromUniformBytes(k, uniform_bytes)
 
-      var big2x {.noInit.}: Big2x
-      big2x.unmarshal(tv, bigEndian)
+# Batched hash to field
+# ----------------------------------------------------------------
+#
+# expand_message_xmd chains ell = len_in_bytes / b_in_bytes hashes
+# of the fixed-length blocks strxor(b_0, b_(i-1)) || I2OSP(i, 1) || DST_prime
+# per message. Across messages those blocks all have the same length
+# so they can be hashed in lockstep by multi-buffer SHA256.
+#
+# b_0 stays scalar: it resumes from the precomputed zero-padded state
+# and messages may have different lengths.
 
-      # Reduces modulo p and output in Montgomery domain
-      when m == 1:
-        output[i].redc2x(big2x)
-        output[i].mres.mulMont(
-          output[i].mres,
-          Fp[Field.Name].getR3modP(),
-          Fp[Field.Name])
+const XMD_BatchSize = 16 # Lanes of the widest multi-buffer SHA256 backend (AVX512)
 
-      else:
-        output[i].coords[j].redc2x(big2x)
-        output[i].coords[j].mres.mulMont(
-          output[i].coords[j].mres,
-          Fp[Field.Name].getR3modP(),
-          Fp[Field.Name])
+func expandMessageXMD_batch*[len_in_bytes: static int, Msg](
+       H: type sha256,
+       outputs: ptr UncheckedArray[array[len_in_bytes, byte]],
+       messages: ptr UncheckedArray[Msg],
+       N: int,
+       domainSepTag: openArray[byte]) =
+  ## Batched expand_message_xmd
+  ## outputs[i] = expand_message_xmd(messages[i], domainSepTag, len_in_bytes)
+  ##
+  ## `domainSepTag` MUST be at most 255 bytes.
+  ##
+  ## Security note: the blocks hashed by multi-buffer SHA256
+  ## are copied to stack buffers that are not cleared.
+  ## This is intended for public messages, for example in signature verification.
+  type Hash = H # Otherwise the VM says "cannot evaluate at compiletime H"
+  const DigestSize = Hash.digestSize()
+  static:
+    doAssert len_in_bytes mod 8 == 0         # By spec
+    doAssert len_in_bytes mod DigestSize == 0 # Assumed by copy optimization
+
+  const ell = len_in_bytes div DigestSize
+  let blkLen = DigestSize + 1 + domainSepTag.len + 1
+
+  var b0 {.noInit.}, bi {.noInit.}: array[XMD_BatchSize, array[DigestSize, byte]]
+  var blocks {.noInit.}: array[XMD_BatchSize * (DigestSize+1+255+1), byte]
+
+  var start = 0
+  while start < N:
+    let n = min(XMD_BatchSize, N - start)
+
+    for l in 0 ..< n:
+      H.expandMessageXMD_b0(b0[l], len_in_bytes, augmentation = [], messages[start+l], domainSepTag)
+
+      # DST_prime suffix is shared by all rounds
+      let off = l*blkLen
+      for j in 0 ..< domainSepTag.len:
+        blocks[off+DigestSize+1+j] = domainSepTag[j]
+      blocks[off+blkLen-1] = byte domainSepTag.len
+
+    for i in 1 .. ell:
+      for l in 0 ..< n:
+        let off = l*blkLen
+        if i == 1:
+          for j in 0 ..< DigestSize:
+            blocks[off+j] = b0[l][j]
+        else:
+          for j in 0 ..< DigestSize:
+            blocks[off+j] = b0[l][j] xor bi[l][j]
+        blocks[off+DigestSize] = byte i
+
+      H.hashMany(bi.asUnchecked(), blocks.asUnchecked(), blkLen, n)
+
+      for l in 0 ..< n:
+        copyMem(outputs[start+l][(i-1)*DigestSize].addr, bi[l][0].addr, DigestSize)
+
+    start += n
+
+func hashToField_batch*[Field; count: static int, Msg](
+       H: type sha256,
+       k: static int,
+       outputs: ptr UncheckedArray[array[count, Field]],
+       messages: ptr UncheckedArray[Msg],
+       N: int,
+       domainSepTag: openArray[byte]) =
+  ## Batched hash to a field or an extension field
+  ## outputs[i] = hash_to_field(messages[i], count)
+  ##
+  ## `domainSepTag` MUST be at most 255 bytes.
+  hashToFieldParams(Field, k)
+  const len_in_bytes = count * m * L
+
+  var uniform_bytes {.noInit.}: array[XMD_BatchSize, array[len_in_bytes, byte]]
+
+  var start = 0
+  while start < N:
+    let n = min(XMD_BatchSize, N - start)
+    H.expandMessageXMD_batch(uniform_bytes.asUnchecked(), messages +% start, n, domainSepTag)
+    for i in 0 ..< n:
+      outputs[start+i].fromUniformBytes(k, uniform_bytes[i])
+    start += n
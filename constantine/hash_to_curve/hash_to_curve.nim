@@ -37,19 +37,11 @@ export abstractions, arithmetic # generic sandwich
 # Map to curve
 # ----------------------------------------------------------------
 
-func mapToCurve_svdw[F, G](
-       r: var EC_ShortW_Aff[F, G],
-       u: F) =
-  ## Deterministically map a field element u
-  ## to an elliptic curve point `r`
-  ## https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-hash-to-curve-14#section-6.6.1
-
-  var
-    tv1 {.noInit.}, tv2{.noInit.}, tv3{.noInit.}: F
-    tv4{.noInit.}: F
-    x1{.noInit.}, x2{.noInit.}: F
-    gx1{.noInit.}, gx2{.noInit.}: F
-
+func mapToCurve_svdw_den[F](
+       tv1, tv2, tv3: var F,
+       u: F, G: static Subgroup) =
+  ## SvdW map, computation of the field element to invert
+  ## tv1 = 1 - Z_rhs·u², tv2 = 1 + Z_rhs·u², tv3 = tv1·tv2
   tv1.square(u)
   tv1 *= h2cConst(F.Name, svdw, G, curve_eq_rhs_Z)
   tv2 = tv1
@@ -61,7 +53,16 @@ func mapToCurve_svdw[F, G](
     tv1.c0.diff(Fp[F.F.Name].getOne(), tv1.c0)
     tv1.c1.neg()
   tv3.prod(tv1, tv2)
-  tv3.inv()
+
+func mapToCurve_svdw[F, G](
+       r: var EC_ShortW_Aff[F, G],
+       u: F, tv1, tv2, tv3: F) =
+  ## SvdW map, after inversion of the `tv3` denominator
+  ## computed by `mapToCurve_svdw_den`
+  var
+    tv4{.noInit.}: F
+    x1{.noInit.}, x2{.noInit.}: F
+    gx1{.noInit.}, gx2{.noInit.}: F
 
   tv4.prod(u, tv1)
   tv4 *= tv3
@@ -90,6 +91,18 @@ func mapToCurve_svdw[F, G](
 
   r.y.cneg(sgn0(u) xor sgn0(r.y))
 
+func mapToCurve_svdw[F, G](
+       r: var EC_ShortW_Aff[F, G],
+       u: F) =
+  ## Deterministically map a field element u
+  ## to an elliptic curve point `r`
+  ## https://datatracker.ietf.org/doc/html/draft-irtf-cfrg-hash-to-curve-14#section-6.6.1
+
+  var tv1 {.noInit.}, tv2{.noInit.}, tv3{.noInit.}: F
+  mapToCurve_svdw_den(tv1, tv2, tv3, u, G)
+  tv3.inv()
+  r.mapToCurve_svdw(u, tv1, tv2, tv3)
+
 func mapToIsoCurve_sswuG1_opt3mod4[F](
        r: var EC_ShortW_Jac[F, G1],
        u: F) =
@@ -140,6 +153,34 @@ func mapToCurve_svdw_fusedAdd[F; G: static Subgroup](
   r.fromAffine(Q0)
   r += Q1
 
+func mapToCurve_svdw_fusedAdd_batch[F; G: static Subgroup](
+       r: ptr UncheckedArray[EC_ShortW_Jac[F, G]],
+       u: ptr UncheckedArray[array[2, F]],
+       N: int) =
+  ## Batched `mapToCurve_svdw_fusedAdd`
+  ## r[i] = map(u[i][0]) + map(u[i][1])
+  ##
+  ## The 2N field inversions are shared via Montgomery's batch inversion.
+  let us = cast[ptr UncheckedArray[F]](u)
+  let tv1 = allocStackArray(F, 2*N)
+  let tv2 = allocStackArray(F, 2*N)
+  let tv3 = allocStackArray(F, 2*N)
+  let tv3inv = allocStackArray(F, 2*N)
+
+  for i in 0 ..< 2*N:
+    mapToCurve_svdw_den(tv1[i], tv2[i], tv3[i], us[i], G)
+
+  # inv0 semantics: 0 is mapped to 0 like `inv`
+  tv3inv.batchInv(tv3, 2*N)
+
+  for i in 0 ..< N:
+    var Q0{.noInit.}, Q1{.noInit.}: EC_ShortW_Aff[F, G]
+    Q0.mapToCurve_svdw(us[2*i], tv1[2*i], tv2[2*i], tv3inv[2*i])
+    Q1.mapToCurve_svdw(us[2*i+1], tv1[2*i+1], tv2[2*i+1], tv3inv[2*i+1])
+
+    r[i].fromAffine(Q0)
+    r[i] += Q1
+
 func mapToCurve_sswu*[F; G: static Subgroup](r: var EC_ShortW_Jac[F, G], u: F) =
   ## Map an element of the finite or extension field F to an elliptic curve E
   when F.Name.getCoefA() * F.Name.getCoefB() == 0:
@@ -355,3 +396,93 @@ func hashToCurve*[F; G: static Subgroup](
     output.projectiveFromJacobian(Pjac)
   else:
     output.affine(Pjac)
+
+# Batch hash to curve
+# ----------------------------------------------------------------
+#
+# - expand_message_xmd is computed in lockstep across messages
+#   with multi-buffer SHA256.
+# - The SvdW map (BN254) field inversions are shared across the batch.
+#   The SSWU map (BLS12-381) is inversion-free, it uses fractions.
+# - The Jacobian to affine conversion is shared across the batch.
+#
+# Square roots and sqrt_ratio are exponentiations whose output
+# depends on the input being a square, they cannot be shared in constant-time.
+
+const H2C_BatchSize = 16
+
+func hashToCurve_batch*[F; G: static Subgroup, Msg](
+       H: type CryptoHash,
+       k: static int,
+       output: ptr UncheckedArray[EC_ShortW_Aff[F, G]],
+       messages: ptr UncheckedArray[Msg],
+       N: int,
+       domainSepTag: openArray[byte]) =
+  ## Hash messages to an elliptic curve
+  ## output[i] = hashToCurve(messages[i])
+  ##
+  ## Arguments:
+  ## - `Hash` a cryptographic hash function.
+  ##   SHA256 message expansion is batched with multi-buffer hashing.
+  ## - k the security parameter of the suite in bits (for example 128)
+  ## - `output`, a buffer of N elliptic curve points that will be overwritten.
+  ## - `messages`, a buffer of N messages to hash
+  ## - `domainSepTag` is the protocol domain separation tag (DST).
+  ##
+  ## Message augmentation is not supported.
+  if N <= 0:
+    return
+
+  if domainSepTag.len > 255:
+    const DigestSize = H.type.digestSize()
+    var dst {.noInit.}: array[DigestSize, byte]
+    H.shortDomainSepTag(dst, domainSepTag)
+    H.hashToCurve_batch(k, output, messages, N, dst)
+    return
+
+  var u {.noInit.}: array[H2C_BatchSize, array[2, F]]
+  var jacs {.noInit.}: array[H2C_BatchSize, EC_ShortW_Jac[F, G]]
+
+  var start = 0
+  while start < N:
+    let n = min(H2C_BatchSize, N - start)
+    when H is sha256:
+      H.hashToField_batch(k, u.asUnchecked(), messages +% start, n, domainSepTag)
+    else:
+      for i in 0 ..< n:
+        H.hashToField(k, u[i], default(array[0, byte]), messages[start+i], domainSepTag)
+
+    when F.Name == BLS12_381:
+      for i in 0 ..< n:
+        jacs[i].mapToCurve_sswu_fusedAdd(u[i][0], u[i][1])
+    elif F.Name == BN254_Snarks:
+      mapToCurve_svdw_fusedAdd_batch(jacs.asUnchecked(), u.asUnchecked(), n)
+    else:
+      {.error: "Not implemented".}
+
+    for i in 0 ..< n:
+      jacs[i].clearCofactor()
+
+    batchAffine(output +% start, jacs.asUnchecked(), n)
+    start += n
+
+func hashToCurve_batch*[F; G: static Subgroup, Msg](
+       H: type CryptoHash,
+       k: static int,
+       output: var openArray[EC_ShortW_Aff[F, G]],
+       messages: openArray[Msg],
+       domainSepTag: openArray[byte]) {.inline, genCharAPI.} =
+  ## Hash messages to an elliptic curve
+  ## output[i] = hashToCurve(messages[i])
+  ##
+  ## Arguments:
+  ## - `Hash` a cryptographic hash function.
+  ##   SHA256 message expansion is batched with multi-buffer hashing.
+  ## - k the security parameter of the suite in bits (for example 128)
+  ## - `output`, elliptic curve points that will be overwritten.
+  ## - `messages`, the messages to hash, of the same length as `output`
+  ## - `domainSepTag` is the protocol domain separation tag (DST).
+  ##
+  ## Message augmentation is not supported.
+  debug: doAssert output.len == messages.len
+  H.hashToCurve_batch(k, output.asUnchecked(), messages.asUnchecked(), output.len, domainSepTag)
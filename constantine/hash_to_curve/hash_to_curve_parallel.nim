@@ -0,0 +1,95 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+when not compileOption("threads"):
+  {.error: "This requires --threads:on compilation flag".}
+
+# Reexport the serial API
+import ./hash_to_curve
+export hash_to_curve
+
+import
+  constantine/platforms/[abstractions, views],
+  constantine/math/ec_shortweierstrass,
+  constantine/hashes,
+  constantine/threadpool/[threadpool, partitioners],
+  ./h2c_hash_to_field
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# ############################################################
+#
+#                Hashing to Elliptic Curve
+#                    Parallel Edition
+#
+# ############################################################
+
+proc hashToCurve_batch_parallel*[F; G: static Subgroup, Msg](
+       tp: Threadpool,
+       H: type CryptoHash,
+       k: static int,
+       output: ptr UncheckedArray[EC_ShortW_Aff[F, G]],
+       messages: ptr UncheckedArray[Msg],
+       N: int,
+       domainSepTag: openArray[byte]) =
+  ## Hash messages to an elliptic curve
+  ## output[i] = hashToCurve(messages[i])
+  ##
+  ## The messages are split into one chunk per thread,
+  ## each chunk is hashed with `hashToCurve_batch`.
+  ##
+  ## Message augmentation is not supported.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  if N <= 0:
+    return
+
+  if domainSepTag.len > 255:
+    # Shorten the DST once instead of once per task
+    const DigestSize = H.type.digestSize()
+    var dst {.noInit.}: array[DigestSize, byte]
+    H.shortDomainSepTag(dst, domainSepTag)
+    tp.hashToCurve_batch_parallel(H, k, output, messages, N, dst)
+    return
+
+  let chunkDesc = balancedChunksPrioNumber(
+    start = 0, stopEx = N,
+    numChunks = min(N, tp.numThreads.int))
+
+  syncScope:
+    for iter in items(chunkDesc):
+      proc hashToCurve_batch_wrapper(
+             output: ptr UncheckedArray[EC_ShortW_Aff[F, G]],
+             messages: ptr UncheckedArray[Msg],
+             len: int,
+             domainSepTag: View[byte]) {.nimcall.} =
+        # The borrow checker prevents capturing `var` and `openArray`
+        # so we capture pointers instead.
+        H.hashToCurve_batch(k, output, messages, len, domainSepTag.toOpenArray())
+
+      tp.spawn hashToCurve_batch_wrapper(
+        output +% iter.start, messages +% iter.start,
+        iter.size, domainSepTag.toView())
+
+proc hashToCurve_batch_parallel*[F; G: static Subgroup, Msg](
+       tp: Threadpool,
+       H: type CryptoHash,
+       k: static int,
+       output: var openArray[EC_ShortW_Aff[F, G]],
+       messages: openArray[Msg],
+       domainSepTag: openArray[byte]) {.inline, genCharAPI.} =
+  ## Hash messages to an elliptic curve
+  ## output[i] = hashToCurve(messages[i])
+  ##
+  ## Message augmentation is not supported.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  debug: doAssert output.len == messages.len
+  tp.hashToCurve_batch_parallel(H, k, output.asUnchecked(), messages.asUnchecked(), output.len, domainSepTag)
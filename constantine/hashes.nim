@@ -66,15 +66,20 @@ func hash*(
 import ./hashes/[
   h_keccak,
   h_sha256,
-  h_ripemd160
+  h_ripemd160,
+  h_blake2b
 ]
 export
   h_keccak,
   h_sha256,
-  h_ripemd160
+  h_ripemd160,
+  h_blake2b
 
 static:
   doAssert keccak256 is CryptoHash
   doAssert sha256 is CryptoHash
   doAssert sha3_256 is CryptoHash
+  doAssert shake128 is CryptoHash
+  doAssert shake256 is CryptoHash
   doAssert ripemd160 is CryptoHash
+  doAssert blake2b is CryptoHash
@@ -0,0 +1,112 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/primitives,
+  constantine/serialization/endians
+
+# BLAKE2b, a hash function from the BLAKE family
+# --------------------------------------------------------------------------------
+#
+# References:
+# - IETF: The BLAKE2 Cryptographic Hash and Message Authentication Code (MAC)
+#   https://www.rfc-editor.org/rfc/rfc7693
+# - https://www.blake2.net/blake2.pdf
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# Types & Constants
+# ------------------------------------------------
+
+const
+  Blake2b_DigestSize* = 64
+  Blake2b_BlockSize* = 128
+
+type Blake2b_MessageWords* = array[Blake2b_BlockSize div sizeof(uint64), uint64]
+
+const Blake2b_IV* = [
+  0x6a09e667f3bcc908'u64, 0xbb67ae8584caa73b'u64, 0x3c6ef372fe94f82b'u64, 0xa54ff53a5f1d36f1'u64,
+  0x510e527fade682d1'u64, 0x9b05688c2b3e6c1f'u64, 0x1f83d9abfb41bd6b'u64, 0x5be0cd19137e2179'u64
+]
+
+const Blake2b_Sigma* = [
+  [ 0'u8,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15],
+  [14'u8, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3],
+  [11'u8,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4],
+  [ 7'u8,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8],
+  [ 9'u8,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13],
+  [ 2'u8, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9],
+  [12'u8,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11],
+  [13'u8, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10],
+  [ 6'u8, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5],
+  [10'u8,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0]
+]
+  ## Message word permutations, round r uses Blake2b_Sigma[r mod 10]
+
+# Primitives
+# ------------------------------------------------
+
+template rotr(x: uint64, n: static int): uint64 =
+  ## Rotate right the bits
+  (x shr n) or (x shl (64 - n))
+
+template G(v: var array[16, uint64], a, b, c, d: static int, x, y: uint64) =
+  ## Mixing function G
+  v[a] = v[a] + v[b] + x
+  v[d] = rotr(v[d] xor v[a], 32)
+  v[c] = v[c] + v[d]
+  v[b] = rotr(v[b] xor v[c], 24)
+  v[a] = v[a] + v[b] + y
+  v[d] = rotr(v[d] xor v[a], 16)
+  v[c] = v[c] + v[d]
+  v[b] = rotr(v[b] xor v[c], 63)
+
+# Compression
+# ------------------------------------------------
+
+func loadMessageWords*(m: var Blake2b_MessageWords, message: ptr UncheckedArray[byte]) {.inline.} =
+  ## Load a 128-byte block as 16 little-endian words
+  staticFor i, 0, Blake2b_BlockSize div sizeof(uint64):
+    m[i] = uint64.fromBytes(message, i * sizeof(uint64), littleEndian)
+
+func blake2b_compress_generic*(
+       h: var array[8, uint64],
+       m: Blake2b_MessageWords,
+       t0, t1: uint64,
+       lastBlock: bool,
+       rounds: uint32) =
+  ## BLAKE2b compression function F
+  ## with a configurable number of rounds.
+  ## BLAKE2b uses 12 rounds, the EIP-152 precompile lets callers choose.
+  var v {.noInit.}: array[16, uint64]
+  staticFor i, 0, 8:
+    v[i] = h[i]
+    v[i+8] = Blake2b_IV[i]
+  v[12] = v[12] xor t0
+  v[13] = v[13] xor t1
+  v[14] = v[14] xor (0'u64 - uint64(lastBlock))
+
+  var sigma = 0
+  for _ in 0'u32 ..< rounds:
+    template s(i: int): int = int Blake2b_Sigma[sigma][i]
+    G(v, 0, 4,  8, 12, m[s( 0)], m[s( 1)])
+    G(v, 1, 5,  9, 13, m[s( 2)], m[s( 3)])
+    G(v, 2, 6, 10, 14, m[s( 4)], m[s( 5)])
+    G(v, 3, 7, 11, 15, m[s( 6)], m[s( 7)])
+    G(v, 0, 5, 10, 15, m[s( 8)], m[s( 9)])
+    G(v, 1, 6, 11, 12, m[s(10)], m[s(11)])
+    G(v, 2, 7,  8, 13, m[s(12)], m[s(13)])
+    G(v, 3, 4,  9, 14, m[s(14)], m[s(15)])
+    sigma += 1
+    if sigma == Blake2b_Sigma.len:
+      sigma = 0
+
+  staticFor i, 0, 8:
+    h[i] = h[i] xor v[i] xor v[i+8]
@@ -0,0 +1,115 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/isa_x86/simd_x86,
+  constantine/platforms/primitives,
+  ./blake2b_generic
+
+{.localpassC:"-mavx2".}
+
+# BLAKE2b, AVX2 optimizations
+# --------------------------------------------------------------------------------
+#
+# References:
+# - IETF: The BLAKE2 Cryptographic Hash and Message Authentication Code (MAC)
+#   https://www.rfc-editor.org/rfc/rfc7693
+# - Samuel Neves, Jean-Philippe Aumasson, 2012
+#   Implementing BLAKE with AVX, AVX2, and XOP
+#   https://eprint.iacr.org/2012/275.pdf
+#
+# The 4x4 working state v is stored as 4 rows of 4 words:
+#   a = v[0..3], b = v[4..7], c = v[8..11], d = v[12..15]
+# so that the 4 column G functions run in parallel, one per 64-bit lane.
+# The diagonal G functions run in parallel after rotating
+# rows b, c, d by 1, 2, 3 words, and rotating them back afterwards.
+#
+# Rotations by 32, 24 and 16 are byte shuffles
+# and rotation by 63 is (x >> 63) ⊕ (x + x).
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+template rotr32(x: m256i): m256i =
+  shuf_u32x8(x, 0xB1)           # _MM_SHUFFLE(2, 3, 0, 1)
+
+template rotr63(x: m256i): m256i =
+  xor_u256(shr_u64x4(x, 63), add_u64x4(x, x))
+
+template halfG(a, b, c, d, m, rotD, rotB: untyped) =
+  ## Half of the G function on 4 columns
+  a = add_u64x4(add_u64x4(a, b), m)
+  d = rotD(xor_u256(d, a))
+  c = add_u64x4(c, d)
+  b = rotB(xor_u256(b, c))
+
+func blake2b_compress_avx2*(
+       h: var array[8, uint64],
+       m: Blake2b_MessageWords,
+       t0, t1: uint64,
+       lastBlock: bool,
+       rounds: uint32) =
+  ## BLAKE2b compression function F
+  ## with a configurable number of rounds.
+  let rot16 = setr_u64x4(0x0100070605040302'u64, 0x09080f0e0d0c0b0a'u64,
+                         0x0100070605040302'u64, 0x09080f0e0d0c0b0a'u64)
+  let rot24 = setr_u64x4(0x0201000706050403'u64, 0x0a09080f0e0d0c0b'u64,
+                         0x0201000706050403'u64, 0x0a09080f0e0d0c0b'u64)
+
+  template rotr24(x: m256i): m256i = shuf_u8x32(x, rot24)
+  template rotr16(x: m256i): m256i = shuf_u8x32(x, rot16)
+
+  # The message permutation only depends on the round modulo 10.
+  # As the number of rounds can be large, permuted message vectors
+  # are computed once and reused every 10 rounds.
+  var ms {.noInit.}: array[Blake2b_Sigma.len, array[4, m256i]]
+  let numSchedules = int min(rounds, uint32 Blake2b_Sigma.len)
+  for r in 0 ..< numSchedules:
+    template s(i: int): int = int Blake2b_Sigma[r][i]
+    ms[r][0] = setr_u64x4(m[s( 0)], m[s( 2)], m[s( 4)], m[s( 6)])
+    ms[r][1] = setr_u64x4(m[s( 1)], m[s( 3)], m[s( 5)], m[s( 7)])
+    ms[r][2] = setr_u64x4(m[s( 8)], m[s(10)], m[s(12)], m[s(14)])
+    ms[r][3] = setr_u64x4(m[s( 9)], m[s(11)], m[s(13)], m[s(15)])
+
+  let h0 = loadu_u256(h[0].addr)
+  let h1 = loadu_u256(h[4].addr)
+
+  var a = h0
+  var b = h1
+  var c = setr_u64x4(Blake2b_IV[0], Blake2b_IV[1], Blake2b_IV[2], Blake2b_IV[3])
+  var d = xor_u256(
+    setr_u64x4(Blake2b_IV[4], Blake2b_IV[5], Blake2b_IV[6], Blake2b_IV[7]),
+    setr_u64x4(t0, t1, 0'u64 - uint64(lastBlock), 0'u64))
+
+  var sigma = 0
+  for _ in 0'u32 ..< rounds:
+    # Columns
+    halfG(a, b, c, d, ms[sigma][0], rotr32, rotr24)
+    halfG(a, b, c, d, ms[sigma][1], rotr16, rotr63)
+
+    # Diagonalize
+    b = permute_u64x4(b, 0x39)  # _MM_SHUFFLE(0, 3, 2, 1)
+    c = permute_u64x4(c, 0x4E)  # _MM_SHUFFLE(1, 0, 3, 2)
+    d = permute_u64x4(d, 0x93)  # _MM_SHUFFLE(2, 1, 0, 3)
+
+    # Diagonals
+    halfG(a, b, c, d, ms[sigma][2], rotr32, rotr24)
+    halfG(a, b, c, d, ms[sigma][3], rotr16, rotr63)
+
+    # Undiagonalize
+    b = permute_u64x4(b, 0x93)
+    c = permute_u64x4(c, 0x4E)
+    d = permute_u64x4(d, 0x39)
+
+    sigma += 1
+    if sigma == Blake2b_Sigma.len:
+      sigma = 0
+
+  storeu_u256(h[0].addr, xor_u256(h0, xor_u256(a, c)))
+  storeu_u256(h[4].addr, xor_u256(h1, xor_u256(b, d)))
@@ -0,0 +1,178 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/[abstractions, views],
+  constantine/serialization/endians,
+  ./blake2b/blake2b_generic
+
+when UseASM_X86_32:
+  import ./blake2b/blake2b_x86_avx2
+
+# BLAKE2b, a hash function from the BLAKE family
+# --------------------------------------------------------------------------------
+#
+# References:
+# - IETF: The BLAKE2 Cryptographic Hash and Message Authentication Code (MAC)
+#   https://www.rfc-editor.org/rfc/rfc7693
+# - EIP-152: Add BLAKE2 compression function `F` precompile
+#   https://eips.ethereum.org/EIPS/eip-152
+#
+# Vectors:
+# - https://www.rfc-editor.org/rfc/rfc7693#appendix-A
+# - https://github.com/BLAKE2/BLAKE2/tree/master/testvectors
+#
+# This implements unkeyed BLAKE2b-512.
+
+# Types and constants
+# ----------------------------------------------------------------
+
+type
+  Blake2bContext* = object
+    # Align to 64 for cache line and SIMD friendliness
+    h{.align: 64}: array[8, uint64]
+    buf{.align: 64}: array[Blake2b_BlockSize, byte]
+    t: array[2, uint64]
+    bufLen: uint
+
+  blake2b* = Blake2bContext
+
+# Internals
+# ----------------------------------------------------------------
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+func compressBlock(
+       h: var array[8, uint64],
+       m: Blake2b_MessageWords,
+       t0, t1: uint64,
+       lastBlock: bool,
+       rounds: uint32) {.inline.} =
+  when UseASM_X86_32:
+    if ({.noSideEffect.}: hasAvx2()):
+      blake2b_compress_avx2(h, m, t0, t1, lastBlock, rounds)
+    else:
+      blake2b_compress_generic(h, m, t0, t1, lastBlock, rounds)
+  else:
+    blake2b_compress_generic(h, m, t0, t1, lastBlock, rounds)
+
+func incCounter(ctx: var Blake2bContext, n: uint) {.inline.} =
+  ## Increment the 128-bit byte counter
+  ctx.t[0] += n.uint64
+  ctx.t[1] += uint64(ctx.t[0] < n.uint64)
+
+func hashBlock(ctx: var Blake2bContext, message: ptr UncheckedArray[byte], lastBlock: bool) {.inline.} =
+  var m {.noInit.}: Blake2b_MessageWords
+  m.loadMessageWords(message)
+  ctx.h.compressBlock(m, ctx.t[0], ctx.t[1], lastBlock, rounds = 12)
+
+# Public API
+# ----------------------------------------------------------------
+
+template digestSize*(H: type blake2b): int =
+  ## Returns the output size in bytes
+  Blake2b_DigestSize
+
+template internalBlockSize*(H: type blake2b): int =
+  ## Returns the byte size of the hash function ingested blocks
+  Blake2b_BlockSize
+
+func init*(ctx: var Blake2bContext) =
+  ## Initialize or reinitialize a Blake2b context
+  ctx.h = Blake2b_IV
+  # Parameter block: digest length 64, no key, fanout 1, depth 1
+  ctx.h[0] = ctx.h[0] xor 0x01010040'u64
+  ctx.buf.setZero()
+  ctx.t[0] = 0
+  ctx.t[1] = 0
+  ctx.bufLen = 0
+
+func update*(ctx: var Blake2bContext, message: openarray[byte]) =
+  ## Append a message to a Blake2b context
+  ## for incremental Blake2b computation
+  ##
+  ## Security note: the tail of your message might be stored
+  ## in an internal buffer.
+  ## if sensitive content is used, ensure that
+  ## `ctx.finish(...)` and `ctx.clear()` are called as soon as possible.
+  ## Additionally ensure that the message(s) passed was(were) stored
+  ## in memory considered secure for your threat model.
+
+  # The last block is compressed with a finalization flag,
+  # so a full buffer is only compressed once more data arrives.
+  var cur = 0'u
+  var bytesLeft = message.len.uint
+
+  if ctx.bufLen + bytesLeft > Blake2b_BlockSize:
+    # Fill the buffer and hash it
+    let free = Blake2b_BlockSize - ctx.bufLen
+    ctx.buf.rawCopy(dStart = ctx.bufLen, message, sStart = 0, len = free)
+    ctx.incCounter(Blake2b_BlockSize)
+    ctx.hashBlock(ctx.buf.asUnchecked(), lastBlock = false)
+    ctx.bufLen = 0
+    cur = free
+    bytesLeft -= free
+
+    # Hash full blocks except the last one
+    while bytesLeft > Blake2b_BlockSize:
+      ctx.incCounter(Blake2b_BlockSize)
+      ctx.hashBlock(message.asUnchecked() +% cur, lastBlock = false)
+      cur += Blake2b_BlockSize
+      bytesLeft -= Blake2b_BlockSize
+
+  if bytesLeft != 0:
+    # Store the tail in buffer
+    ctx.buf.rawCopy(dStart = ctx.bufLen, message, sStart = cur, len = bytesLeft)
+    ctx.bufLen += bytesLeft
+
+func finish*(ctx: var Blake2bContext, digest: var array[Blake2b_DigestSize, byte]) =
+  ## Finalize a Blake2b computation and output the
+  ## message digest to the `digest` buffer.
+  ##
+  ## Security note: this does not clear the internal buffer.
+  ## if sensitive content is used, use "ctx.clear()"
+  ## and also make sure that the message(s) passed were stored
+  ## in memory considered secure for your threat model.
+  ctx.incCounter(ctx.bufLen)
+  for i in ctx.bufLen.int ..< Blake2b_BlockSize:
+    ctx.buf[i] = 0
+  ctx.hashBlock(ctx.buf.asUnchecked(), lastBlock = true)
+
+  staticFor i, 0, 8:
+    digest.dumpRawInt(ctx.h[i], i * sizeof(uint64), littleEndian)
+
+func clear*(ctx: var Blake2bContext) =
+  ## Clear the context internal buffers
+  # TODO: ensure compiler cannot optimize the code away
+  ctx.h.setZero()
+  ctx.buf.setZero()
+  ctx.t[0] = 0
+  ctx.t[1] = 0
+  ctx.bufLen = 0
+
+# Compression function F
+# ----------------------------------------------------------------
+
+func compress*(
+       H: type blake2b,
+       h: var array[8, uint64],
+       m: array[16, uint64],
+       t: array[2, uint64],
+       lastBlock: bool,
+       rounds: uint32) =
+  ## BLAKE2b compression function F
+  ## with a configurable number of rounds, as specified in EIP-152.
+  ## BLAKE2b uses 12 rounds.
+  ##
+  ## - h: the state vector
+  ## - m: the message block, as 16 words
+  ## - t: the 128-bit offset counter, low word first
+  ## - lastBlock: the final block indicator flag
+  h.compressBlock(m, t[0], t[1], lastBlock, rounds)
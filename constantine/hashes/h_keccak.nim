@@ -11,7 +11,10 @@ import
   ./keccak/keccak_generic
 
 when UseASM_X86_32:
-  import ./keccak/keccak_x86_bmi1
+  import ./keccak/[
+    keccak_x86_bmi1,
+    keccak_x86_avx2_x4,
+    keccak_x86_avx512_x8]
 
 # Keccak, the hash function underlying SHA3
 # --------------------------------------------------------------------------------
@@ -100,6 +103,8 @@ type
 
   keccak256* = KeccakContext[256, 0x01]
   sha3_256* = KeccakContext[256, 0x06]
+  shake128* = KeccakContext[128, 0x1F]
+  shake256* = KeccakContext[256, 0x1F]
 
 template rate(ctx: KeccakContext): int =
   200 - 2*(ctx.bits div 8)
@@ -165,7 +170,7 @@ template genAbsorb(isaFeatures: untyped) =
     if bytesLeft >= ctx.rate():
       # Process multiple blocks
       let numBlocks = bytesLeft div ctx.rate()
-      ctx.H.`hashMessageBlocks _ isaFeatures`(message.asUnchecked() +% cur, numBlocks)
+      ctx.H.`hashMessageBlocks _ isaFeatures`(message.asUnchecked() +% cur, numBlocks, ctx.rate())
       cur += numBlocks * ctx.rate()
       bytesLeft -= numBlocks * ctx.rate()
 
@@ -211,17 +216,17 @@ template genSqueeze(isaFeatures: untyped) =
     if bytesLeft >= ctx.rate():
       # Process multiple blocks
       let numBlocks = bytesLeft div ctx.rate()
-      ctx.H.`squeezeDigestBlocks _ isaFeatures`(digest.asUnchecked() +% cur, numBlocks)
+      ctx.H.`squeezeDigestBlocks _ isaFeatures`(digest.asUnchecked() +% cur, numBlocks, ctx.rate())
       ctx.absorb_offset = 0
       cur += numBlocks * ctx.rate()
       bytesLeft -= numBlocks * ctx.rate()
 
     if bytesLeft != 0:
       # Output the tail
-      ctx.H.`copyOutPartial _ isaFeatures`(hByteOffset = pos, digest.toOpenArray(cur, bytesLeft-1))
+      ctx.H.`copyOutPartial _ isaFeatures`(hByteOffset = pos, digest.toOpenArray(cur, cur+bytesLeft-1))
 
     # Epilogue
-    ctx.squeeze_offset = int32 bytesLeft
+    ctx.squeeze_offset = int32(pos+bytesLeft)
     # We don't signal absorb_offset to permute the state if called next
     # as per
     #   - original keccak spec that uses "absorb-permute-squeeze" protocol
@@ -251,6 +256,12 @@ func absorb*(ctx: var KeccakContext, message: openArray[byte]) =
     ctx.absorb_generic(message)
 
 func squeeze*(ctx: var KeccakContext, message: var openArray[byte]) =
+  ## Squeeze bytes from the Keccak sponge state
+  ##
+  ## For the SHAKE128 and SHAKE256 extendable-output functions (XOF)
+  ## squeeze can be called repeatedly to stream
+  ## an arbitrary long output.
+  ## The concatenation of the outputs is independent of the chunking.
   when UseASM_X86_32:
     if ({.noSideEffect.}: hasBmi1()):
       ctx.squeeze_x86_bmi1(message)
@@ -287,3 +298,129 @@ func clear*(ctx: var KeccakContext) =
   ## Clear the context internal buffers
   # TODO: ensure compiler cannot optimize the code away
   ctx.reset()
+
+# Extendable-Output Functions
+# ----------------------------------------------------------------
+
+func xof*(
+       H: type (shake128 or shake256),
+       output: var openArray[byte],
+       message: openArray[byte]) =
+  ## SHAKE128 or SHAKE256 extendable-output function (XOF)
+  ## Produce `output.len` bytes from a message
+  ##
+  ## Use `init`, `absorb` and `squeeze` for streaming
+  var ctx {.noInit.}: H
+  ctx.init()
+  ctx.absorb(message)
+  ctx.squeeze(output)
+
+# Multi-buffer hashing
+# ----------------------------------------------------------------
+#
+# Merkle-Patricia tries hash a huge number of independent nodes.
+# Hashing those messages one per SIMD lane
+# with interleaved Keccak-f[1600] permutations
+# is faster than one at a time, 4 lanes with AVX2 and 8 lanes with AVX512.
+#
+# Messages in the same group are hashed for as many blocks as the longest.
+# For variable-length messages, grouping messages of similar lengths,
+# for example by sorting, maximizes throughput.
+
+func hashMessage[bits: static int, delimiter: static byte](
+       H: type KeccakContext[bits, delimiter],
+       digest: var array[32, byte],
+       message: ptr UncheckedArray[byte],
+       msgLen: int) {.inline.} =
+  var ctx {.noInit.}: H
+  ctx.init()
+  ctx.update(message.toOpenArray(0, msgLen-1))
+  ctx.finish(digest)
+
+template hashLanes(
+       Lanes: static int,
+       delimiter: static byte,
+       digests: ptr UncheckedArray[array[32, byte]],
+       messageAt, msgLenAt: untyped,
+       kernel: untyped) =
+  var dsts {.noInit.}: array[Lanes, ptr array[32, byte]]
+  var msgs {.noInit.}: array[Lanes, ptr UncheckedArray[byte]]
+  var lens {.noInit.}: array[Lanes, int]
+  for l in 0 ..< Lanes:
+    dsts[l] = digests[l].addr
+    msgs[l] = messageAt(l)
+    lens[l] = msgLenAt(l)
+  kernel(dsts, msgs, lens, delimiter)
+
+template hashManyImpl(
+       H, delimiter: untyped,
+       digests: ptr UncheckedArray[array[32, byte]],
+       numMessages: int,
+       messageAt, msgLenAt: untyped) =
+  var i = 0
+  when UseASM_X86_32:
+    template msgAtOffset(l: int): ptr UncheckedArray[byte] = messageAt(i+l)
+    template lenAtOffset(l: int): int = msgLenAt(i+l)
+
+    if ({.noSideEffect.}: hasAvx512f()):
+      while i + 8 <= numMessages:
+        hashLanes(8, delimiter, digests +% i, msgAtOffset, lenAtOffset, hashMessages_avx512_x8)
+        i += 8
+    if ({.noSideEffect.}: hasAvx2()):
+      while i + 4 <= numMessages:
+        hashLanes(4, delimiter, digests +% i, msgAtOffset, lenAtOffset, hashMessages_avx2_x4)
+        i += 4
+
+  while i < numMessages:
+    H.hashMessage(digests[i], messageAt(i), msgLenAt(i))
+    i += 1
+
+func hashMany*[bits: static int, delimiter: static byte](
+       H: type KeccakContext[bits, delimiter],
+       digests: ptr UncheckedArray[array[32, byte]],
+       messages: ptr UncheckedArray[byte],
+       msgLen: int,
+       numMessages: int) =
+  ## Hash `numMessages` independent messages of the same length `msgLen`
+  ## stored contiguously in `messages`.
+  ## digests[i] = H(messages[i*msgLen ..< (i+1)*msgLen])
+  ##
+  ## Security note: the tails of the messages are copied to stack buffers
+  ## that are not cleared.
+  static: doAssert bits == 256, "Only 256-bit Keccak is supported."
+  template messageAt(i: int): ptr UncheckedArray[byte] = messages +% (i*msgLen)
+  template msgLenAt(i: int): int = msgLen
+  hashManyImpl(H, delimiter, digests, numMessages, messageAt, msgLenAt)
+
+func hashMany*[bits: static int, delimiter: static byte](
+       H: type KeccakContext[bits, delimiter],
+       digests: ptr UncheckedArray[array[32, byte]],
+       messages: ptr UncheckedArray[ptr UncheckedArray[byte]],
+       msgLens: ptr UncheckedArray[int],
+       numMessages: int) =
+  ## Hash `numMessages` independent messages of variable lengths.
+  ## digests[i] = H(messages[i][0 ..< msgLens[i]])
+  ##
+  ## Security note: the tails of the messages are copied to stack buffers
+  ## that are not cleared.
+  static: doAssert bits == 256, "Only 256-bit Keccak is supported."
+  template messageAt(i: int): ptr UncheckedArray[byte] = messages[i]
+  template msgLenAt(i: int): int = msgLens[i]
+  hashManyImpl(H, delimiter, digests, numMessages, messageAt, msgLenAt)
+
+func hashMany*[bits: static int, delimiter: static byte](
+       H: type KeccakContext[bits, delimiter],
+       digests: var openArray[array[32, byte]],
+       messages: openArray[byte]) =
+  ## Hash `digests.len` independent messages of the same length
+  ## stored contiguously in `messages`.
+  ## `messages.len` MUST be a multiple of `digests.len`.
+  ## digests[i] = H(messages[i*msgLen ..< (i+1)*msgLen])
+  ## with msgLen = messages.len div digests.len
+  ##
+  ## Security note: the tails of the messages are copied to stack buffers
+  ## that are not cleared.
+  if digests.len == 0:
+    return
+  debug: doAssert messages.len mod digests.len == 0
+  H.hashMany(digests.asUnchecked(), messages.asUnchecked(), messages.len div digests.len, digests.len)
@@ -16,7 +16,10 @@ import
 when UseASM_X86_32:
   import ./sha256/[
     sha256_x86_ssse3,
-    sha256_x86_sha]
+    sha256_x86_sha,
+    sha256_x86_sse2_x4,
+    sha256_x86_avx2_x8,
+    sha256_x86_avx512_x16]
 
 when UseASM_ARM_64:
   import ./sha256/sha256_arm64_sha2
@@ -208,3 +211,149 @@ func clear*(ctx: var Sha256Context) {.libPrefix: prefix_sha256.} =
   ctx.s.H.setZero()
   ctx.buf.setZero()
   ctx.msgLen = 0
+
+# Multi-buffer hashing
+# ----------------------------------------------------------------
+#
+# Merkleization (SSZ hash_tree_root), EIP-2333 Lamport chunks
+# or Fiat-Shamir transcripts hash many independent short messages
+# of the same length, typically 64 bytes.
+#
+# On CPUs without SHA extensions, hashing those messages
+# one per SIMD lane is significantly faster than one at a time.
+# With SHA extensions, the dedicated instructions are faster
+# and messages are hashed one at a time.
+
+func hashPaddingBlock_64B(s: var Sha256_state) {.inline.} =
+  ## Hash the padding block of 64-byte messages
+  when UseASM_X86_32:
+    if ({.noSideEffect.}: hasSha()):
+      var padding {.noInit.}: array[Sha256_BlockSize, byte]
+      padding.setZero()
+      padding[0] = 0b1000_0000
+      padding.dumpRawInt(uint64(Sha256_BlockSize * 8), 56, bigEndian)
+      hashMessageBlocks_x86_sha(s, padding.asUnchecked(), numBlocks = 1)
+    else:
+      # Even with SSSE3, the only vectorized part is the message schedule
+      # and it is precomputed here.
+      hashPaddingBlock_64B_generic(s)
+  else:
+    hashPaddingBlock_64B_generic(s)
+
+func hash_64B(
+       digest: var array[Sha256_DigestSize, byte],
+       message: ptr UncheckedArray[byte]) {.inline.} =
+  var s {.noInit.}: Sha256_state
+  s.H = Sha256_IV
+  s.hashMessageBlocks(message, numBlocks = 1)
+  s.hashPaddingBlock_64B()
+  digest.dumpHash(s)
+
+func hashMessage(
+       digest: var array[Sha256_DigestSize, byte],
+       message: ptr UncheckedArray[byte],
+       msgLen: int) {.inline.} =
+  if msgLen == Sha256_BlockSize:
+    digest.hash_64B(message)
+    return
+
+  var ctx {.noInit.}: Sha256Context
+  ctx.init()
+  ctx.update(message.toOpenArray(0, msgLen-1))
+  ctx.finish(digest)
+
+template hashLanes(
+       Lanes: static int,
+       digests: ptr UncheckedArray[array[Sha256_DigestSize, byte]],
+       messages: ptr UncheckedArray[byte],
+       msgLen: int,
+       kernel: untyped) =
+  var dsts {.noInit.}: array[Lanes, ptr array[Sha256_DigestSize, byte]]
+  var msgs {.noInit.}: array[Lanes, ptr UncheckedArray[byte]]
+  for l in 0 ..< Lanes:
+    dsts[l] = digests[l].addr
+    msgs[l] = messages +% (l*msgLen)
+  kernel(dsts, msgs, msgLen)
+
+func hash_64B*(
+       H: type sha256,
+       digest: var array[Sha256_DigestSize, byte],
+       message: array[2*Sha256_DigestSize, byte]) =
+  ## Hash a 64-byte message, the concatenation of 2 digests.
+  ## This is the 2-to-1 compression function of SHA256 Merkle trees.
+  ## The padding block of 64-byte messages is constant and is specialized.
+  digest.hash_64B(message.asUnchecked())
+
+func sha256_x8*(
+       digests: var array[8, array[Sha256_DigestSize, byte]],
+       messages: array[8, ptr UncheckedArray[byte]],
+       msgLen: int) =
+  ## Hash 8 independent messages of the same length `msgLen`
+  ## and store their digests in `digests`
+  ##
+  ## Security note: the tails of the messages are copied to stack buffers
+  ## that are not cleared.
+  ## For passwords and secret keys, you MUST NOT use raw SHA-256
+  ## use a Key Derivation Function instead (KDF)
+  when UseASM_X86_32:
+    if not ({.noSideEffect.}: hasSha()) and ({.noSideEffect.}: hasAvx2()):
+      var dsts {.noInit.}: array[8, ptr array[Sha256_DigestSize, byte]]
+      for l in 0 ..< 8:
+        dsts[l] = digests[l].addr
+      hashMessages_avx2_x8(dsts, messages, msgLen)
+      return
+
+  for l in 0 ..< 8:
+    digests[l].hashMessage(messages[l], msgLen)
+
+func hashMany*(
+       H: type sha256,
+       digests: ptr UncheckedArray[array[Sha256_DigestSize, byte]],
+       messages: ptr UncheckedArray[byte],
+       msgLen: int,
+       numMessages: int) =
+  ## Hash `numMessages` independent messages of the same length `msgLen`
+  ## stored contiguously in `messages`.
+  ## digests[i] = sha256(messages[i*msgLen ..< (i+1)*msgLen])
+  ##
+  ## Security note: the tails of the messages are copied to stack buffers
+  ## that are not cleared.
+  ## For passwords and secret keys, you MUST NOT use raw SHA-256
+  ## use a Key Derivation Function instead (KDF)
+  var i = 0
+  when UseASM_X86_32:
+    if not ({.noSideEffect.}: hasSha()):
+      if ({.noSideEffect.}: hasAvx512f()):
+        while i + 16 <= numMessages:
+          hashLanes(16, digests +% i, messages +% (i*msgLen), msgLen, hashMessages_avx512_x16)
+          i += 16
+      if ({.noSideEffect.}: hasAvx2()):
+        while i + 8 <= numMessages:
+          hashLanes(8, digests +% i, messages +% (i*msgLen), msgLen, hashMessages_avx2_x8)
+          i += 8
+      while i + 4 <= numMessages:
+        hashLanes(4, digests +% i, messages +% (i*msgLen), msgLen, hashMessages_sse2_x4)
+        i += 4
+
+  while i < numMessages:
+    digests[i].hashMessage(messages +% (i*msgLen), msgLen)
+    i += 1
+
+func hashMany*(
+       H: type sha256,
+       digests: var openArray[array[Sha256_DigestSize, byte]],
+       messages: openArray[byte]) =
+  ## Hash `digests.len` independent messages of the same length
+  ## stored contiguously in `messages`.
+  ## `messages.len` MUST be a multiple of `digests.len`.
+  ## digests[i] = sha256(messages[i*msgLen ..< (i+1)*msgLen])
+  ## with msgLen = messages.len div digests.len
+  ##
+  ## Security note: the tails of the messages are copied to stack buffers
+  ## that are not cleared.
+  ## For passwords and secret keys, you MUST NOT use raw SHA-256
+  ## use a Key Derivation Function instead (KDF)
+  if digests.len == 0:
+    return
+  debug: doAssert messages.len mod digests.len == 0
+  H.hashMany(digests.asUnchecked(), messages.asUnchecked(), messages.len div digests.len, digests.len)
@@ -134,7 +134,7 @@ func N(A: var KeccakState, i: static int, x, y: int): var uint64 {.inline.} =
 # Keccak round constants
 #   are iteratively computed via a linear feedback shift register
 #   rc[t] = (xᵗ mod x⁸ + x⁶ + x⁵ + x⁴ + 1) mod x in GF(2)[x]
-const KRC: array[24, uint64] = [
+const KRC*: array[24, uint64] = [
     0x0000000000000001'u64,
     0x0000000000008082'u64,
     0x800000000000808a'u64,
@@ -161,7 +161,7 @@ const KRC: array[24, uint64] = [
     0x8000000080008008'u64,
 ]
 
-func genRho(): array[5*5, int] =
+func genRho*(): array[5*5, int] =
   result[lin_idx(0, 0)] = 0
   var (x, y) = (1, 0)
 
@@ -248,20 +248,21 @@ func xorInSingle(H: var KeccakState, hByteOffset: int, val: byte) {.inline.} =
   let lane = uint64(val) shl slot # All bits but the one set in `val` are 0, and 0 is neutral element of xor
   H.state[hByteOffset shr 3] ^= lane
 
-func xorInBlock(H: var KeccakState, msg: array[200 - 2*32, byte]) {.inline.} =
+func xorInBlock[rate: static int](H: var KeccakState, msg: array[rate, byte]) {.inline.} =
   ## Add new data into the Keccak state
   # This can benefit from vectorized instructions
   for i in 0 ..< msg.len div 8:
     H.state[i] ^= uint64.fromBytes(msg, i*8, littleEndian)
 
-func copyOutWords[W: static int](
+func copyOutWords[N: static int](
       H: KeccakState,
-      dst: var array[W*8, byte]) {.inline.} =
+      dst: var array[N, byte]) {.inline.} =
   ## Read data from the Keccak state
   ## and write it into `dst`
+  static: doAssert N mod 8 == 0
   debug: doAssert dst.len <= sizeof(H.state)
 
-  for w in 0 ..< W:
+  for w in 0 ..< N div 8:
     let word = H.state[w]
     for i in 0 ..< 8:
       dst[w*8+i] = toByte(word shr (i*8))
@@ -400,15 +401,15 @@ func pad*(H: var KeccakState, hByteOffset: int, delim: static byte, rate: static
 func hashMessageBlocks_impl*(
       H: var KeccakState,
       message: ptr UncheckedArray[byte],
-      numBlocks: int) {.inline.} =
+      numBlocks: int,
+      rate: static int) {.inline.} =
   ## Hash a message block by block
-  ## Keccak block size is the rate: 64
+  ## Keccak block size is the rate: 136 for Keccak256, 168 for SHAKE128
   ## The state MUST be absorb ready
   ## i.e. previous operation cannot be a squeeze
   ##      a permutation is needed in-between
 
   var message = message
-  const rate = 200 - 2*32 # TODO: make a generic Keccak state with auto-derived rate
   const numRounds = 24    # TODO: auto derive number of rounds
   for _ in 0 ..< numBlocks:
     let msg = cast[ptr array[rate, byte]](message)
@@ -419,39 +420,42 @@ func hashMessageBlocks_impl*(
 func hashMessageBlocks_generic*(
       H: var KeccakState,
       message: ptr UncheckedArray[byte],
-      numBlocks: int) =
+      numBlocks: int,
+      rate: static int) =
   ## Hash a message block by block
-  ## Keccak block size is the rate: 64
+  ## Keccak block size is the rate: 136 for Keccak256, 168 for SHAKE128
   ## The state MUST be absorb ready
   ## i.e. previous operation cannot be a squeeze
   ##      a permutation is needed in-between
-  hashMessageBlocks_impl(H, message, numBlocks)
+  hashMessageBlocks_impl(H, message, numBlocks, rate)
 
 func squeezeDigestBlocks_impl*(
       H: var KeccakState,
       digest: ptr UncheckedArray[byte],
-      numBlocks: int) =
+      numBlocks: int,
+      rate: static int) {.inline.} =
   ## Squeeze a digest block by block
-  ## Keccak block digest is the rate: 64
+  ## Keccak block digest is the rate: 136 for Keccak256, 168 for SHAKE128
   ## The state MUST be squeeze ready
   ## i.e. previous operation cannot be an absorb
   ##      a permutation is needed in-between
+  static: doAssert rate mod 8 == 0
   var digest = digest
-  const rate = 200 - 2*32 # TODO: make a generic Keccak state with auto-derived rate
   const numRounds = 24    # TODO: auto derive number of rounds
   for _ in 0 ..< numBlocks:
     let msg = cast[ptr array[rate, byte]](digest)
     H.copyOutWords(msg[])
-    H.permute_generic(numRounds)
+    H.permute_impl(numRounds)
     digest +%= rate
 
 func squeezeDigestBlocks_generic*(
       H: var KeccakState,
       digest: ptr UncheckedArray[byte],
-      numBlocks: int) =
+      numBlocks: int,
+      rate: static int) =
   ## Squeeze a digest block by block
-  ## Keccak block digest is the rate: 64
+  ## Keccak block digest is the rate: 136 for Keccak256, 168 for SHAKE128
   ## The state MUST be squeeze ready
   ## i.e. previous operation cannot be an absorb
   ##      a permutation is needed in-between
-  squeezeDigestBlocks_impl(H, digest, numBlocks)
\ No newline at end of file
+  squeezeDigestBlocks_impl(H, digest, numBlocks, rate)
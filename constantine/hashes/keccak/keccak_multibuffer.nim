@@ -0,0 +1,102 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/primitives,
+  constantine/serialization/endians
+
+# Keccak, multi-buffer helpers
+# --------------------------------------------------------------------------------
+#
+# References:
+# - https://keccak.team/files/Keccak-implementation-3.2.pdf
+#   section 3.6 Interleaving independent instances
+#
+# Multi-buffer hashing runs N independent Keccak-f[1600] permutations
+# with one SIMD lane per message. The 64-bit state lanes of each message
+# are transposed so that a vector register holds the same state lane
+# of every message.
+#
+# Messages may have different lengths, the permutation runs
+# for the largest number of blocks and each digest is extracted
+# right after its message last block was absorbed.
+# Messages that are done absorb zero blocks, the result is discarded.
+#
+# This file holds the scalar parts shared by all lane widths:
+# gathering message words, padding the last block and extracting the digests.
+# Only 256-bit security (rate 136 bytes, 32-byte digest) is supported.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+const
+  Keccak256_Rate* = 200 - 2*32
+  Keccak256_RateWords* = Keccak256_Rate div sizeof(uint64)
+  Keccak256_DigestWords* = 32 div sizeof(uint64)
+
+type
+  Keccak_MultiBufferTail*[Lanes: static int] = object
+    ## Padded last block of each message
+    ## and a zero block for messages already hashed
+    buf{.align: 64.}: array[Lanes, array[Keccak256_Rate, byte]]
+    zeros{.align: 64.}: array[Keccak256_Rate, byte]
+
+func keccak256_numBlocks*(msgLen: int): int {.inline.} =
+  ## Number of blocks to absorb including padding.
+  ## Padding is at least 1 byte so the last block
+  ## is always partial or a padding-only block.
+  msgLen div Keccak256_Rate + 1
+
+func init*[Lanes: static int](
+       tail: var Keccak_MultiBufferTail[Lanes],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       msgLens: array[Lanes, int],
+       delimiter: byte) =
+  ## Copy the incomplete last block of each message
+  ## and apply Keccak padding pad10*1 with the domain separation `delimiter`
+  tail.zeros.setZero()
+  for l in 0 ..< Lanes:
+    let fullBlocks = msgLens[l] div Keccak256_Rate
+    let tailLen = msgLens[l] mod Keccak256_Rate
+    tail.buf[l].setZero()
+    for i in 0 ..< tailLen:
+      tail.buf[l][i] = messages[l][fullBlocks*Keccak256_Rate + i]
+    tail.buf[l][tailLen] = tail.buf[l][tailLen] xor delimiter
+    tail.buf[l][Keccak256_Rate-1] = tail.buf[l][Keccak256_Rate-1] xor 0x80
+
+func blocks*[Lanes: static int](
+       tail: var Keccak_MultiBufferTail[Lanes],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       msgLens: array[Lanes, int],
+       blockIdx: int): array[Lanes, ptr UncheckedArray[byte]] {.inline.} =
+  ## Returns the block `blockIdx` of each message
+  for l in 0 ..< Lanes:
+    let fullBlocks = msgLens[l] div Keccak256_Rate
+    if blockIdx < fullBlocks:
+      result[l] = messages[l] +% (blockIdx*Keccak256_Rate)
+    elif blockIdx == fullBlocks:
+      result[l] = tail.buf[l].asUnchecked()
+    else:
+      result[l] = tail.zeros.asUnchecked()
+
+func gatherWords*[Lanes: static int](
+       dst: var array[Lanes, uint64],
+       blocks: array[Lanes, ptr UncheckedArray[byte]],
+       wordIdx: int) {.inline.} =
+  ## Load the little-endian word `wordIdx` of each block
+  for l in 0 ..< Lanes:
+    dst[l] = uint64.fromBytes(blocks[l], wordIdx * sizeof(uint64), littleEndian)
+
+func extractDigest*[Lanes: static int](
+       digest: ptr array[32, byte],
+       words: array[Keccak256_DigestWords, array[Lanes, uint64]],
+       lane: int) {.inline.} =
+  ## Store the digest of the message in `lane`
+  for w in 0 ..< Keccak256_DigestWords:
+    digest[].dumpRawInt(words[w][lane], w * sizeof(uint64), littleEndian)
@@ -0,0 +1,115 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/isa_x86/simd_x86,
+  constantine/platforms/primitives,
+  ./keccak_generic,
+  ./keccak_multibuffer
+
+{.localpassC:"-mavx512f".}
+
+# Keccak256, AVX512 multi-buffer, 8 messages in parallel
+# --------------------------------------------------------------------------------
+#
+# See keccak_multibuffer.nim for references.
+# Lane i of each 512-bit register holds the state lane of message i.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+const Lanes = 8
+
+type KeccakState_x8 = array[5*5, m512i]
+
+func idx(x, y: int): int {.inline.} =
+  5*y+x
+
+# The ternary logic instruction evaluates any 3-input boolean function
+# given its truth table, indexed by (a shl 2) or (b shl 1) or c:
+# - xor3: a xor b xor c             0x96
+# - chi:  a xor ((not b) and c)     0xD2
+
+template xor3(a, b, c: m512i): m512i =
+  ternlog_u64x8(a, b, c, 0x96)
+
+template chi(a, b, c: m512i): m512i =
+  ternlog_u64x8(a, b, c, 0xD2)
+
+template rotl(x: m512i, k: static int): m512i =
+  when k == 0:
+    x
+  else:
+    rotl_u64x8(x, int32 k)
+
+func permute(A: var KeccakState_x8) =
+  ## Keccak-f[1600] permutation on 8 interleaved states
+  const Rho = genRho()
+
+  var C {.noInit.}: array[5, m512i]
+  var D {.noInit.}: array[5, m512i]
+  var B {.noInit.}: array[5*5, m512i]
+
+  for r in 0 ..< 24:
+    # θ
+    staticFor x, 0, 5:
+      C[x] = xor3(xor3(A[idx(x, 0)], A[idx(x, 1)], A[idx(x, 2)]), A[idx(x, 3)], A[idx(x, 4)])
+    staticFor x, 0, 5:
+      D[x] = xor_u512(C[(x+4) mod 5], rotl(C[(x+1) mod 5], 1))
+
+    # ρ and π
+    staticFor y, 0, 5:
+      staticFor x, 0, 5:
+        B[idx(y, (2*x + 3*y) mod 5)] = rotl(xor_u512(A[idx(x, y)], D[x]), Rho[idx(x, y)])
+
+    # χ
+    staticFor y, 0, 5:
+      staticFor x, 0, 5:
+        A[idx(x, y)] = chi(B[idx(x, y)], B[idx((x+1) mod 5, y)], B[idx((x+2) mod 5, y)])
+
+    # ι
+    A[0] = xor_u512(A[0], set1_u64x8(KRC[r]))
+
+func hashMessages_avx512_x8*(
+       digests: array[Lanes, ptr array[32, byte]],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       msgLens: array[Lanes, int],
+       delimiter: byte) =
+  ## Hash 8 messages with Keccak256 or SHA3-256 depending on the `delimiter`
+  ## and store their digests in `digests`
+  var A {.noInit.}: KeccakState_x8
+  staticFor i, 0, 5*5:
+    A[i] = setzero_u512()
+
+  var tail {.noInit.}: Keccak_MultiBufferTail[Lanes]
+  tail.init(messages, msgLens, delimiter)
+
+  var maxBlocks = 0
+  for l in 0 ..< Lanes:
+    maxBlocks = max(maxBlocks, keccak256_numBlocks(msgLens[l]))
+
+  var buf {.noInit, align: 64.}: array[Lanes, uint64]
+  var words {.noInit, align: 64.}: array[Keccak256_DigestWords, array[Lanes, uint64]]
+
+  for b in 0 ..< maxBlocks:
+    let blocks = tail.blocks(messages, msgLens, b)
+    staticFor i, 0, Keccak256_RateWords:
+      buf.gatherWords(blocks, i)
+      A[i] = xor_u512(A[i], loada_u512(buf[0].addr))
+
+    A.permute()
+
+    var stored = false
+    for l in 0 ..< Lanes:
+      if keccak256_numBlocks(msgLens[l]) == b+1:
+        if not stored:
+          staticFor i, 0, Keccak256_DigestWords:
+            storea_u512(words[i][0].addr, A[i])
+          stored = true
+        digests[l].extractDigest(words, l)
@@ -40,21 +40,23 @@ func copyOutPartial_x86_bmi1*(
 func hashMessageBlocks_x86_bmi1*(
       H: var KeccakState,
       message: ptr UncheckedArray[byte],
-      numBlocks: int) =
+      numBlocks: int,
+      rate: static int) =
   ## Hash a message block by block
-  ## Keccak block size is the rate: 64
+  ## Keccak block size is the rate: 136 for Keccak256, 168 for SHAKE128
   ## The state MUST be absorb ready
   ## i.e. previous operation cannot be a squeeze
   ##      a permutation is needed in-between
-  hashMessageBlocks_impl(H, message, numBlocks)
+  hashMessageBlocks_impl(H, message, numBlocks, rate)
 
 func squeezeDigestBlocks_x86_bmi1*(
       H: var KeccakState,
       digest: ptr UncheckedArray[byte],
-      numBlocks: int) =
+      numBlocks: int,
+      rate: static int) =
   ## Squeeze a digest block by block
-  ## Keccak block digest is the rate: 64
+  ## Keccak block digest is the rate: 136 for Keccak256, 168 for SHAKE128
   ## The state MUST be squeeze ready
   ## i.e. previous operation cannot be an absorb
   ##      a permutation is needed in-between
-  squeezeDigestBlocks_impl(H, digest, numBlocks)
\ No newline at end of file
+  squeezeDigestBlocks_impl(H, digest, numBlocks, rate)
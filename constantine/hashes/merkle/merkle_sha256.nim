@@ -0,0 +1,352 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/abstractions,
+  constantine/serialization/endians,
+  constantine/hashes/h_sha256,
+  constantine/hashes/sha256/sha256_generic
+
+# ############################################################
+#
+#                 SHA256 binary Merkle trees
+#
+# ############################################################
+
+# References:
+# - Ethereum Simple Serialize (SSZ), merkleization
+#   https://github.com/ethereum/consensus-specs/blob/v1.5.0/ssz/simple-serialize.md#merkleization
+#
+# A binary Merkle tree over 32-byte chunks, with the SSZ conventions:
+# - parent = sha256(left || right)
+# - the number of leaves is padded to a power of 2 (or to a power of 2 limit)
+#   with zero chunks.
+#
+# Padding subtrees are never materialized,
+# the root of a zero subtree of depth d is the precomputed zeroHash(d).
+#
+# All levels are hashed in batches of 64-byte messages
+# to use the multi-buffer SHA256 kernels
+# or the specialized 64-byte path for SHA extensions.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+const MerkleMaxDepth* = 63
+  ## The maximum depth of a tree, SSZ limits are 64-bit integers.
+
+type
+  MerkleStatus* = enum
+    Merkle_Success
+    Merkle_TooManyChunks = "The number of chunks exceeds the limit"
+    Merkle_IndexOutOfBounds = "Leaf index out of bounds"
+    Merkle_InputsLengthsMismatch = "The number of indices and leaves must match"
+
+  MerkleTree* = object
+    ## A binary Merkle tree which keeps all its nodes
+    ## for incremental re-rooting after leaf updates.
+    ##
+    ## Nodes are stored level by level, starting from the leaves.
+    ## Level ℓ has ⌈numLeaves/2ˡ⌉ nodes,
+    ## missing right siblings are zero subtrees.
+    nodes: ptr UncheckedArray[array[32, byte]]
+    levelOffsets: array[MerkleMaxDepth+1, int]
+    numLeaves, depth: int
+
+proc `=destroy`*(tree: var MerkleTree) {.raises: [].} =
+  if tree.nodes != nil:
+    freeHeapAligned(tree.nodes)
+    tree.nodes = nil
+
+proc `=copy`*(dst: var MerkleTree, src: MerkleTree) {.error: "MerkleTree cannot be copied".}
+
+# Zero hashes
+# ------------------------------------------------------------
+
+func computeZeroHashes(): array[MerkleMaxDepth+1, array[32, byte]] {.compileTime.} =
+  ## zeroHashes[0] = 0
+  ## zeroHashes[d+1] = sha256(zeroHashes[d] || zeroHashes[d])
+  var padding: array[Sha256_BlockSize, byte]
+  padding[0] = 0b1000_0000
+  padding.dumpRawInt(uint64(Sha256_BlockSize * 8), 56, bigEndian)
+
+  for d in 0 ..< MerkleMaxDepth:
+    var message: array[Sha256_BlockSize, byte]
+    for i in 0 ..< 32:
+      message[i] = result[d][i]
+      message[32+i] = result[d][i]
+
+    var s: Sha256_state
+    s.H = Sha256_IV
+    s.hashMessageBlock_compileTime(message)
+    s.hashMessageBlock_compileTime(padding)
+    for i in 0 ..< s.H.len:
+      result[d+1].dumpRawInt(s.H[i], i * sizeof(Sha256_Word), bigEndian)
+
+const ZeroHashes = computeZeroHashes()
+
+func zeroHash*(depth: int): array[32, byte] {.inline.} =
+  ## Returns the root of a tree of `depth` with only zero leaves
+  debug: doAssert depth in 0 .. MerkleMaxDepth
+  ZeroHashes[depth]
+
+func merkleDepth*(limit: int): int {.inline.} =
+  ## Returns the depth of a tree with `limit` leaves,
+  ## i.e. ⌈log₂(limit)⌉
+  if limit <= 1: 0
+  else: int(log2_vartime(uint64(limit-1))) + 1
+
+# Level-by-level hashing
+# ------------------------------------------------------------
+
+func concat(dst: var array[64, byte], left, right: array[32, byte]) {.inline.} =
+  for i in 0 ..< 32:
+    dst[i] = left[i]
+    dst[32+i] = right[i]
+
+func hashLevel*(
+       parents: ptr UncheckedArray[array[32, byte]],
+       children: ptr UncheckedArray[array[32, byte]],
+       numParents: int) =
+  ## parents[i] = sha256(children[2i] || children[2i+1])
+  ## for i in [0, numParents)
+  ##
+  ## `parents` may alias `children` for in-place hashing.
+  if numParents == 0:
+    return
+  sha256.hashMany(
+    parents,
+    cast[ptr UncheckedArray[byte]](children),
+    msgLen = 2*sizeof(array[32, byte]),
+    numMessages = numParents)
+
+func hashLevelPadded*(
+       parents: ptr UncheckedArray[array[32, byte]],
+       children: ptr UncheckedArray[array[32, byte]],
+       numChildren: int,
+       level: int) =
+  ## Hash a level with `numChildren` nodes at height `level` in the tree
+  ## into its ⌈numChildren/2⌉ parents.
+  ## If the number of children is odd, the last child
+  ## is paired with the root of a zero subtree.
+  ##
+  ## `parents` may alias `children` for in-place hashing.
+  let numPairs = numChildren shr 1
+  hashLevel(parents, children, numPairs)
+  if (numChildren and 1) == 1:
+    var buf {.noInit.}: array[64, byte]
+    buf.concat(children[numChildren-1], ZeroHashes[level])
+    sha256.hash_64B(parents[numPairs], buf)
+
+# Merkleization
+# ------------------------------------------------------------
+
+func merkleize*(
+       root: var array[32, byte],
+       chunks: openArray[array[32, byte]],
+       limit = -1): MerkleStatus {.tags:[HeapAlloc], meter.} =
+  ## Compute the Merkle root of `chunks`
+  ## padded with zero chunks to the next power of 2 of `limit`.
+  ## If `limit` is negative, `chunks.len` is used as the limit.
+  ##
+  ## This is SSZ `merkleize(chunks, limit)`.
+  let limit = if limit < 0: chunks.len else: limit
+  if chunks.len > limit:
+    return Merkle_TooManyChunks
+
+  let depth = merkleDepth(limit)
+  if chunks.len == 0:
+    root = ZeroHashes[depth]
+    return Merkle_Success
+  if depth == 0:
+    root = chunks[0]
+    return Merkle_Success
+
+  let scratch = allocHeapArrayAligned(array[32, byte], (chunks.len+1) shr 1, alignment = 64)
+
+  var src = chunks.asUnchecked()
+  var n = chunks.len
+  for level in 0 ..< depth:
+    hashLevelPadded(scratch, src, n, level)
+    src = scratch
+    n = (n+1) shr 1
+
+  root = scratch[0]
+  freeHeapAligned(scratch)
+  return Merkle_Success
+
+func mixInLength*(root: var array[32, byte], length: uint64) =
+  ## root = sha256(root || length)
+  ## with length serialized as a 32-byte little-endian integer
+  ##
+  ## This is SSZ `mix_in_length`.
+  var buf {.noInit.}: array[64, byte]
+  for i in 0 ..< 32:
+    buf[i] = root[i]
+  buf.dumpRawInt(length, 32, littleEndian)
+  for i in 40 ..< 64:
+    buf[i] = 0
+  sha256.hash_64B(root, buf)
+
+# Incremental Merkle trees
+# ------------------------------------------------------------
+
+func levelLen*(tree: MerkleTree, level: int): int {.inline.} =
+  ## Number of materialized nodes at `level`, leaves are level 0
+  int((uint(tree.numLeaves) + (1'u shl level) - 1) shr level)
+
+func levelNodes*(tree: MerkleTree, level: int): ptr UncheckedArray[array[32, byte]] {.inline.} =
+  ## Materialized nodes at `level`, leaves are level 0
+  tree.nodes +% tree.levelOffsets[level]
+
+func depth*(tree: MerkleTree): int {.inline.} =
+  tree.depth
+
+func numLeaves*(tree: MerkleTree): int {.inline.} =
+  tree.numLeaves
+
+func root*(tree: MerkleTree): array[32, byte] {.inline.} =
+  ## Returns the Merkle root of the tree
+  if tree.numLeaves == 0:
+    ZeroHashes[tree.depth]
+  else:
+    tree.levelNodes(tree.depth)[0]
+
+func allocateLeaves*(
+       tree: var MerkleTree,
+       leaves: openArray[array[32, byte]],
+       limit = -1): MerkleStatus {.tags:[HeapAlloc].} =
+  ## Allocate a Merkle tree and copy the leaves.
+  ## Inner nodes are not computed.
+  ##
+  ## This is a low-level building block,
+  ## use `init` or `init_parallel` instead.
+  let limit = if limit < 0: leaves.len else: limit
+  if leaves.len > limit:
+    return Merkle_TooManyChunks
+
+  if tree.nodes != nil:
+    freeHeapAligned(tree.nodes)
+    tree.nodes = nil
+  tree.numLeaves = leaves.len
+  tree.depth = merkleDepth(limit)
+
+  var total = 0
+  for level in 0 .. tree.depth:
+    tree.levelOffsets[level] = total
+    total += tree.levelLen(level)
+
+  if total == 0:
+    return Merkle_Success
+
+  tree.nodes = allocHeapArrayAligned(array[32, byte], total, alignment = 64)
+  for i in 0 ..< leaves.len:
+    tree.nodes[i] = leaves[i]
+  return Merkle_Success
+
+func init*(
+       tree: var MerkleTree,
+       leaves: openArray[array[32, byte]],
+       limit = -1): MerkleStatus {.tags:[HeapAlloc], meter.} =
+  ## Build a Merkle tree over `leaves`
+  ## padded with zero leaves to the next power of 2 of `limit`.
+  ## If `limit` is negative, `leaves.len` is used as the limit.
+  let status = tree.allocateLeaves(leaves, limit)
+  if status != Merkle_Success:
+    return status
+
+  if tree.numLeaves == 0:
+    return Merkle_Success
+  for level in 0 ..< tree.depth:
+    hashLevelPadded(
+      tree.levelNodes(level+1), tree.levelNodes(level),
+      tree.levelLen(level), level)
+  return Merkle_Success
+
+func hashParent(tree: var MerkleTree, level, parent: int) {.inline.} =
+  ## Recompute the node `parent` at `level`+1 from its children
+  let children = tree.levelNodes(level)
+  let left = 2*parent
+  var buf {.noInit.}: array[64, byte]
+  if left+1 < tree.levelLen(level):
+    buf.concat(children[left], children[left+1])
+  else:
+    buf.concat(children[left], ZeroHashes[level])
+  sha256.hash_64B(tree.levelNodes(level+1)[parent], buf)
+
+func update*(
+       tree: var MerkleTree,
+       index: int,
+       leaf: array[32, byte]): MerkleStatus =
+  ## Replace the leaf at `index` and update the root
+  if index notin 0 ..< tree.numLeaves:
+    return Merkle_IndexOutOfBounds
+
+  tree.nodes[index] = leaf
+  var i = index
+  for level in 0 ..< tree.depth:
+    i = i shr 1
+    tree.hashParent(level, i)
+  return Merkle_Success
+
+func update*(
+       tree: var MerkleTree,
+       indices: openArray[int],
+       leaves: openArray[array[32, byte]]): MerkleStatus {.tags:[HeapAlloc], meter.} =
+  ## Replace the leaves at `indices` and update the root.
+  ##
+  ## Dirty nodes are rehashed level by level in batches.
+  ## Sorted indices avoid rehashing shared ancestors multiple times.
+  if indices.len != leaves.len:
+    return Merkle_InputsLengthsMismatch
+  for i in indices:
+    if i notin 0 ..< tree.numLeaves:
+      return Merkle_IndexOutOfBounds
+  if indices.len == 0:
+    return Merkle_Success
+
+  for k in 0 ..< indices.len:
+    tree.nodes[indices[k]] = leaves[k]
+
+  let dirty = allocHeapArray(int, indices.len)
+  let messages = allocHeapArrayAligned(array[64, byte], indices.len, alignment = 64)
+  let digests = allocHeapArrayAligned(array[32, byte], indices.len, alignment = 64)
+  for k in 0 ..< indices.len:
+    dirty[k] = indices[k]
+  var n = indices.len
+
+  for level in 0 ..< tree.depth:
+    # Dirty parents, consecutive duplicates are merged in-place.
+    var m = 0
+    for k in 0 ..< n:
+      let p = dirty[k] shr 1
+      if m == 0 or dirty[m-1] != p:
+        dirty[m] = p
+        m += 1
+    n = m
+
+    let children = tree.levelNodes(level)
+    let len = tree.levelLen(level)
+    for k in 0 ..< n:
+      let left = 2*dirty[k]
+      if left+1 < len:
+        messages[k].concat(children[left], children[left+1])
+      else:
+        messages[k].concat(children[left], ZeroHashes[level])
+
+    sha256.hashMany(digests, cast[ptr UncheckedArray[byte]](messages), msgLen = 64, numMessages = n)
+
+    let parents = tree.levelNodes(level+1)
+    for k in 0 ..< n:
+      parents[dirty[k]] = digests[k]
+
+  freeHeap(dirty)
+  freeHeapAligned(messages)
+  freeHeapAligned(digests)
+  return Merkle_Success
@@ -0,0 +1,134 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+when not compileOption("threads"):
+  {.error: "This requires --threads:on compilation flag".}
+
+import
+  constantine/platforms/abstractions,
+  constantine/threadpool/[threadpool, partitioners],
+  ./merkle_sha256
+
+export merkle_sha256
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# ############################################################
+#
+#              SHA256 binary Merkle trees
+#                  Parallel Edition
+#
+# ############################################################
+
+# Each level is split into contiguous ranges of parents, one task per range.
+# Small levels, near the root, are hashed on the caller thread
+# as the scheduling overhead would dominate.
+
+const merkleParallelMinPairs* = 1024
+  ## Minimum number of parents per task
+
+proc hashLevelPadded_parallel(
+       tp: Threadpool,
+       parents: ptr UncheckedArray[array[32, byte]],
+       children: ptr UncheckedArray[array[32, byte]],
+       numChildren: int,
+       level: int) =
+  ## Hash a level with `numChildren` nodes at height `level` in the tree
+  ## into its ⌈numChildren/2⌉ parents.
+  ##
+  ## `parents` MUST NOT alias `children`.
+  let numPairs = numChildren shr 1
+  if numPairs < 2*merkleParallelMinPairs:
+    hashLevelPadded(parents, children, numChildren, level)
+    return
+
+  let chunkDesc = balancedChunksPrioNumber(
+    start = 0, stopEx = numPairs,
+    numChunks = min(tp.numThreads.int, numPairs div merkleParallelMinPairs))
+
+  syncScope:
+    for iter in items(chunkDesc):
+      proc hashLevel_wrapper(
+             parents: ptr UncheckedArray[array[32, byte]],
+             children: ptr UncheckedArray[array[32, byte]],
+             numParents: int) {.nimcall.} =
+        hashLevel(parents, children, numParents)
+
+      tp.spawn hashLevel_wrapper(
+        parents +% iter.start, children +% (2*iter.start), iter.size)
+
+  if (numChildren and 1) == 1:
+    hashLevelPadded(parents +% numPairs, children +% (2*numPairs), 1, level)
+
+proc merkleize_parallel*(
+       tp: Threadpool,
+       root: var array[32, byte],
+       chunks: openArray[array[32, byte]],
+       limit = -1): MerkleStatus =
+  ## Compute the Merkle root of `chunks`
+  ## padded with zero chunks to the next power of 2 of `limit`.
+  ## If `limit` is negative, `chunks.len` is used as the limit.
+  ##
+  ## This is SSZ `merkleize(chunks, limit)`.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let limit = if limit < 0: chunks.len else: limit
+  if chunks.len > limit:
+    return Merkle_TooManyChunks
+
+  let depth = merkleDepth(limit)
+  if chunks.len == 0:
+    root = zeroHash(depth)
+    return Merkle_Success
+  if depth == 0:
+    root = chunks[0]
+    return Merkle_Success
+
+  # Tasks hash disjoint ranges of a level concurrently,
+  # levels cannot be hashed in-place, we ping-pong between 2 buffers.
+  let bufLen = (chunks.len+1) shr 1
+  let buf0 = allocHeapArrayAligned(array[32, byte], bufLen, alignment = 64)
+  let buf1 = allocHeapArrayAligned(array[32, byte], bufLen, alignment = 64)
+
+  var src = chunks.asUnchecked()
+  var dst = buf0
+  var n = chunks.len
+  for level in 0 ..< depth:
+    tp.hashLevelPadded_parallel(dst, src, n, level)
+    src = dst
+    dst = if dst == buf0: buf1 else: buf0
+    n = (n+1) shr 1
+
+  root = src[0]
+  freeHeapAligned(buf0)
+  freeHeapAligned(buf1)
+  return Merkle_Success
+
+proc init_parallel*(
+       tp: Threadpool,
+       tree: var MerkleTree,
+       leaves: openArray[array[32, byte]],
+       limit = -1): MerkleStatus =
+  ## Build a Merkle tree over `leaves`
+  ## padded with zero leaves to the next power of 2 of `limit`.
+  ## If `limit` is negative, `leaves.len` is used as the limit.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let status = tree.allocateLeaves(leaves, limit)
+  if status != Merkle_Success:
+    return status
+
+  if tree.numLeaves == 0:
+    return Merkle_Success
+  for level in 0 ..< tree.depth:
+    tp.hashLevelPadded_parallel(
+      tree.levelNodes(level+1), tree.levelNodes(level),
+      tree.levelLen(level), level)
+  return Merkle_Success
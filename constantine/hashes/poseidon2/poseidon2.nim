@@ -0,0 +1,287 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/abstractions,
+  constantine/named/[algebras, zoo_poseidon2],
+  constantine/math/arithmetic
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# ############################################################
+#
+#                  Poseidon2 permutation
+#
+# ############################################################
+
+# References:
+# - Poseidon2: A Faster Version of the Poseidon Hash Function
+#   Lorenzo Grassi, Dmitry Khovratovich, Markus Schofnegger, 2023
+#   https://eprint.iacr.org/2023/323
+# - Reference implementation
+#   https://github.com/HorizenLabs/poseidon2
+#
+# The permutation over a state of t field elements is
+#   Mₑ, RF/2 full rounds, RP partial rounds, RF/2 full rounds
+# with
+# - full round:    add t round constants, S-box x ↦ x^α on every element, external layer Mₑ
+# - partial round: add a round constant to s₀, S-box on s₀, internal layer Mᵢ
+#
+# The external layer is the circulant-like matrix built on the 4x4 MDS M₄ of the paper,
+# for t = 3 it is [[2, 1, 1], [1, 2, 1], [1, 1, 2]].
+# The internal layer is 1 + diag(d), sᵢ ↦ sᵢ.dᵢ + ∑s.
+#
+# Constants are generated by sage/derive_poseidon2.sage
+# The instances over the BN254 scalar field (t = 3) and Goldilocks (t = 8)
+# match the known-answer tests of the reference implementation.
+#
+# Batching
+# --------
+#
+# The partial rounds are a long chain of dependent multiplications on s₀.
+# `permuteMany` interleaves independent states round by round
+# to expose instruction-level parallelism to the CPU and the compiler.
+
+type poseidon2* = object
+  ## Poseidon2 permutation over a prime field
+
+const Poseidon2Lanes = 4
+  ## Number of states interleaved by the batched API
+
+# Parameters
+# ------------------------------------------------------------
+
+template width*(H: type poseidon2, F: typedesc): int =
+  ## Number of field elements of a Poseidon2 state
+  poseidon2Const(F.Name, Width)
+
+template digestLen*(H: type poseidon2, F: typedesc): int =
+  ## Number of field elements of a Poseidon2 2-to-1 compression output.
+  ## The width 3 instances compress 2 elements into 1 with 1 element of capacity,
+  ## the others compress 2 halves of the state into 1.
+  when poseidon2.width(F) == 3: 1
+  else: poseidon2.width(F) div 2
+
+template checkInstance(N: static int, F: typedesc) =
+  when not F.Name.hasPoseidon2():
+    {.error: "Poseidon2 is not defined over " & $F.Name.}
+  when F isnot typeof(poseidon2Const(F.Name, PartialRoundConstants)[0]):
+    {.error: "Poseidon2 over " & $F.Name & " is not defined over this field, use Fp or Fr accordingly".}
+  when N != poseidon2Const(F.Name, Width):
+    {.error: "Poseidon2 over " & $F.Name & " has a state of " & $poseidon2Const(F.Name, Width) & " elements".}
+
+func sbox[F](x: var F) {.inline.} =
+  ## x ↦ x^α
+  const alpha = poseidon2Const(F.Name, Alpha)
+  var x2 {.noInit.}: F
+  x2.square(x)
+  when alpha == 3:
+    x *= x2
+  elif alpha == 5:
+    x2.square()
+    x *= x2
+  elif alpha == 7:
+    var x3 {.noInit.}: F
+    x3.prod(x2, x)
+    x2.square()
+    x.prod(x2, x3)
+  else:
+    {.error: "Unsupported Poseidon2 S-box exponent " & $alpha.}
+
+# Linear layers
+# ------------------------------------------------------------
+
+func m4[N: static int, F](s: var array[N, F], o: static int) {.inline.} =
+  ## Multiply s[o ..< o+4] by the Poseidon2 M₄ matrix
+  ##   [5 7 1 3]
+  ##   [4 6 1 1]
+  ##   [1 3 5 7]
+  ##   [1 1 4 6]
+  ## with 8 additions and 4 doublings (paper appendix B)
+  var t0 {.noInit.}, t1 {.noInit.}, t2 {.noInit.}, t3 {.noInit.}: F
+  var t4 {.noInit.}, t5 {.noInit.}, t6 {.noInit.}, t7 {.noInit.}: F
+  t0.sum(s[o], s[o+1])
+  t1.sum(s[o+2], s[o+3])
+  t2.double(s[o+1])
+  t2.sum(t2, t1)
+  t3.double(s[o+3])
+  t3.sum(t3, t0)
+  t4.double(t1)
+  t4.double(t4)
+  t4.sum(t4, t3)
+  t5.double(t0)
+  t5.double(t5)
+  t5.sum(t5, t2)
+  t6.sum(t3, t5)
+  t7.sum(t2, t4)
+  s[o] = t6
+  s[o+1] = t5
+  s[o+2] = t7
+  s[o+3] = t4
+
+func externalLinearLayer[N: static int, F](s: var array[N, F]) {.inline.} =
+  when N == 3:
+    var acc {.noInit.}: F
+    acc.sum(s[0], s[1])
+    acc.sum(acc, s[2])
+    staticFor i, 0, N:
+      s[i].sum(s[i], acc)
+  else:
+    static: doAssert N mod 4 == 0
+    staticFor j, 0, N div 4:
+      s.m4(4*j)
+    # Circulant layer: sᵢ ↦ sᵢ + ∑ⱼ s[4j + (i mod 4)]
+    var sums {.noInit.}: array[4, F]
+    staticFor l, 0, 4:
+      sums[l] = s[l]
+      staticFor j, 1, N div 4:
+        sums[l].sum(sums[l], s[4*j+l])
+    staticFor i, 0, N:
+      s[i].sum(s[i], sums[i mod 4])
+
+func internalLinearLayer[N: static int, F](s: var array[N, F]) {.inline.} =
+  var acc {.noInit.}: F
+  acc.sum(s[0], s[1])
+  staticFor i, 2, N:
+    acc.sum(acc, s[i])
+
+  when N == 3:
+    # diag(1, 1, 2)
+    s[0].sum(s[0], acc)
+    s[1].sum(s[1], acc)
+    s[2].double(s[2])
+    s[2].sum(s[2], acc)
+  else:
+    const diag = poseidon2Const(F.Name, InternalDiagMinus1)
+    staticFor i, 0, N:
+      s[i].prod(s[i], diag[i])
+      s[i].sum(s[i], acc)
+
+# Rounds
+# ------------------------------------------------------------
+
+func fullRound[N: static int, F](s: var array[N, F], r: int) {.inline.} =
+  const rc = poseidon2Const(F.Name, FullRoundConstants)
+  staticFor i, 0, N:
+    s[i].sum(s[i], rc[r][i])
+    s[i].sbox()
+  s.externalLinearLayer()
+
+func partialRound[N: static int, F](s: var array[N, F], r: int) {.inline.} =
+  const rc = poseidon2Const(F.Name, PartialRoundConstants)
+  s[0].sum(s[0], rc[r])
+  s[0].sbox()
+  s.internalLinearLayer()
+
+template permuteImpl(states: untyped, numStates: static int, F: typedesc): untyped =
+  ## Apply the permutation to `numStates` states indexed by `states[l]`
+  ## interleaved round by round.
+  const RF = poseidon2Const(F.Name, FullRounds)
+  const RP = poseidon2Const(F.Name, PartialRounds)
+
+  staticFor l, 0, numStates:
+    states[l].externalLinearLayer()
+  for r in 0 ..< RF div 2:
+    staticFor l, 0, numStates:
+      states[l].fullRound(r)
+  for r in 0 ..< RP:
+    staticFor l, 0, numStates:
+      states[l].partialRound(r)
+  for r in RF div 2 ..< RF:
+    staticFor l, 0, numStates:
+      states[l].fullRound(r)
+
+# Public API
+# ------------------------------------------------------------
+
+func permute*[N: static int, F](H: type poseidon2, state: var array[N, F]) =
+  ## Apply the Poseidon2 permutation to `state`
+  checkInstance(N, F)
+  let s = cast[ptr UncheckedArray[array[N, F]]](state.addr)
+  permuteImpl(s, 1, F)
+
+func permuteMany*[N: static int, F](H: type poseidon2, states: var openArray[array[N, F]]) =
+  ## Apply the Poseidon2 permutation to each of `states`
+  checkInstance(N, F)
+  var i = 0
+  while i + Poseidon2Lanes <= states.len:
+    let lanes = states.asUnchecked() +% i
+    permuteImpl(lanes, Poseidon2Lanes, F)
+    i += Poseidon2Lanes
+  while i < states.len:
+    H.permute(states[i])
+    i += 1
+
+func loadPair[N, D: static int, F](s: var array[N, F], left, right: array[D, F]) {.inline.} =
+  staticFor i, 0, D:
+    s[i] = left[i]
+    s[D+i] = right[i]
+  staticFor i, 2*D, N:
+    s[i].setZero()
+
+func compress*[D: static int, F](H: type poseidon2, dst: var array[D, F], left, right: array[D, F]) =
+  ## 2-to-1 compression for Merkle trees.
+  ## `dst` is the first `D` elements of Poseidon2([left, right, 0, ...])
+  ## with `D` = poseidon2.digestLen(F).
+  ##
+  ## This is a truncated permutation, without feed-forward,
+  ## it is collision-resistant when `D` elements are truncated away.
+  const N = poseidon2.width(F)
+  checkInstance(N, F)
+  static: doAssert D == poseidon2.digestLen(F)
+  var s {.noInit.}: array[N, F]
+  s.loadPair(left, right)
+  H.permute(s)
+  staticFor i, 0, D:
+    dst[i] = s[i]
+
+func compressMany*[D: static int, F](
+       H: type poseidon2,
+       parents: ptr UncheckedArray[array[D, F]],
+       children: ptr UncheckedArray[array[D, F]],
+       numParents: int) =
+  ## parents[i] = poseidon2.compress(children[2i], children[2i+1])
+  ## for i in [0, numParents)
+  ##
+  ## This hashes a level of a Merkle tree.
+  ## `parents` may alias `children` for in-place hashing.
+  const N = poseidon2.width(F)
+  checkInstance(N, F)
+  static: doAssert D == poseidon2.digestLen(F)
+
+  var lanes {.noInit.}: array[Poseidon2Lanes, array[N, F]]
+  var i = 0
+  while i + Poseidon2Lanes <= numParents:
+    # All children of the batch are loaded before any parent is written
+    # so that parents[i] may alias children[i]
+    staticFor l, 0, Poseidon2Lanes:
+      lanes[l].loadPair(children[2*(i+l)], children[2*(i+l)+1])
+    permuteImpl(lanes, Poseidon2Lanes, F)
+    staticFor l, 0, Poseidon2Lanes:
+      staticFor j, 0, D:
+        parents[i+l][j] = lanes[l][j]
+    i += Poseidon2Lanes
+
+  while i < numParents:
+    var digest {.noInit.}: array[D, F]
+    H.compress(digest, children[2*i], children[2*i+1])
+    parents[i] = digest
+    i += 1
+
+func compressMany*[D: static int, F](
+       H: type poseidon2,
+       parents: var openArray[array[D, F]],
+       children: openArray[array[D, F]]) =
+  ## parents[i] = poseidon2.compress(children[2i], children[2i+1])
+  ## `children.len` MUST be `2*parents.len`.
+  if parents.len == 0:
+    return
+  debug: doAssert children.len == 2*parents.len
+  H.compressMany(parents.asUnchecked(), children.asUnchecked(), parents.len)
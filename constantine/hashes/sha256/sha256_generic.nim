@@ -40,6 +40,11 @@ type Sha256_MessageSchedule* = object
 type Sha256_state* = object
   H*{.align: 64.}: array[Sha256_HashSize, Sha256_Word]
 
+const Sha256_IV* = [
+  0x6a09e667'u32, 0xbb67ae85'u32, 0x3c6ef372'u32, 0xa54ff53a'u32,
+  0x510e527f'u32, 0x9b05688c'u32, 0x1f83d9ab'u32, 0x5be0cd19'u32
+]
+
 const K256* = [
   0x428a2f98'u32, 0x71374491'u32, 0xb5c0fbcf'u32, 0xe9b5dba5'u32, 0x3956c25b'u32, 0x59f111f1'u32, 0x923f82a4'u32, 0xab1c5ed5'u32,
   0xd807aa98'u32, 0x12835b01'u32, 0x243185be'u32, 0x550c7dc3'u32, 0x72be5d74'u32, 0x80deb1fe'u32, 0x9bdc06a7'u32, 0xc19bf174'u32,
@@ -168,3 +173,56 @@ func hashMessageBlocks_generic*(
 
     s.accumulate(H) # accumulate on register variables
     H.copy(s)
+
+# Merkle trees 2-to-1 compression
+# ------------------------------------------------
+#
+# Merkle trees hash 64-byte messages, 2 children of 32 bytes.
+# The second block of those messages is only padding:
+# 0x80, zeros and the message length in bits (512).
+# Its message schedule is a constant that we precompute
+# together with the round constants.
+
+func computeKW_Padding_64B(): array[64, Sha256_Word] {.compileTime.} =
+  var w: array[64, Sha256_Word]
+  w[0] = 0x80000000'u32
+  w[15] = 512
+  for t in 16 ..< 64:
+    w[t] = s1(w[t-2]) + w[t-7] + s0(w[t-15]) + w[t-16]
+  for t in 0 ..< 64:
+    result[t] = K256[t] + w[t]
+
+const KW_Padding_64B* = computeKW_Padding_64B()
+  ## K256[t] + W[t] for the padding block of 64-byte messages
+
+func hashPaddingBlock_64B_generic*(H: var Sha256_state) =
+  ## Hash the padding block of a 64-byte message
+  var s{.noInit.}: Sha256_state
+  s.copy(H)
+
+  staticFor t, 0, 64:
+    sha256_round(s, KW_Padding_64B[t], 0'u32)
+
+  s.accumulate(H)
+  H.copy(s)
+
+func hashMessageBlock_compileTime*(
+       H: var Sha256_state,
+       message: array[Sha256_BlockSize, byte]) {.compileTime.} =
+  ## Hash a single message block
+  ## This does not use pointers and can be used in the Nim VM
+  ## for precomputed constants.
+  var ms: Sha256_MessageSchedule
+  var s = H
+
+  for t in 0 ..< 16:
+    ms.w[t] = uint32.fromBytes(message, t * sizeof(Sha256_Word), bigEndian)
+    sha256_round(s, ms.w[t], K256[t])
+  for t in 16 ..< 64:
+    ms.w[t and 15] += s1(ms.w[(t -  2) and 15])+
+                         ms.w[(t -  7) and 15] +
+                      s0(ms.w[(t - 15) and 15])
+    sha256_round(s, ms.w[t and 15], K256[t])
+
+  s.accumulate(H)
+  H.copy(s)
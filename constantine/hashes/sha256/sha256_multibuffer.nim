@@ -0,0 +1,84 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/primitives,
+  constantine/serialization/endians,
+  ./sha256_generic
+
+# SHA256, multi-buffer helpers
+# --------------------------------------------------------------------------------
+#
+# References:
+# - Processing Multiple Buffers in Parallel to Increase Performance
+#   on Intel® Architecture Processors
+#   Jim Guilford, Vinodh Gopal, Kirk Yap, Wajdi Feghali, 2010
+# - Fast SHA-256 Implementations on Intel® Architecture Processors
+#   https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/sha-256-implementations-paper.pdf
+#
+# Multi-buffer hashing processes N independent messages of the same length
+# with one SIMD lane per message. The 32-bit words of each message
+# are transposed so that a vector register holds the same word of every message
+# and the 64 rounds are then computed "vertically" with plain SIMD integer ops.
+#
+# This file holds the scalar parts shared by all lane widths:
+# gathering message words, padding the last blocks and scattering the digests.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+type
+  Sha256_MultiBufferTail*[Lanes: static int] = object
+    ## Padded last block(s) of each message
+    buf{.align: 64.}: array[Lanes, array[2*Sha256_BlockSize, byte]]
+    numBlocks*: int
+
+func gatherWords*[Lanes: static int](
+       dst: var array[Lanes, Sha256_Word],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       offset: int) {.inline.} =
+  ## Load the big-endian word at `offset` of each message
+  for l in 0 ..< Lanes:
+    dst[l] = Sha256_Word.fromBytes(messages[l], offset, bigEndian)
+
+func scatterWords*[Lanes: static int](
+       digests: array[Lanes, ptr array[Sha256_DigestSize, byte]],
+       src: array[Lanes, Sha256_Word],
+       wordIdx: int) {.inline.} =
+  ## Store the word `wordIdx` of each digest
+  for l in 0 ..< Lanes:
+    digests[l][].dumpRawInt(src[l], wordIdx * sizeof(Sha256_Word), bigEndian)
+
+func init*[Lanes: static int](
+       tail: var Sha256_MultiBufferTail[Lanes],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       msgLen: int) =
+  ## Copy the incomplete last block of each message
+  ## and apply SHA256 padding.
+  ## This results in 1 or 2 extra blocks per message.
+  let fullBlocks = msgLen div Sha256_BlockSize
+  let tailLen = msgLen mod Sha256_BlockSize
+
+  # Add '1' bit at the end of the message (+7 zero bits)
+  # then k zero bits so that msgLen + 1 + K ≡ 56 mod 64 (in bytes)
+  # and finally the message length in bits.
+  const padZone = 56
+  tail.numBlocks = if tailLen < padZone: 1 else: 2
+  let lenInBits = uint64(msgLen) * 8
+
+  for l in 0 ..< Lanes:
+    tail.buf[l].setZero()
+    for i in 0 ..< tailLen:
+      tail.buf[l][i] = messages[l][fullBlocks*Sha256_BlockSize + i]
+    tail.buf[l][tailLen] = 0b1000_0000
+    tail.buf[l].dumpRawInt(lenInBits, tail.numBlocks*Sha256_BlockSize - 8, bigEndian)
+
+func lanes*[Lanes: static int](tail: var Sha256_MultiBufferTail[Lanes]): array[Lanes, ptr UncheckedArray[byte]] {.inline.} =
+  for l in 0 ..< Lanes:
+    result[l] = tail.buf[l].asUnchecked()
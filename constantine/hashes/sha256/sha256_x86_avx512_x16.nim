@@ -0,0 +1,163 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/isa_x86/simd_x86,
+  constantine/platforms/primitives,
+  ./sha256_generic,
+  ./sha256_multibuffer
+
+{.localpassC:"-mavx512f".}
+
+# SHA256, AVX512 multi-buffer, 16 messages in parallel
+# --------------------------------------------------------------------------------
+#
+# See sha256_multibuffer.nim for references.
+# Lane i of each 512-bit register holds the state or message word of message i.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+const Lanes = 16
+
+# Primitives
+# ------------------------------------------------
+
+# The ternary logic instruction evaluates any 3-input boolean function
+# given its truth table, indexed by (x shl 2) or (y shl 1) or z:
+# - ch:   0xCA
+# - maj:  0xE8
+# - xor3: 0x96
+
+template ch(x, y, z: m512i): m512i =
+  ternlog_u32x16(x, y, z, 0xCA)
+
+template maj(x, y, z: m512i): m512i =
+  ternlog_u32x16(x, y, z, 0xE8)
+
+template xor3(x, y, z: m512i): m512i =
+  ternlog_u32x16(x, y, z, 0x96)
+
+template S0(x: m512i): m512i =
+  xor3(ror_u32x16(x, 2), ror_u32x16(x, 13), ror_u32x16(x, 22))
+
+template S1(x: m512i): m512i =
+  xor3(ror_u32x16(x, 6), ror_u32x16(x, 11), ror_u32x16(x, 25))
+
+template s0(x: m512i): m512i =
+  xor3(ror_u32x16(x, 7), ror_u32x16(x, 18), shr_u32x16(x, 3))
+
+template s1(x: m512i): m512i =
+  xor3(ror_u32x16(x, 17), ror_u32x16(x, 19), shr_u32x16(x, 10))
+
+template sha256_round(a, b, c, d, e, f, g, h: untyped, kw: m512i) =
+  ## SHA256 round, kw = K256[t] + W[t]
+  let T1 = add_u32x16(add_u32x16(h, S1(e)), add_u32x16(ch(e, f, g), kw))
+  let T2 = add_u32x16(S0(a), maj(a, b, c))
+  h = g
+  g = f
+  f = e
+  e = add_u32x16(d, T1)
+  d = c
+  c = b
+  b = a
+  a = add_u32x16(T1, T2)
+
+# Hash Computation
+# ------------------------------------------------
+
+func compress(
+       H: var array[8, m512i],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       offset: int) =
+  ## Process one 64-byte block of each message
+  var w{.noInit.}: array[16, m512i]
+  var buf{.noInit, align: 64.}: array[Lanes, Sha256_Word]
+
+  var a = H[0]
+  var b = H[1]
+  var c = H[2]
+  var d = H[3]
+  var e = H[4]
+  var f = H[5]
+  var g = H[6]
+  var h = H[7]
+
+  staticFor t, 0, 16:
+    buf.gatherWords(messages, offset + t * sizeof(Sha256_Word))
+    w[t] = loada_u512(buf[0].addr)
+    sha256_round(a, b, c, d, e, f, g, h, add_u32x16(w[t], set1_u32x16(K256[t])))
+
+  staticFor t, 16, 64:
+    w[t and 15] = add_u32x16(
+      add_u32x16(w[t and 15], s1(w[(t - 2) and 15])),
+      add_u32x16(w[(t - 7) and 15], s0(w[(t - 15) and 15])))
+    sha256_round(a, b, c, d, e, f, g, h, add_u32x16(w[t and 15], set1_u32x16(K256[t])))
+
+  H[0] = add_u32x16(H[0], a)
+  H[1] = add_u32x16(H[1], b)
+  H[2] = add_u32x16(H[2], c)
+  H[3] = add_u32x16(H[3], d)
+  H[4] = add_u32x16(H[4], e)
+  H[5] = add_u32x16(H[5], f)
+  H[6] = add_u32x16(H[6], g)
+  H[7] = add_u32x16(H[7], h)
+
+func compressPadding_64B(H: var array[8, m512i]) =
+  ## Process the padding block of 64-byte messages
+  ## Its message schedule is a constant.
+  var a = H[0]
+  var b = H[1]
+  var c = H[2]
+  var d = H[3]
+  var e = H[4]
+  var f = H[5]
+  var g = H[6]
+  var h = H[7]
+
+  staticFor t, 0, 64:
+    sha256_round(a, b, c, d, e, f, g, h, set1_u32x16(KW_Padding_64B[t]))
+
+  H[0] = add_u32x16(H[0], a)
+  H[1] = add_u32x16(H[1], b)
+  H[2] = add_u32x16(H[2], c)
+  H[3] = add_u32x16(H[3], d)
+  H[4] = add_u32x16(H[4], e)
+  H[5] = add_u32x16(H[5], f)
+  H[6] = add_u32x16(H[6], g)
+  H[7] = add_u32x16(H[7], h)
+
+func hashMessages_avx512_x16*(
+       digests: array[Lanes, ptr array[Sha256_DigestSize, byte]],
+       messages: array[Lanes, ptr UncheckedArray[byte]],
+       msgLen: int) =
+  ## Hash 16 messages of the same length `msgLen`
+  ## and store their digests in `digests`
+  var H{.noInit.}: array[8, m512i]
+  staticFor i, 0, 8:
+    H[i] = set1_u32x16(Sha256_IV[i])
+
+  if msgLen == Sha256_BlockSize:
+    # Merkle trees 2-to-1 compression
+    H.compress(messages, 0)
+    H.compressPadding_64B()
+  else:
+    for blck in 0 ..< msgLen div Sha256_BlockSize:
+      H.compress(messages, blck * Sha256_BlockSize)
+
+    var tail{.noInit.}: Sha256_MultiBufferTail[Lanes]
+    tail.init(messages, msgLen)
+    let tails = tail.lanes()
+    for blck in 0 ..< tail.numBlocks:
+      H.compress(tails, blck * Sha256_BlockSize)
+
+  var buf{.noInit, align: 64.}: array[Lanes, Sha256_Word]
+  staticFor i, 0, 8:
+    storea_u512(buf[0].addr, H[i])
+    digests.scatterWords(buf, i)
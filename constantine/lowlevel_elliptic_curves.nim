@@ -138,6 +138,7 @@ export zoo_subgroups.isInSubgroup
 export hash_to_curve.hashToCurve
 export hash_to_curve.hashToCurve_svdw
 export hash_to_curve.hashToCurve_sswu
+export hash_to_curve.hashToCurve_batch
 
 # Out-of-place functions SHOULD NOT be used in performance-critical subroutines as compilers
 # tend to generate useless memory moves or have difficulties to minimize stack allocation
@@ -17,7 +17,8 @@ import
       miller_accumulators,
       pairings_generic,
       gt_exponentiations,
-      gt_exponentiations_vartime]
+      gt_exponentiations_vartime,
+      gt_exponentiations_fixed_base]
 # ############################################################
 #
 #       Low-level named Pairing-Friendly Curve API
@@ -74,9 +75,17 @@ export zoo_pairings.isInPairingSubgroup
 export pairings_generic.pairing
 export pairings_generic.millerLoop
 export pairings_generic.finalExp
+export pairings_generic.PreparedG2
+export pairings_generic.prepare
 
 export gt_exponentiations.gtExp
 export gt_exponentiations_vartime.gtExp_vartime
+export gt_exponentiations_fixed_base.GtFixedBaseTable
+export gt_exponentiations_fixed_base.GtFixedBaseTorusTable
+export gt_exponentiations_fixed_base.init
+export gt_exponentiations_fixed_base.compress
+export gt_exponentiations_fixed_base.gtExp_fixedBase
+export gt_exponentiations_fixed_base.gtExp_fixedBase_vartime
 
 # Out-of-place functions SHOULD NOT be used in performance-critical subroutines as compilers
 # tend to generate useless memory moves or have difficulties to minimize stack allocation
@@ -0,0 +1,36 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  ./threadpool,
+  ./math/pairings/pairings_generic_parallel
+
+# ############################################################
+#
+#       Low-level named Pairing-Friendly Curve Parallel API
+#
+# ############################################################
+
+# Warning ⚠️:
+#     The low-level APIs have no stability guarantee.
+#     Use high-level protocols which are designed according to a stable specs
+#     and with misuse resistance in mind.
+
+# Threadpool
+# ------------------------------------------------------------
+
+export threadpool.Threadpool
+export threadpool.new
+export threadpool.shutdown
+
+# Pairings
+# ------------------------------------------------------------
+
+export pairings_generic_parallel.multiMillerLoop_parallel
+export pairings_generic_parallel.pairing_parallel
+export pairings_generic_parallel.pairing_check_parallel
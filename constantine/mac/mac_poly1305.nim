@@ -15,6 +15,9 @@ import
 when UseASM_X86_64:
   import ../math/arithmetic/assembly/limbs_asm_modular_x86
 
+when UseASM_X86_32:
+  import ./poly1305_x86_avx2
+
 # No exceptions allowed
 {.push raises: [].}
 
@@ -154,6 +157,8 @@ type Poly1305_CTX = object
   buf: array[BlockSize, byte]
   msgLen: uint64
   bufIdx: uint8
+  when UseASM_X86_32:
+    rPow: array[4, array[5, uint64]] # r¹, r², r³, r⁴ in radix 2²⁶ for AVX2
 
 type poly1305* = Poly1305_CTX
 
@@ -191,6 +196,45 @@ func macMessageBlocks(
 
   return BlockSize * numBlocks.uint
 
+when UseASM_X86_32:
+  const AVX2_MinBytes = uint(16*BlockSize)
+    ## Below 16 blocks, radix conversions outweigh the 4-way parallelism
+
+  func computePowers_radix26(rPow: var array[4, array[5, uint64]], r: BigInt[124]) =
+    ## Precompute r¹, r², r³, r⁴ (mod 2¹³⁰-5) in radix 2²⁶
+    var buf{.noInit.}: array[17, byte]
+    var p{.noInit.}: BigInt[130+1]
+    var t{.noInit.}: BigInt[130+1+124]
+
+    p.setZero()
+    staticFor i, 0, r.limbs.len:
+      p.limbs[i] = r.limbs[i]
+
+    for k in 0 ..< 4:
+      if k > 0:
+        t.prod(p, r)
+        p.limbs.partialReduce_1305(t.limbs)
+        p.limbs.finalReduce_1305()
+      buf.marshal(p, littleEndian)
+      rPow[k].toRadix26(buf)
+
+  func macMessageBlocks_avx2(ctx: var Poly1305_CTX, message: openArray[byte]): uint =
+    ## Authenticate a message 4 blocks at a time.
+    ## Return the number of bytes processed, a multiple of 64.
+    let numBlocks = (message.len div (4*BlockSize)) * 4
+    if numBlocks == 0:
+      return 0
+
+    var buf{.noInit.}: array[17, byte]
+    var h{.noInit.}: array[5, uint64]
+    buf.marshal(ctx.acc, littleEndian)
+    h.toRadix26(buf)
+    h.poly1305_macBlocks_avx2_x4(ctx.rPow, message.asUnchecked(), numBlocks)
+    buf.fromRadix26(h)
+    ctx.acc.unmarshal(buf, littleEndian)
+
+    return uint(BlockSize * numBlocks)
+
 func macBuffer(ctx: var Poly1305_CTX, blockSize: int) =
   discard ctx.acc.macMessageBlocks(
     ctx.r, ctx.buf, blockSize
@@ -217,6 +261,10 @@ func init*(ctx: var Poly1305_CTX, nonReusedKey: array[32, byte]) =
   ctx.msgLen = 0
   ctx.bufIdx = 0
 
+  when UseASM_X86_32:
+    if ({.noSideEffect.}: hasAvx2()):
+      ctx.rPow.computePowers_radix26(ctx.r)
+
 func update*(ctx: var Poly1305_CTX, message: openArray[byte]) {.genCharAPI.} =
   ## Append a message to a Poly1305 authentication context.
   ## for incremental Poly1305 computation
@@ -260,6 +308,14 @@ func update*(ctx: var Poly1305_CTX, message: openArray[byte]) {.genCharAPI.} =
       cur = free
       bytesLeft -= free
 
+  when UseASM_X86_32:
+    # Process 4n blocks (64 bytes each) with AVX2
+    if bytesLeft >= AVX2_MinBytes and ({.noSideEffect.}: hasAvx2()):
+      let consumed = ctx.macMessageBlocks_avx2(
+        message.toOpenArray(int cur, message.len-1))
+      cur += consumed
+      bytesLeft -= consumed
+
   # Process n blocks (16 bytes each)
   let consumed = ctx.acc.macMessageBlocks(
     ctx.r,
@@ -320,6 +376,9 @@ func clear*(ctx: var Poly1305_CTX) =
   ctx.buf.setZero()
   ctx.msgLen = 0
   ctx.bufIdx = 0
+  when UseASM_X86_32:
+    for i in 0 ..< ctx.rPow.len:
+      ctx.rPow[i].setZero()
 
 func mac*(
        T: type poly1305,
@@ -0,0 +1,165 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/isa_x86/simd_x86,
+  constantine/platforms/primitives,
+  constantine/serialization/endians
+
+{.localpassC:"-mavx2".}
+
+# Poly1305, AVX2, 4 blocks in parallel
+# --------------------------------------------------------------------------------
+#
+# References:
+# - Martin Goll, Shay Gueron, 2015
+#   Vectorization of Poly1305 Message Authentication Code
+# - Andrew Moon, poly1305-donna
+#   https://github.com/floodyberry/poly1305-donna
+#
+# Poly1305 evaluates the polynomial
+#   acc = ∑ cᵢ rⁿ⁻ⁱ⁺¹ (mod 2¹³⁰-5)
+# Splitting the blocks by index mod 4, lane j accumulates
+#   hⱼ = ∑ c₄ᵢ₊ⱼ r⁴⁽ᵏ⁻¹⁻ⁱ⁾ with Horner's rule hⱼ = hⱼ.r⁴ + c₄ᵢ₊ⱼ
+# and at the end
+#   acc = h₀.r⁴ + h₁.r³ + h₂.r² + h₃.r
+#
+# Field elements use 5 limbs of 26 bits, one limb per 64-bit lane,
+# so that vpmuludq 32x32->64-bit multiplications
+# accumulate the 25 partial products without overflow.
+# Reduction uses 2¹³⁰ ≡ 5 (mod p), the high partial products
+# are multiplied by 5.r precomputed.
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+const M26 = (1'u64 shl 26) - 1
+
+# Radix conversions
+# ------------------------------------------------
+
+func toRadix26*(h: var array[5, uint64], a: array[17, byte]) =
+  ## Split a little-endian integer a < 2¹³⁶ into 26-bit limbs.
+  ## The last limb holds the excess bits.
+  let lo = uint64.fromBytes(a, 0, littleEndian)
+  let mid = uint64.fromBytes(a, 8, littleEndian)
+  let hi = uint64(a[16])
+  h[0] = lo and M26
+  h[1] = (lo shr 26) and M26
+  h[2] = ((lo shr 52) or (mid shl 12)) and M26
+  h[3] = (mid shr 14) and M26
+  h[4] = (mid shr 40) or (hi shl 24)
+
+func fromRadix26*(a: var array[17, byte], h: array[5, uint64]) =
+  ## Recombine 26-bit limbs into a little-endian integer.
+  ## Limbs may exceed 26 bits, up to 38 bits.
+  var lo = h[0] + (h[1] shl 26)
+  var t = h[2] shl 52
+  lo += t
+  var carry = uint64(lo < t)
+  var mid = (h[2] shr 12) + (h[3] shl 14) + carry
+  t = h[4] shl 40
+  mid += t
+  carry = uint64(mid < t)
+  let hi = (h[4] shr 24) + carry
+
+  a.dumpRawInt(lo, 0, littleEndian)
+  a.dumpRawInt(mid, 8, littleEndian)
+  a[16] = byte(hi)
+
+# Arithmetic
+# ------------------------------------------------
+
+func mulmod(d: var array[5, m256i], h, r, s: array[5, m256i]) {.inline.} =
+  ## d <- h.r (mod 2¹³⁰-5), partially reduced
+  ## with s = 5.r
+  template `*`(a, b: m256i): m256i = mul_u32_u64x4(a, b)
+  template `+`(a, b: m256i): m256i = add_u64x4(a, b)
+
+  d[0] = h[0]*r[0] + h[1]*s[4] + h[2]*s[3] + h[3]*s[2] + h[4]*s[1]
+  d[1] = h[0]*r[1] + h[1]*r[0] + h[2]*s[4] + h[3]*s[3] + h[4]*s[2]
+  d[2] = h[0]*r[2] + h[1]*r[1] + h[2]*r[0] + h[3]*s[4] + h[4]*s[3]
+  d[3] = h[0]*r[3] + h[1]*r[2] + h[2]*r[1] + h[3]*r[0] + h[4]*s[4]
+  d[4] = h[0]*r[4] + h[1]*r[3] + h[2]*r[2] + h[3]*r[1] + h[4]*r[0]
+
+  # Carry propagation, limbs are back to 26-bit except d[1]
+  # which may have a few extra bits.
+  let mask = set1_u64x4(M26)
+  var c: m256i
+  c = shr_u64x4(d[0], 26); d[0] = and_u256(d[0], mask); d[1] = d[1] + c
+  c = shr_u64x4(d[1], 26); d[1] = and_u256(d[1], mask); d[2] = d[2] + c
+  c = shr_u64x4(d[2], 26); d[2] = and_u256(d[2], mask); d[3] = d[3] + c
+  c = shr_u64x4(d[3], 26); d[3] = and_u256(d[3], mask); d[4] = d[4] + c
+  c = shr_u64x4(d[4], 26); d[4] = and_u256(d[4], mask); d[0] = d[0] + c + shl_u64x4(c, 2)
+  c = shr_u64x4(d[0], 26); d[0] = and_u256(d[0], mask); d[1] = d[1] + c
+
+func addBlocks(h: var array[5, m256i], message: ptr UncheckedArray[byte]) {.inline.} =
+  ## Add 4 message blocks of 16 bytes to the 4 lanes
+  ## with the 2¹²⁸ padding bit.
+  let mask = set1_u64x4(M26)
+  let a = loadu_u256(message[0].addr)  # [lo0, hi0, lo1, hi1]
+  let b = loadu_u256(message[32].addr) # [lo2, hi2, lo3, hi3]
+  let lo = permute_u64x4(unpacklo_u64x4(a, b), 0xD8) # [lo0, lo1, lo2, lo3]
+  let hi = permute_u64x4(unpackhi_u64x4(a, b), 0xD8) # [hi0, hi1, hi2, hi3]
+
+  h[0] = add_u64x4(h[0], and_u256(lo, mask))
+  h[1] = add_u64x4(h[1], and_u256(shr_u64x4(lo, 26), mask))
+  h[2] = add_u64x4(h[2], and_u256(or_u256(shr_u64x4(lo, 52), shl_u64x4(hi, 12)), mask))
+  h[3] = add_u64x4(h[3], and_u256(shr_u64x4(hi, 14), mask))
+  h[4] = add_u64x4(h[4], or_u256(shr_u64x4(hi, 40), set1_u64x4(1'u64 shl 24)))
+
+# Authentication
+# ------------------------------------------------
+
+func poly1305_macBlocks_avx2_x4*(
+       acc: var array[5, uint64],
+       rPow: array[4, array[5, uint64]],
+       message: ptr UncheckedArray[byte],
+       numBlocks: int) =
+  ## Authenticate `numBlocks` full 16-byte blocks.
+  ## `numBlocks` MUST be a positive multiple of 4.
+  ##
+  ## - `acc` is the accumulator in radix 2²⁶,
+  ##   its limbs are at most 27-bit.
+  ##   On output it is partially reduced, less than 2¹³⁰ + 2¹⁰⁵.
+  ## - `rPow` are r¹, r², r³, r⁴ in radix 2²⁶ with 26-bit limbs.
+  var h{.noInit.}, r{.noInit.}, s{.noInit.}: array[5, m256i]
+
+  staticFor i, 0, 5:
+    h[i] = setr_u64x4(acc[i], 0'u64, 0'u64, 0'u64)
+    r[i] = set1_u64x4(rPow[3][i])
+    s[i] = set1_u64x4(5*rPow[3][i])
+
+  h.addBlocks(message)
+  for i in countup(4, numBlocks-1, 4):
+    var d{.noInit.}: array[5, m256i]
+    d.mulmod(h, r, s)
+    h = d
+    h.addBlocks(message +% (i*16))
+
+  # Lane j is multiplied by r⁴⁻ʲ
+  staticFor i, 0, 5:
+    r[i] = setr_u64x4(rPow[3][i], rPow[2][i], rPow[1][i], rPow[0][i])
+    s[i] = add_u64x4(r[i], shl_u64x4(r[i], 2))
+  var d{.noInit.}: array[5, m256i]
+  d.mulmod(h, r, s)
+
+  # Horizontal sum of the lanes, and carry
+  var lanes{.noInit, align: 32.}: array[4, uint64]
+  staticFor i, 0, 5:
+    storea_u256(lanes[0].addr, d[i])
+    acc[i] = lanes[0] + lanes[1] + lanes[2] + lanes[3]
+
+  var c: uint64
+  c = acc[0] shr 26; acc[0] = acc[0] and M26; acc[1] += c
+  c = acc[1] shr 26; acc[1] = acc[1] and M26; acc[2] += c
+  c = acc[2] shr 26; acc[2] = acc[2] and M26; acc[3] += c
+  c = acc[3] shr 26; acc[3] = acc[3] and M26; acc[4] += c
+  c = acc[4] shr 26; acc[4] = acc[4] and M26; acc[0] += 5*c
+  c = acc[0] shr 26; acc[0] = acc[0] and M26; acc[1] += c
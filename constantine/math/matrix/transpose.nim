@@ -33,6 +33,33 @@ export views
 #
 # ############################################################
 
+proc transpose*[T](
+       dst: ptr UncheckedArray[T], ldDst: int,
+       src: ptr UncheckedArray[T], ldSrc: int,
+       M, N: int, blockSize: static int = 16) {.inline.} =
+  ## 2D tiled transposition of a M x N submatrix
+  ## with explicit leading dimensions (row pitch)
+  ##
+  ## dst[j * ldDst + i] = src[i * ldSrc + j]
+  ##
+  ## This allows transposing a band of rows of a larger matrix,
+  ## for example to split a transposition across threads.
+  ##
+  ## Parameters:
+  ## - dst: output buffer, N rows of pitch ldDst >= M
+  ## - ldDst: distance in elements between 2 consecutive rows of dst
+  ## - src: input buffer, M rows of pitch ldSrc >= N
+  ## - ldSrc: distance in elements between 2 consecutive rows of src
+  ## - M: number of rows in source submatrix
+  ## - N: number of columns in source submatrix
+  ## - blockSize: tile size (default 16, optimized for 32-byte elements)
+  const blck = blockSize
+  for jj in countup(0, N - 1, blck):
+    for ii in countup(0, M - 1, blck):
+      for j in jj ..< min(jj + blck, N):
+        for i in ii ..< min(ii + blck, M):
+          dst[j * ldDst + i] = src[i * ldSrc + j]
+
 proc transpose*[T](dst, src: ptr UncheckedArray[T], M, N: int, blockSize: static int = 16) {.inline.} =
   ## 2D tiled transposition for optimal cache utilization
   ##
@@ -50,12 +77,7 @@ proc transpose*[T](dst, src: ptr UncheckedArray[T], M, N: int, blockSize: static
   ## - M: number of rows in source matrix
   ## - N: number of columns in source matrix
   ## - blockSize: tile size (default 16, optimized for 32-byte elements)
-  const blck = blockSize
-  for jj in countup(0, N - 1, blck):
-    for ii in countup(0, M - 1, blck):
-      for j in jj ..< min(jj + blck, N):
-        for i in ii ..< min(ii + blck, M):
-          dst[j * M + i] = src[i * N + j]
+  transpose(dst, M, src, N, M, N, blockSize)
 
 # ############################################################
 #
@@ -195,6 +195,27 @@ func finalExpEasy*[Name: static Algebra](f: var AnyFp12[Name]) {.meter.} =
   f.frobenius_map(g, 2) # f = f^((p⁶-1) p²)
   f *= g                # f = f^((p⁶-1) (p²+1))
 
+func finalExpEasy_batch*[Name: static Algebra](
+       fs: ptr UncheckedArray[Fp12[Name]], N: int) {.tags:[HeapAlloc], meter.} =
+  ## Easy part of the final exponentiation
+  ## of N independent Miller loop outputs
+  ##
+  ## The N 𝔽p12 inversions are replaced by a single one
+  ## and 3(N-1) multiplications with Montgomery's batch inversion trick.
+  if N <= 0:
+    return
+
+  let gs = allocHeapArrayAligned(Fp12[Name], N, alignment = 64)
+  gs.batchInv(fs, N)          # gᵢ = fᵢ^-1
+
+  for i in 0 ..< N:
+    conj(fs[i])                   # f = f^p⁶
+    gs[i] *= fs[i]                # g = f^(p⁶-1)
+    fs[i].frobenius_map(gs[i], 2) # f = f^((p⁶-1) p²)
+    fs[i] *= gs[i]                # f = f^((p⁶-1) (p²+1))
+
+  freeHeapAligned(gs)
+
 # Gϕₙ - Cyclotomic functions
 # ----------------------------------------------------------------
 # A cyclotomic group is a subgroup of Fpⁿ defined by
@@ -0,0 +1,541 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/math/arithmetic,
+  constantine/math/extension_fields,
+  constantine/math/endomorphisms/split_scalars,
+  constantine/platforms/[abstractions, allocs, views],
+  constantine/named/zoo_endomorphisms,
+  constantine/named/algebras,
+  ./cyclotomic_subgroups,
+  ./gt_prj
+
+from constantine/math/elliptic/ec_shortweierstrass_affine import G2
+
+{.push raises: [].} # No exceptions allowed in core cryptographic operations
+{.push checks: off.} # No defects due to array bound checking or signed integer overflow allowed
+
+# ############################################################
+#                                                            #
+#            Fixed-base Exponentiation in 𝔾ₜ                 #
+#                                                            #
+# ############################################################
+#
+# Protocols like IBE, VRFs or inner-pairing-product arguments
+# repeatedly exponentiate the same 𝔾ₜ base, for example e(G1, G2).
+#
+# We combine the Frobenius endomorphism and a comb method:
+#
+# 1. The scalar k is decomposed into 4 mini-scalars of L ≈ |r|/4 bits
+#      aᵏ = ∏ᵢ ψⁱ(a)^±kᵢ with ψ the p-power Frobenius
+#    like for `gtExpEndo`.
+# 2. Mini-scalars are made odd and recoded with signed digits ±1.
+#    kᵢ odd < 2ᴸ, mᵢ = (kᵢ-1)/2 + 2ᴸ⁻¹  ⇒  kᵢ = ∑ⱼ (2mᵢⱼ - 1) 2ʲ
+#    All digits are non-zero which gives a regular,
+#    constant-time friendly, schedule.
+# 3. The L digit positions are split into B blocks of d = ⌈L/B⌉ positions.
+#    For each block j, with gⱼ = a^(2ʲᵈ), we precompute the 8 products
+#      lutⱼ[u] = gⱼ ∏ᵢ₌₁³ ψⁱ(gⱼ)^±1, the sign of ψⁱ(gⱼ) given by bit i-1 of u
+#    the sign of gⱼ itself is handled with a cyclotomic inverse (a conjugation).
+#
+# An exponentiation costs d-1 cyclotomic squarings and about L multiplications
+# and constant-time table scans.
+# The table uses 8B 𝔾ₜ elements.
+#
+# Torus-compressed tables
+# -----------------------
+#
+# Table entries can be stored in T₂(𝔽p6) torus form α = (x - w)/(x + w)
+# with x ∈ 𝔽p6 (see `gt_prj.nim`), halving memory and the constant-time scan cost.
+# We accumulate F = ∏(xₖ - w)^eₖ in 𝔽p12 with w² = v,
+# which only needs 2 𝔽p6 multiplications per table element.
+# As (x + w) is the conjugate of (x - w), the result is
+#   F/F̄ = F²/(F.F̄) = F²/N(F)
+# with N(F) ∈ 𝔽p6, i.e. a single 𝔽p6 inversion at the end.
+# Squarings are regular 𝔽p12 squarings as F is not unitary.
+
+const
+  gtFixedBaseDim = 4
+    ## Frobenius decomposition dimension for embedding degree 12
+  gtFixedBaseLutSize = 1 shl (gtFixedBaseDim-1)
+
+type
+  GtFixedBaseTable*[Name: static Algebra] = object
+    ## Precomputed table for fixed-base exponentiation in 𝔾ₜ
+    ##
+    ## The table is heap-allocated and holds 8 × numBlocks 𝔽p12 elements.
+    ## More blocks means less squarings but more memory.
+    luts: ptr UncheckedArray[Fp12[Name]]
+    endos: array[gtFixedBaseDim, Fp12[Name]]
+    numBlocks, blockLen: int
+
+  GtFixedBaseTorusTable*[Name: static Algebra] = object
+    ## Precomputed table for fixed-base exponentiation in 𝔾ₜ
+    ## with entries compressed in T₂(𝔽p6) torus form.
+    ##
+    ## The table is heap-allocated and holds 8 × numBlocks 𝔽p6 elements.
+    luts: ptr UncheckedArray[Fp6[Name]]
+    endos: array[gtFixedBaseDim, Fp12[Name]]
+    numBlocks, blockLen: int
+
+proc `=destroy`*[Name: static Algebra](table: var GtFixedBaseTable[Name]) {.raises: [].} =
+  if table.luts != nil:
+    freeHeapAligned(table.luts)
+    table.luts = nil
+
+proc `=copy`*[Name: static Algebra](dst: var GtFixedBaseTable[Name], src: GtFixedBaseTable[Name]) {.error: "GtFixedBaseTable cannot be copied".}
+
+proc `=destroy`*[Name: static Algebra](table: var GtFixedBaseTorusTable[Name]) {.raises: [].} =
+  if table.luts != nil:
+    freeHeapAligned(table.luts)
+    table.luts = nil
+
+proc `=copy`*[Name: static Algebra](dst: var GtFixedBaseTorusTable[Name], src: GtFixedBaseTorusTable[Name]) {.error: "GtFixedBaseTorusTable cannot be copied".}
+
+# Metadata
+# ------------------------------------------------------------
+
+func gtFixedBaseMiniScalarLen(Name: static Algebra): int {.compileTime.} =
+  Fr[Name].bits().computeEndoRecodedLength(gtFixedBaseDim)
+
+func gtFixedBaseTableLen*(Name: static Algebra, numBlocks: int): int =
+  ## Returns the number of 𝔾ₜ elements (or torus elements)
+  ## in a fixed-base table with `numBlocks` blocks
+  numBlocks * gtFixedBaseLutSize
+
+func gtFixedBaseMaxBlocks*(Name: static Algebra): int =
+  ## Returns the maximum number of blocks of a fixed-base table.
+  ## With that many blocks, exponentiation requires no squarings.
+  gtFixedBaseMiniScalarLen(Name)
+
+# Table construction
+# ------------------------------------------------------------
+
+func buildLut[Name: static Algebra](lut: ptr UncheckedArray[Fp12[Name]], g: Fp12[Name]) =
+  ## lut[u] = g ∏ᵢ₌₁³ ψⁱ(g)^±1
+  ## with the sign of ψⁱ(g) being + if bit i-1 of u is set
+  var endos {.noInit.}: array[gtFixedBaseDim-1, Fp12[Name]]
+  var endosSq {.noInit.}: array[gtFixedBaseDim-1, Fp12[Name]]
+  endos.computeEndomorphisms(g)
+
+  lut[0] = g
+  for i in 0 ..< gtFixedBaseDim-1:
+    var t {.noInit.}: Fp12[Name]
+    t.cyclotomic_inv(endos[i])
+    lut[0] *= t
+    endosSq[i].cyclotomic_square(endos[i])
+
+  # Flipping ψⁱ(g)⁻¹ into ψⁱ(g) is a multiplication by ψⁱ(g)²
+  for u in 1'u32 ..< gtFixedBaseLutSize:
+    let msb = u.log2_vartime()
+    lut[u].prod(lut[u.clearBit(msb)], endosSq[msb])
+
+func init*[Name: static Algebra](
+       table: var GtFixedBaseTable[Name],
+       base: Fp12[Name],
+       numBlocks: int) {.meter.} =
+  ## Build the fixed-base exponentiation table of `base`
+  ## with `numBlocks` blocks, 1 ≤ numBlocks ≤ gtFixedBaseMaxBlocks(Name)
+  ##
+  ## `base` MUST be in 𝔾ₜ
+  ##
+  ## Table construction is variable-time with regards to `base`.
+  ## Exponentiations are constant-time with regards to the scalar
+  ## unless the `_vartime` variants are used.
+  static: doAssert Name.getEmbeddingDegree() == 12, "Only embedding degree 12 curves are supported"
+  const L = gtFixedBaseMiniScalarLen(Name)
+  doAssert 1 <= numBlocks and numBlocks <= L
+
+  if table.luts != nil:
+    freeHeapAligned(table.luts)
+
+  table.blockLen = L.ceilDiv_vartime(numBlocks)
+  table.numBlocks = L.ceilDiv_vartime(table.blockLen) # Drop blocks that would be empty
+  table.luts = allocHeapArrayAligned(Fp12[Name], gtFixedBaseTableLen(Name, table.numBlocks), alignment = 64)
+
+  table.endos[0] = base
+  block:
+    var endos {.noInit.}: array[gtFixedBaseDim-1, Fp12[Name]]
+    endos.computeEndomorphisms(base)
+    for i in 1 ..< gtFixedBaseDim:
+      table.endos[i] = endos[i-1]
+
+  var g {.noInit.}: Fp12[Name]
+  g = base
+  for j in 0 ..< table.numBlocks:
+    if j > 0:
+      # gⱼ = a^(2ʲᵈ)
+      for _ in 0 ..< table.blockLen:
+        g.cyclotomic_square()
+    buildLut(table.luts +% j*gtFixedBaseLutSize, g)
+
+func compress*[Name: static Algebra](
+       dst: var GtFixedBaseTorusTable[Name],
+       src: GtFixedBaseTable[Name]): bool {.meter.} =
+  ## Compress a fixed-base exponentiation table in T₂(𝔽p6) torus form.
+  ##
+  ## Returns false if the table has an entry equal to 1
+  ## which has no torus representation.
+  ## This never happens except for degenerate bases like 1.
+  let n = gtFixedBaseTableLen(Name, src.numBlocks)
+
+  for i in 0 ..< n:
+    if src.luts[i].isOne().bool():
+      return false
+
+  if dst.luts != nil:
+    freeHeapAligned(dst.luts)
+
+  dst.numBlocks = src.numBlocks
+  dst.blockLen = src.blockLen
+  dst.endos = src.endos
+  dst.luts = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+
+  # x = -(a+1)/b for a 𝔾ₜ element a + bw
+  let bs = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let bsInv = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+
+  for i in 0 ..< n:
+    var g {.noInit.}: QuadraticExt[Fp6[Name]]
+    var one {.noInit.}: Fp6[Name]
+    g.toQuadOverCube(src.luts[i])
+    one.setOne()
+    dst.luts[i].sum(g.c0, one)
+    dst.luts[i].neg()
+    bs[i] = g.c1
+
+  batchInv(bsInv, bs, n)
+  for i in 0 ..< n:
+    dst.luts[i] *= bsInv[i]
+
+  freeHeapAligned(bsInv)
+  freeHeapAligned(bs)
+  return true
+
+# Scalar recoding
+# ------------------------------------------------------------
+
+func recodeFixedBase[L, scalBits: static int](
+       miniScalars: var array[gtFixedBaseDim, BigInt[L]],
+       negate, wasEven: var array[gtFixedBaseDim, SecretBool],
+       scalar: BigInt[scalBits],
+       Name: static Algebra) =
+  ## Decompose the scalar with the Frobenius endomorphism
+  ## and recode the mini-scalars with signed digits ±1.
+  ## Even mini-scalars are incremented, the result must be corrected.
+  miniScalars.decomposeEndo(negate, scalar, Fr[Name].bits(), Name, G2) # 𝔾ₜ has same decomposition as 𝔾₂
+  staticFor i, 0, gtFixedBaseDim:
+    wasEven[i] = not miniScalars[i].isOdd()
+    discard miniScalars[i].cadd(One, wasEven[i])
+    # mᵢ = (kᵢ-1)/2 + 2ᴸ⁻¹
+    miniScalars[i].shiftRight(1)
+    miniScalars[i].setBit(L-1)
+
+func getColumn[L: static int](
+       miniScalars: array[gtFixedBaseDim, BigInt[L]],
+       negate: array[gtFixedBaseDim, SecretBool],
+       pos: int,
+       index: var SecretWord,
+       isNeg: var SecretBool) {.inline.} =
+  ## Returns the table index and sign
+  ## of the signed digits at position `pos`
+  var isPos {.noInit.}: array[gtFixedBaseDim, SecretWord]
+  staticFor i, 0, gtFixedBaseDim:
+    isPos[i] = SecretWord(miniScalars[i].bit(pos).uint8) xor (SecretWord(negate[i]) and One)
+
+  # Bit i-1 of the index is set if digit i has the same sign as digit 0
+  index = Zero
+  staticFor i, 1, gtFixedBaseDim:
+    index = index or (((isPos[i] xor isPos[0] xor One) and One) shl (i-1))
+  isNeg = SecretBool(isPos[0] xor One)
+
+func correctEven[Name: static Algebra](
+       r: var Fp12[Name],
+       endos: array[gtFixedBaseDim, Fp12[Name]],
+       negate, wasEven: array[gtFixedBaseDim, SecretBool]) =
+  ## Remove ψⁱ(a)^±1 for the mini-scalars that were incremented
+  var t {.noInit.}, rt {.noInit.}: Fp12[Name]
+  for i in 0 ..< gtFixedBaseDim:
+    t.cyclotomic_inv(endos[i])
+    t.ccopy(endos[i], negate[i])
+    rt.prod(r, t)
+    r.ccopy(rt, wasEven[i])
+
+func correctEven_vartime[Name: static Algebra](
+       r: var Fp12[Name],
+       endos: array[gtFixedBaseDim, Fp12[Name]],
+       negate, wasEven: array[gtFixedBaseDim, SecretBool]) =
+  ## Remove ψⁱ(a)^±1 for the mini-scalars that were incremented
+  for i in 0 ..< gtFixedBaseDim:
+    if wasEven[i].bool():
+      if negate[i].bool():
+        r *= endos[i]
+      else:
+        var t {.noInit.}: Fp12[Name]
+        t.cyclotomic_inv(endos[i])
+        r *= t
+
+# Torus accumulator
+# ------------------------------------------------------------
+
+func mulByTorus[Name: static Algebra](f: var QuadraticExt[Fp6[Name]], x: Fp6[Name]) {.inline.} =
+  ## f <- f.(x - w)
+  ## (a + bw)(x - w) = (ax - bv) + (bx - a)w
+  var t0 {.noInit.}, t1 {.noInit.}: Fp6[Name]
+  t0.prod(f.c0, x)
+  t1.prod(f.c1, x)
+  t1 -= f.c0
+  f.c1 *= NonResidue
+  f.c0.diff(t0, f.c1)
+  f.c1 = t1
+
+func initTorus[Name: static Algebra](f: var QuadraticExt[Fp6[Name]], x: Fp6[Name]) {.inline.} =
+  ## f <- x - w
+  f.c0 = x
+  f.c1.setOne()
+  f.c1.neg()
+
+func finalTorus[Name: static Algebra](r: var Fp12[Name], f: var QuadraticExt[Fp6[Name]]) =
+  ## r <- f/f̄ = f²/N(f)
+  var n {.noInit.}, t {.noInit.}: Fp6[Name]
+  n.square(f.c0)
+  t.square(f.c1)
+  t *= NonResidue
+  n -= t
+  n.inv()
+
+  f.square()
+  f.c0 *= n
+  f.c1 *= n
+  r.fromQuadOverCube(f)
+
+# ############################################################
+#
+#                 Public API
+#
+# ############################################################
+
+func gtExp_fixedBase*[Name: static Algebra, scalBits: static int](
+       r: var Fp12[Name],
+       table: GtFixedBaseTable[Name],
+       scalar: BigInt[scalBits]) {.meter.} =
+  ## Fixed-base exponentiation in 𝔾ₜ
+  ##
+  ##   r <- aᵏ
+  ##
+  ## with `a` the base of the precomputed `table`.
+  ##
+  ## This is constant-time with regards to the scalar.
+  ## Requires 0 <= scalar < curve order
+  static: doAssert scalBits <= Fr[Name].bits(), block:
+      "Do not use endomorphism to multiply beyond the curve order:\n" &
+      "  scalar: " & $scalBits & "-bit\n" &
+      "  order:  " & $Fr[Name].bits() & "-bit\n"
+
+  const L = gtFixedBaseMiniScalarLen(Name)
+  var miniScalars {.noInit.}: array[gtFixedBaseDim, BigInt[L]]
+  var negate {.noInit.}, wasEven {.noInit.}: array[gtFixedBaseDim, SecretBool]
+  miniScalars.recodeFixedBase(negate, wasEven, scalar, Name)
+
+  let d = table.blockLen
+  var t {.noInit.}: Fp12[Name]
+  var index {.noInit.}: SecretWord
+  var isNeg {.noInit.}: SecretBool
+
+  for s in countdown(d-1, 0):
+    if s != d-1:
+      r.cyclotomic_square()
+    for j in 0 ..< table.numBlocks:
+      let pos = j*d + s
+      if pos >= L: # The last block may be partial
+        break
+      miniScalars.getColumn(negate, pos, index, isNeg)
+      t.secretLookup(
+        table.luts.toOpenArray(j*gtFixedBaseLutSize, (j+1)*gtFixedBaseLutSize-1),
+        index)
+      if s == d-1 and j == 0:
+        r.cyclotomic_inv(t)
+        r.ccopy(t, not isNeg)
+      else:
+        var nt {.noInit.}: Fp12[Name]
+        nt.cyclotomic_inv(t)
+        t.ccopy(nt, isNeg)
+        r *= t
+
+  r.correctEven(table.endos, negate, wasEven)
+
+func gtExp_fixedBase*[Name: static Algebra, scalBits: static int](
+       r: var Fp12[Name],
+       table: GtFixedBaseTorusTable[Name],
+       scalar: BigInt[scalBits]) {.meter.} =
+  ## Fixed-base exponentiation in 𝔾ₜ
+  ## with a torus-compressed table
+  ##
+  ##   r <- aᵏ
+  ##
+  ## with `a` the base of the precomputed `table`.
+  ##
+  ## This is constant-time with regards to the scalar.
+  ## Requires 0 <= scalar < curve order
+  static: doAssert scalBits <= Fr[Name].bits(), block:
+      "Do not use endomorphism to multiply beyond the curve order:\n" &
+      "  scalar: " & $scalBits & "-bit\n" &
+      "  order:  " & $Fr[Name].bits() & "-bit\n"
+
+  const L = gtFixedBaseMiniScalarLen(Name)
+  var miniScalars {.noInit.}: array[gtFixedBaseDim, BigInt[L]]
+  var negate {.noInit.}, wasEven {.noInit.}: array[gtFixedBaseDim, SecretBool]
+  miniScalars.recodeFixedBase(negate, wasEven, scalar, Name)
+
+  let d = table.blockLen
+  var f {.noInit.}: QuadraticExt[Fp6[Name]]
+  var x {.noInit.}: Fp6[Name]
+  var index {.noInit.}: SecretWord
+  var isNeg {.noInit.}: SecretBool
+
+  for s in countdown(d-1, 0):
+    if s != d-1:
+      f.square()
+    for j in 0 ..< table.numBlocks:
+      let pos = j*d + s
+      if pos >= L: # The last block may be partial
+        break
+      miniScalars.getColumn(negate, pos, index, isNeg)
+      x.secretLookup(
+        table.luts.toOpenArray(j*gtFixedBaseLutSize, (j+1)*gtFixedBaseLutSize-1),
+        index)
+      # The inverse of (x - w)/(x + w) is (-x - w)/(-x + w)
+      x.cneg(isNeg)
+      if s == d-1 and j == 0:
+        f.initTorus(x)
+      else:
+        f.mulByTorus(x)
+
+  r.finalTorus(f)
+  r.correctEven(table.endos, negate, wasEven)
+
+func gtExp_fixedBase_vartime*[Name: static Algebra, scalBits: static int](
+       r: var Fp12[Name],
+       table: GtFixedBaseTable[Name],
+       scalar: BigInt[scalBits]) {.tags:[VarTime], meter.} =
+  ## **Variable-time** Fixed-base exponentiation in 𝔾ₜ
+  ##
+  ##   r <- aᵏ
+  ##
+  ## with `a` the base of the precomputed `table`.
+  ##
+  ## This MUST NOT be used with secret data.
+  ## Requires 0 <= scalar < curve order
+  static: doAssert scalBits <= Fr[Name].bits(), block:
+      "Do not use endomorphism to multiply beyond the curve order:\n" &
+      "  scalar: " & $scalBits & "-bit\n" &
+      "  order:  " & $Fr[Name].bits() & "-bit\n"
+
+  const L = gtFixedBaseMiniScalarLen(Name)
+  var miniScalars {.noInit.}: array[gtFixedBaseDim, BigInt[L]]
+  var negate {.noInit.}, wasEven {.noInit.}: array[gtFixedBaseDim, SecretBool]
+  miniScalars.recodeFixedBase(negate, wasEven, scalar, Name)
+
+  let d = table.blockLen
+  var index {.noInit.}: SecretWord
+  var isNeg {.noInit.}: SecretBool
+
+  for s in countdown(d-1, 0):
+    if s != d-1:
+      r.cyclotomic_square()
+    for j in 0 ..< table.numBlocks:
+      let pos = j*d + s
+      if pos >= L: # The last block may be partial
+        break
+      miniScalars.getColumn(negate, pos, index, isNeg)
+      let e = table.luts[j*gtFixedBaseLutSize + int(index)].addr
+      if s == d-1 and j == 0:
+        if isNeg.bool():
+          r.cyclotomic_inv(e[])
+        else:
+          r = e[]
+      elif isNeg.bool():
+        var t {.noInit.}: Fp12[Name]
+        t.cyclotomic_inv(e[])
+        r *= t
+      else:
+        r *= e[]
+
+  r.correctEven_vartime(table.endos, negate, wasEven)
+
+func gtExp_fixedBase_vartime*[Name: static Algebra, scalBits: static int](
+       r: var Fp12[Name],
+       table: GtFixedBaseTorusTable[Name],
+       scalar: BigInt[scalBits]) {.tags:[VarTime], meter.} =
+  ## **Variable-time** Fixed-base exponentiation in 𝔾ₜ
+  ## with a torus-compressed table
+  ##
+  ##   r <- aᵏ
+  ##
+  ## with `a` the base of the precomputed `table`.
+  ##
+  ## This MUST NOT be used with secret data.
+  ## Requires 0 <= scalar < curve order
+  static: doAssert scalBits <= Fr[Name].bits(), block:
+      "Do not use endomorphism to multiply beyond the curve order:\n" &
+      "  scalar: " & $scalBits & "-bit\n" &
+      "  order:  " & $Fr[Name].bits() & "-bit\n"
+
+  const L = gtFixedBaseMiniScalarLen(Name)
+  var miniScalars {.noInit.}: array[gtFixedBaseDim, BigInt[L]]
+  var negate {.noInit.}, wasEven {.noInit.}: array[gtFixedBaseDim, SecretBool]
+  miniScalars.recodeFixedBase(negate, wasEven, scalar, Name)
+
+  let d = table.blockLen
+  var f {.noInit.}: QuadraticExt[Fp6[Name]]
+  var x {.noInit.}: Fp6[Name]
+  var index {.noInit.}: SecretWord
+  var isNeg {.noInit.}: SecretBool
+
+  for s in countdown(d-1, 0):
+    if s != d-1:
+      f.square()
+    for j in 0 ..< table.numBlocks:
+      let pos = j*d + s
+      if pos >= L: # The last block may be partial
+        break
+      miniScalars.getColumn(negate, pos, index, isNeg)
+      x = table.luts[j*gtFixedBaseLutSize + int(index)]
+      if isNeg.bool():
+        x.neg()
+      if s == d-1 and j == 0:
+        f.initTorus(x)
+      else:
+        f.mulByTorus(x)
+
+  r.finalTorus(f)
+  r.correctEven_vartime(table.endos, negate, wasEven)
+
+func gtExp_fixedBase*[Name: static Algebra](
+       r: var Fp12[Name],
+       table: GtFixedBaseTable[Name] or GtFixedBaseTorusTable[Name],
+       scalar: Fr[Name]) {.inline.} =
+  ## Fixed-base exponentiation in 𝔾ₜ
+  ##
+  ##   r <- aᵏ
+  ##
+  ## with `a` the base of the precomputed `table`.
+  r.gtExp_fixedBase(table, scalar.toBig())
+
+func gtExp_fixedBase_vartime*[Name: static Algebra](
+       r: var Fp12[Name],
+       table: GtFixedBaseTable[Name] or GtFixedBaseTorusTable[Name],
+       scalar: Fr[Name]) {.inline.} =
+  ## **Variable-time** Fixed-base exponentiation in 𝔾ₜ
+  ##
+  ##   r <- aᵏ
+  ##
+  ## with `a` the base of the precomputed `table`.
+  r.gtExp_fixedBase_vartime(table, scalar.toBig())
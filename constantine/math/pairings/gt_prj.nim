@@ -537,6 +537,38 @@ proc batchFromTorus2_vartime*[F](dst: var openArray[QuadraticExt[F]],
   t.conj(QF src[0])
   dst[0] *= t
 
+# Towering conversions
+# --------------------
+#
+# The torus T2 requires a quadratic-over-cubic view of 𝔽p12
+#   𝔽p12 = 𝔽p6[w]/(w² - v), 𝔽p6 = 𝔽p2[v]/(v³ - ξ)
+# while 𝔽p12 may be built cubic-over-quadratic
+#   𝔽p12 = 𝔽p4[W]/(W³ - V), 𝔽p4 = 𝔽p2[V]/(V² - ξ)
+# Both are 𝔽p2[w]/(w⁶ - ξ) with W = w, V = w³ and v = w²
+# so conversion is a permutation of the 𝔽p2 coordinates.
+
+func toQuadOverCube*[Name: static Algebra](r: var QuadraticExt[Fp6[Name]], a: CubicExt[Fp4[Name]]) =
+  r.c0.c0 = a.c0.c0 # w⁰
+  r.c0.c1 = a.c2.c0 # w²
+  r.c0.c2 = a.c1.c1 # w⁴
+  r.c1.c0 = a.c1.c0 # w¹
+  r.c1.c1 = a.c0.c1 # w³
+  r.c1.c2 = a.c2.c1 # w⁵
+
+func toQuadOverCube*[Name: static Algebra](r: var QuadraticExt[Fp6[Name]], a: QuadraticExt[Fp6[Name]]) {.inline.} =
+  r = a
+
+func fromQuadOverCube*[Name: static Algebra](r: var CubicExt[Fp4[Name]], a: QuadraticExt[Fp6[Name]]) =
+  r.c0.c0 = a.c0.c0 # w⁰
+  r.c0.c1 = a.c1.c1 # w³
+  r.c1.c0 = a.c1.c0 # w¹
+  r.c1.c1 = a.c0.c2 # w⁴
+  r.c2.c0 = a.c0.c1 # w²
+  r.c2.c1 = a.c1.c2 # w⁵
+
+func fromQuadOverCube*[Name: static Algebra](r: var QuadraticExt[Fp6[Name]], a: QuadraticExt[Fp6[Name]]) {.inline.} =
+  r = a
+
 func toHex*[F](a: T2Aff[F] or T2Prj[F], indent = 0, order: static Endianness = bigEndian): string =
   var t {.noInit.}: QuadraticExt[F]
   t.fromTorus2_vartime(a)
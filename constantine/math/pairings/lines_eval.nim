@@ -357,6 +357,40 @@ func line_add*[F1, F2](
   line_eval_fused_add(line, T, Q)
   line.line_update(P)
 
+# Precomputed lines
+# -----------------------------------------------------------------------------
+#
+# The line coefficients only depend on the 𝔾2 point,
+# the 𝔾1 point P is only involved in the final `line_update`.
+# For a fixed 𝔾2 point, the lines can be computed once
+# and evaluated at any number of 𝔾1 points.
+
+func line_double_precompute*[F2](
+       line: var Line[F2],
+       T: var EC_ShortW_Prj[F2, G2]) {.meter.} =
+  ## Doubling step of the Miller loop
+  ## without evaluation at a 𝔾1 point.
+  ## T in G2
+  line_eval_fused_double(line, T)
+
+func line_add_precompute*[F2](
+       line: var Line[F2],
+       T: var EC_ShortW_Prj[F2, G2],
+       Q: EC_ShortW_Aff[F2, G2]) {.meter.} =
+  ## Addition step of the Miller loop
+  ## without evaluation at a 𝔾1 point.
+  ## T and Q in G2
+  line_eval_fused_add(line, T, Q)
+
+func line_eval_precomputed*[F1, F2](
+       line: var Line[F2],
+       precomputed: Line[F2],
+       P: EC_ShortW_Aff[F1, G1]) {.inline.} =
+  ## Evaluate a precomputed line at P
+  ## P in G1
+  line = precomputed
+  line.line_update(P)
+
 # ############################################################
 #
 #                 Sparse Multiplication
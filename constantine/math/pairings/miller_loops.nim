@@ -26,7 +26,7 @@ import
 #                                                            #
 # ############################################################
 
-func recodeNafForPairing(ate: BigInt): seq[int8] {.compileTime.} =
+func recodeNafForPairing*(ate: BigInt): seq[int8] {.compileTime.} =
   ## We need a NAF recoding and we need to skip the MSB for pairings
   var recoded: array[ate.bits+1, int8]
   let recodedLen = recoded.recode_r2l_signed_vartime(ate)
@@ -0,0 +1,219 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/platforms/abstractions,
+  constantine/named/algebras,
+  constantine/math/extension_fields,
+  constantine/math/elliptic/[
+    ec_shortweierstrass_affine,
+    ec_shortweierstrass_projective
+  ],
+  constantine/math/endomorphisms/frobenius,
+  constantine/named/zoo_pairings,
+  ./lines_eval,
+  ./miller_loops
+
+# No exceptions allowed
+{.push raises: [], checks: off.}
+
+# ############################################################
+#                                                            #
+#                 Prepared 𝔾2 points                         #
+#                                                            #
+# ############################################################
+#
+# In the Miller loop, the 𝔾2 arithmetic (doublings and additions of T
+# and the line coefficients) does not depend on the 𝔾1 point P.
+# P only scales the line coefficients in `line_update`.
+#
+# When pairings are repeatedly computed with the same 𝔾2 point,
+# for example the generator or [τ]₂ of a KZG trusted setup,
+# the lines can be precomputed once and stored.
+# A Miller loop over prepared points only does
+# the 𝔽pᵏ squarings and sparse multiplications.
+#
+# The prepared loop follows the `basicMillerLoop` NAF structure,
+# one line per doubling and one line per non-zero NAF digit,
+# and for BN curves the 2 extra lines of the ψ(Q), -ψ²(Q) correction.
+#
+# Only curves with a sextic twist over 𝔽p2 (BN and BLS12) are supported.
+
+func preparedG2NumLines*(Name: static Algebra): int {.compileTime.} =
+  ## Number of lines stored for a prepared 𝔾2 point
+  let naf = pairing(Name, ate_param).recodeNafForPairing()
+  result = naf.len
+  for bit in naf:
+    if bit != 0:
+      result += 1
+  if family(Name) == BarretoNaehrig:
+    result += 2
+
+template preparedG2Lines*(Name: static Algebra): untyped =
+  # Workaround: https://github.com/nim-lang/Nim/issues/16774
+  # as we cannot do compile-time function calls in type section.
+  # Due to generic sandwiches, it must be exported.
+  bind Line, Fp2, preparedG2NumLines
+  array[preparedG2NumLines(Name), Line[Fp2[Name]]]
+
+type
+  PreparedG2*[Name: static Algebra] = object
+    ## A 𝔾2 point with its Miller loop lines precomputed.
+    ## The lines are stored unevaluated, in Miller loop order.
+    lines*: preparedG2Lines(Name)
+
+func prepare*[Name: static Algebra](
+       prepared: var PreparedG2[Name],
+       Q: EC_ShortW_Aff[Fp2[Name], G2]) {.meter.} =
+  ## Precompute the Miller loop lines of Q ∈ 𝔾2
+  static: doAssert family(Name) in {BarretoNaehrig, BarretoLynnScott}
+
+  const naf = pairing(Name, ate_param).recodeNafForPairing()
+  var T {.noInit.}: EC_ShortW_Prj[Fp2[Name], G2]
+  var nQ {.noInit.}: EC_ShortW_Aff[Fp2[Name], G2]
+  T.fromAffine(Q)
+  nQ.neg(Q)
+
+  var k = 0
+  for i in countdown(naf.len-1, 0):
+    let bit = naf[i]
+    prepared.lines[k].line_double_precompute(T)
+    k += 1
+    if bit == 1:
+      prepared.lines[k].line_add_precompute(T, Q)
+      k += 1
+    elif bit == -1:
+      prepared.lines[k].line_add_precompute(T, nQ)
+      k += 1
+
+  when family(Name) == BarretoNaehrig:
+    # Ate pairing for BN curves needs adjustment after basic Miller loop
+    # see `millerCorrectionBN`
+    when pairing(Name, ate_param_is_neg):
+      T.neg()
+
+    var V {.noInit.}: EC_ShortW_Aff[Fp2[Name], G2]
+    V.frobenius_psi(Q)
+    prepared.lines[k].line_add_precompute(T, V)
+    V.frobenius_psi(Q, 2)
+    V.neg()
+    prepared.lines[k+1].line_add_precompute(T, V)
+    k += 2
+
+  debug: doAssert k == preparedG2NumLines(Name)
+
+# ############################################################
+#                                                            #
+#            Miller Loop with prepared 𝔾2 points             #
+#                                                            #
+# ############################################################
+
+func millerLoopPrepared*[Name: static Algebra](
+       f: var AnyFp12[Name],
+       Qs: ptr UncheckedArray[EC_ShortW_Aff[Fp2[Name], G2]],
+       Ps: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+       N: int,
+       preparedQs: ptr UncheckedArray[ptr PreparedG2[Name]],
+       preparedPs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+       M: int) {.noinline, tags:[Alloca], meter.} =
+  ## Miller loop of a multi-pairing
+  ## with N pairs (Pᵢ, Qᵢ) and M pairs (Pⱼ, prepared Qⱼ)
+  ##
+  ## Prepared points are large (~20KB for BLS12-381),
+  ## they are passed by address to avoid copies.
+  ##
+  ## All pairs share the 𝔽pᵏ squarings.
+  ## Prepared pairs skip all 𝔾2 arithmetic.
+  ##
+  ## For BN curves the result includes the ψ(Q), -ψ²(Q) correction
+  ## and the conjugation for negative ate parameters.
+  static: doAssert family(Name) in {BarretoNaehrig, BarretoLynnScott}
+
+  const naf = pairing(Name, ate_param).recodeNafForPairing()
+
+  var Ts = allocStackArray(EC_ShortW_Prj[Fp2[Name], G2], max(N, 1))
+  for i in 0 ..< N:
+    Ts[i].fromAffine(Qs[i])
+
+  var line {.noInit.}, pending {.noInit.}: Line[Fp2[Name]]
+  var hasPending = false
+  var nQ {.noInit.}: EC_ShortW_Aff[Fp2[Name], G2]
+
+  template accumulate(line: Line) =
+    # Merge lines 2 by 2 for sparse multiplication
+    if hasPending:
+      f.mul_by_2_lines(pending, line)
+      hasPending = false
+    else:
+      pending = line
+      hasPending = true
+
+  template flush() =
+    if hasPending:
+      f.mul_by_line(pending)
+      hasPending = false
+
+  f.setOne()
+  var k = 0
+  for i in countdown(naf.len-1, 0):
+    let bit = naf[i]
+    if i != naf.len-1:
+      f.square()
+
+    for j in 0 ..< N:
+      line.line_double(Ts[j], Ps[j])
+      accumulate(line)
+      if bit == 1:
+        line.line_add(Ts[j], Qs[j], Ps[j])
+        accumulate(line)
+      elif bit == -1:
+        nQ.neg(Qs[j])
+        line.line_add(Ts[j], nQ, Ps[j])
+        accumulate(line)
+
+    for j in 0 ..< M:
+      line.line_eval_precomputed(preparedQs[j].lines[k], preparedPs[j])
+      accumulate(line)
+      if bit != 0:
+        line.line_eval_precomputed(preparedQs[j].lines[k+1], preparedPs[j])
+        accumulate(line)
+
+    flush()
+    k += (if bit != 0: 2 else: 1)
+
+  when family(Name) == BarretoNaehrig:
+    when pairing(Name, ate_param_is_neg):
+      f.conj()
+      for i in 0 ..< N:
+        Ts[i].neg()
+
+    # Ate pairing for BN curves needs adjustment after basic Miller loop
+    for i in 0 ..< N:
+      f.millerCorrectionBN(Ts[i], Qs[i], Ps[i])
+    for j in 0 ..< M:
+      var line1 {.noInit.}: Line[Fp2[Name]]
+      line.line_eval_precomputed(preparedQs[j].lines[k], preparedPs[j])
+      line1.line_eval_precomputed(preparedQs[j].lines[k+1], preparedPs[j])
+      f.mul_by_2_lines(line, line1)
+
+func millerLoopPrepared*[Name: static Algebra](
+       f: var AnyFp12[Name],
+       Qs: openArray[EC_ShortW_Aff[Fp2[Name], G2]],
+       Ps: openArray[EC_ShortW_Aff[Fp[Name], G1]],
+       preparedQs: openArray[PreparedG2[Name]],
+       preparedPs: openArray[EC_ShortW_Aff[Fp[Name], G1]]) {.inline.} =
+  ## Miller loop of a multi-pairing
+  ## with pairs (Pᵢ, Qᵢ) and pairs (Pⱼ, prepared Qⱼ)
+  debug: doAssert Qs.len == Ps.len
+  debug: doAssert preparedQs.len == preparedPs.len
+  let preparedQsPtrs = allocStackArray(ptr PreparedG2[Name], max(preparedQs.len, 1))
+  for j in 0 ..< preparedQs.len:
+    preparedQsPtrs[j] = preparedQs[j].unsafeAddr
+  f.millerLoopPrepared(
+    Qs.asUnchecked(), Ps.asUnchecked(), Qs.len,
+    preparedQsPtrs, preparedPs.asUnchecked(), preparedQs.len)
@@ -7,15 +7,18 @@
 # at your option. This file may not be copied, modified, or distributed except according to those terms.
 
 import
+  constantine/platforms/abstractions,
   constantine/named/algebras,
   constantine/math/arithmetic,
   constantine/math/extension_fields,
   constantine/math/elliptic/[
     ec_shortweierstrass_affine,
-    ec_shortweierstrass_projective
+    ec_shortweierstrass_projective,
+    ec_shortweierstrass_batch_ops
   ],
   constantine/math/endomorphisms/frobenius,
   constantine/named/zoo_pairings,
+  ./cyclotomic_subgroups,
   ./lines_eval,
   ./miller_loops
 
@@ -65,10 +68,88 @@ func finalExpGeneric[Name: static Algebra](f: var Fp6[Name]) =
   ## for sanity checks purposes.
   f.pow_vartime(Name.pairing(finalexponent), window = 3)
 
-func finalExpHard_BW6_761*[Name: static Algebra](f: var Fp6[Name]) =
-  ## A generic and slow implementation of final exponentiation
-  ## for sanity checks purposes.
-  f.pow_vartime(Name.pairing(finalexponent_hard), window = 3)
+# Final exponentiation hard part
+# ----------------------------------------------------------------
+#
+# - Optimized and secure pairing-friendly elliptic curves
+#   suitable for one layer proof composition
+#   Youssef El Housni and Aurore Guillevic, 2020
+#   https://eprint.iacr.org/2020/351.pdf
+#
+# The hard part is raised to the multiple 3(u³-u²+1)(p²-p+1)/r
+# of the exponent (p²-p+1)/r, which decomposes as R₀(u) + p.R₁(u) with
+#   R₀(u) = -103u⁷ + 70u⁶ + 269u⁵ - 197u⁴ - 314u³ - 73u² - 263u - 220
+#   R₁(u) =  103u⁹ - 276u⁸ + 77u⁷ + 492u⁶ - 445u⁵ - 65u⁴ + 452u³ - 181u² + 34u + 229
+# With gᵢ = f^R₀[i] . (fᵖ)^R₁[i], f^(R₀ + p.R₁) is evaluated by Horner's rule in u:
+#   (((g₉)^u . g₈)^u ... )^u . g₀
+# that is 9 exponentiations by the curve parameter u
+# and small exponentiations of at most 9 bits sharing their squarings.
+# The exponents are public constants, the computation is constant-time.
+
+const hardPartR0 = [-220, -263, -73, -314, -197, 269, 70, -103, 0, 0]
+const hardPartR1 = [229, 34, -181, 452, -65, -445, 492, 77, -276, 103]
+
+func cycl_exp_small_pair[Name: static Algebra](
+       r: var Fp6[Name],
+       f, fp: Fp6[Name],
+       e0, e1: static int) =
+  ## r <- f^e0 . fp^e1 for small public exponents
+  ## with f and fp in the cyclotomic subgroup.
+  ## Both exponentiations share their squarings (Shamir's trick)
+  const a0 = abs(e0)
+  const a1 = abs(e1)
+  static: doAssert (a0 or a1) != 0 and a0 < 1024 and a1 < 1024
+
+  var g0 {.noInit.}, g1 {.noInit.}, g01 {.noInit.}: Fp6[Name]
+  g0 = f
+  when e0 < 0:
+    g0.cyclotomic_inv()
+  g1 = fp
+  when e1 < 0:
+    g1.cyclotomic_inv()
+  g01.prod(g0, g1)
+
+  const top = block:
+    var i = 9
+    while ((a0 or a1) shr i) == 0:
+      i -= 1
+    i
+
+  template pick(r: untyped, b0, b1: static int, init: static bool) =
+    when b0 == 1 and b1 == 1:
+      when init: r = g01
+      else: r *= g01
+    elif b0 == 1:
+      when init: r = g0
+      else: r *= g0
+    elif b1 == 1:
+      when init: r = g1
+      else: r *= g1
+
+  r.pick((a0 shr top) and 1, (a1 shr top) and 1, init = true)
+  staticFor j, 0, top:
+    const i = top - 1 - j
+    r.cyclotomic_square()
+    r.pick((a0 shr i) and 1, (a1 shr i) and 1, init = false)
+
+func finalExpHard_BW6_761*[Name: static Algebra](f: var Fp6[Name]) {.meter.} =
+  ## Hard part of the final exponentiation for BW6-761
+  ## f <- f^(3(u³-u²+1)(p²-p+1)/r)
+  ##
+  ## `f` MUST be in the cyclotomic subgroup,
+  ## i.e. the output of the easy part of the final exponentiation.
+  var fp {.noInit.}, g {.noInit.}, t {.noInit.}: Fp6[Name]
+  fp.frobenius_map(f)
+
+  var acc {.noInit.}: Fp6[Name]
+  acc.cycl_exp_small_pair(f, fp, hardPartR0[9], hardPartR1[9])
+  staticFor j, 0, 9:
+    const i = 8 - j
+    t.cycl_exp_by_curve_param(acc)
+    g.cycl_exp_small_pair(f, fp, hardPartR0[i], hardPartR1[i])
+    acc.prod(t, g)
+
+  f = acc
 
 # Optimized pairing implementation
 # ----------------------------------------------------------------
@@ -159,3 +240,196 @@ func pairing_bw6_761_reference*[Name](
   gt.millerLoopBW6_761_naive(Q, P)
   gt.finalExpEasy()
   gt.finalExpHard_BW6_761()
+
+# Optimized multi-pairing implementation
+# ----------------------------------------------------------------
+#
+# - Optimized and secure pairing-friendly elliptic curves
+#   suitable for one layer proof composition
+#   Youssef El Housni and Aurore Guillevic, 2020
+#   https://eprint.iacr.org/2020/351.pdf
+#
+# The optimal ate pairing is
+#   f_{u+1,Q}(P) · (f_{u(u²-u-1),Q}(P))ᵖ
+# and both parts share f_{u,Q}:
+#   f_{u+1,Q}          = f_{u,Q} · l_{[u]Q,Q}
+#   f_{u(u²-u-1),Q}    = (f_{u,Q})^(u²-u-1) · f_{u²-u-1,[u]Q}
+# the vertical lines being eliminated by the final exponentiation.
+#
+# For a multi-pairing, the product M = ∏ f_{u,Qᵢ}(Pᵢ) is computed
+# with shared squarings, and the 2nd loop raises M to u²-u-1
+# with the same squarings as ∏ f_{u²-u-1,[u]Qᵢ}(Pᵢ),
+# multiplying by M or M⁻¹ on non-zero NAF digits.
+# Hence a chunk of pairs costs 2 shared squaring chains
+# of 64 and 127 bits, a single 𝔽p6 inversion and a single Frobenius
+# whatever the number of pairs in the chunk.
+#
+# The pairs are processed in chunks of at most 16 so that
+# the G2 accumulators live in fixed-size stack buffers (~8KB),
+# and the Miller loop outputs of the chunks are multiplied.
+
+const MillerLoopChunk = 16
+  ## Max pairs sharing squarings. The shared costs are amortized
+  ## to about 1/16 of a squaring chain per pair.
+
+func millerLoopBW6_761_chunk[Name: static Algebra](
+       f: var Fp6[Name],
+       Qs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G2]],
+       Ps: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+       N: int) {.noinline.} =
+  ## Optimal ate Miller loop of a multi-pairing for BW6-761
+  ## Computes ∏ f_{u+1,Qᵢ}(Pᵢ) · (f_{u(u²-u-1),Qᵢ}(Pᵢ))ᵖ
+  ## with all pairs sharing the 𝔽p6 squarings.
+  ##
+  ## N MUST be in [1, MillerLoopChunk]
+  ## and the points MUST NOT be the point at infinity.
+  debug: doAssert 1 <= N and N <= MillerLoopChunk
+  var Ts {.noInit.}: array[MillerLoopChunk, EC_ShortW_Prj[Fp[Name], G2]]
+  var Qus {.noInit.}: array[MillerLoopChunk, EC_ShortW_Aff[Fp[Name], G2]]
+  for i in 0 ..< N:
+    Ts[i].fromAffine(Qs[i])
+
+  var line {.noInit.}, pending {.noInit.}: Line[Fp[Name]]
+  var hasPending = false
+
+  template accumulate(g, line: untyped) =
+    # Merge lines 2 by 2 for sparse multiplication
+    if hasPending:
+      g.mul_by_2_lines(pending, line)
+      hasPending = false
+    else:
+      pending = line
+      hasPending = true
+
+  template flush(g: untyped) =
+    if hasPending:
+      g.mul_by_line(pending)
+      hasPending = false
+
+  # 1st part: M = ∏ f_{u,Qᵢ}(Pᵢ)
+  # ------------------------------
+  var mu {.noInit.}: Fp6[Name]
+  mu.basicMillerLoop(Ts.asUnchecked(), Ps, Qs, N, pairing(Name, ate_param_1_opt))
+  batchAffine(Qus.asUnchecked(), Ts.asUnchecked(), N) # [u]Qᵢ
+
+  # ∏ f_{u+1,Qᵢ}(Pᵢ) = M · ∏ l_{[u]Qᵢ,Qᵢ}(Pᵢ)
+  var muplusone {.noInit.}: Fp6[Name]
+  muplusone = mu
+  for i in 0 ..< N:
+    line.line_add(Ts[i], Qs[i], Ps[i])
+    muplusone.accumulate(line)
+  muplusone.flush()
+
+  # 2nd part: M^(u²-u-1) · ∏ f_{u²-u-1,[u]Qᵢ}(Pᵢ)
+  # ------------------------------
+  var minvu {.noInit.}: Fp6[Name]
+  minvu.inv(mu)
+  for i in 0 ..< N:
+    Ts[i].fromAffine(Qus[i])
+
+  const naf = pairing(Name, ate_param_2_opt).recodeNafForPairing()
+  var nQ {.noInit.}: EC_ShortW_Aff[Fp[Name], G2]
+
+  # The skipped most significant bit is 1: f_{1,[u]Q} = 1 and M¹
+  f = mu
+  for i in countdown(naf.len-1, 0):
+    let bit = naf[i]
+    f.square()
+
+    for j in 0 ..< N:
+      line.line_double(Ts[j], Ps[j])
+      f.accumulate(line)
+      if bit == 1:
+        line.line_add(Ts[j], Qus[j], Ps[j])
+        f.accumulate(line)
+      elif bit == -1:
+        nQ.neg(Qus[j])
+        line.line_add(Ts[j], nQ, Ps[j])
+        f.accumulate(line)
+    f.flush()
+
+    if bit == 1:
+      f *= mu
+    elif bit == -1:
+      f *= minvu
+
+  # Final
+  # ------------------------------
+  let t = f
+  f.frobenius_map(t)
+  f *= muplusone
+
+func millerLoopBW6_761*[Name: static Algebra](
+       f: var Fp6[Name],
+       Qs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G2]],
+       Ps: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+       N: int) {.meter.} =
+  ## Optimal ate Miller loop of a multi-pairing for BW6-761
+  ## Computes ∏ f_{u+1,Qᵢ}(Pᵢ) · (f_{u(u²-u-1),Qᵢ}(Pᵢ))ᵖ
+  ## with pairs sharing the 𝔽p6 squarings by chunks of 16.
+  ##
+  ## N MUST be at least 1
+  ## and the points MUST NOT be the point at infinity.
+  f.millerLoopBW6_761_chunk(Qs, Ps, min(N, MillerLoopChunk))
+
+  var partial {.noInit.}: Fp6[Name]
+  var i = MillerLoopChunk
+  while i < N:
+    partial.millerLoopBW6_761_chunk(Qs +% i, Ps +% i, min(N-i, MillerLoopChunk))
+    f *= partial
+    i += MillerLoopChunk
+
+func millerLoopBW6_761*[Name: static Algebra](
+       f: var Fp6[Name],
+       Q: EC_ShortW_Aff[Fp[Name], G2],
+       P: EC_ShortW_Aff[Fp[Name], G1]) {.inline.} =
+  ## Optimal ate Miller loop for BW6-761
+  ## Computes f_{u+1,Q}(P) · (f_{u(u²-u-1),Q}(P))ᵖ
+  var Qs {.noInit.}: array[1, EC_ShortW_Aff[Fp[Name], G2]]
+  var Ps {.noInit.}: array[1, EC_ShortW_Aff[Fp[Name], G1]]
+  Qs[0] = Q
+  Ps[0] = P
+  f.millerLoopBW6_761(Qs.asUnchecked(), Ps.asUnchecked(), 1)
+
+func finalExp_BW6_761*[Name: static Algebra](f: var Fp6[Name]) {.meter.} =
+  ## Final exponentiation for BW6-761
+  f.finalExpEasy()
+  f.finalExpHard_BW6_761()
+
+func pairing_bw6_761*[Name: static Algebra](
+       gt: var Fp6[Name],
+       P: EC_ShortW_Aff[Fp[Name], G1],
+       Q: EC_ShortW_Aff[Fp[Name], G2]) {.meter.} =
+  ## Compute the optimal Ate Pairing for BW6-761
+  ## Input: P ∈ G1, Q ∈ G2
+  ## Output: e(P, Q) ∈ Gt
+  gt.millerLoopBW6_761(Q, P)
+  gt.finalExp_BW6_761()
+
+func pairing_bw6_761*[Name: static Algebra](
+       gt: var Fp6[Name],
+       Ps: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G2]],
+       len: int) {.meter.} =
+  ## Compute the optimal Ate Pairing for BW6-761
+  ## Input: an array of Ps ∈ G1 and Qs ∈ G2
+  ## Output:
+  ##   The product of pairings
+  ##   e(P₀, Q₀) * e(P₁, Q₁) * e(P₂, Q₂) * ... * e(Pₙ, Qₙ) ∈ Gt
+  if len == 0:
+    gt.setOne()
+    return
+  gt.millerLoopBW6_761(Qs, Ps, len)
+  gt.finalExp_BW6_761()
+
+func pairing_bw6_761*[Name: static Algebra](
+       gt: var Fp6[Name],
+       Ps: openArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: openArray[EC_ShortW_Aff[Fp[Name], G2]]) {.inline.} =
+  ## Compute the optimal Ate Pairing for BW6-761
+  ## Input: an array of Ps ∈ G1 and Qs ∈ G2
+  ## Output:
+  ##   The product of pairings
+  ##   e(P₀, Q₀) * e(P₁, Q₁) * e(P₂, Q₂) * ... * e(Pₙ, Qₙ) ∈ Gt
+  debug: doAssert Ps.len == Qs.len
+  gt.pairing_bw6_761(Ps.asUnchecked(), Qs.asUnchecked(), Ps.len)
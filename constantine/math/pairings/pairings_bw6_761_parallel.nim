@@ -0,0 +1,104 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+when not compileOption("threads"):
+  {.error: "This requires --threads:on compilation flag".}
+
+import
+  constantine/named/algebras,
+  constantine/math/extension_fields,
+  constantine/math/elliptic/ec_shortweierstrass_affine,
+  constantine/platforms/abstractions,
+  constantine/threadpool/[threadpool, partitioners],
+  ./pairings_bw6_761
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# ############################################################
+#
+#              BW6-761 Multi-Pairings
+#                 Parallel Edition
+#
+# ############################################################
+
+# The optimal ate Miller loop output of a multi-pairing
+# is the product of the Miller loop outputs of any partition of the pairs.
+# Each task runs the shared-squarings Miller loop on a shard of the pairs,
+# the shards are multiplied and a single final exponentiation
+# is done on the caller thread.
+
+proc millerLoopBW6_761_parallel*[Name: static Algebra](
+       tp: Threadpool,
+       f: var Fp6[Name],
+       Ps: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G2]],
+       len: int) =
+  ## Compute the product of optimal ate Miller Loops
+  ##   ∏ fᵢ(Pᵢ, Qᵢ)
+  ##
+  ## The points MUST NOT be the point at infinity.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  if len == 0:
+    f.setOne()
+    return
+
+  let chunkDesc = balancedChunksPrioNumber(
+    start = 0, stopEx = len,
+    numChunks = min(len, tp.numThreads.int))
+
+  let partials = allocHeapArrayAligned(Fp6[Name], chunkDesc.numChunks, alignment = 64)
+
+  syncScope:
+    for iter in items(chunkDesc):
+      proc millerLoop_wrapper(
+             f: ptr Fp6[Name],
+             Qs: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G2]],
+             Ps: ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]],
+             len: int) {.nimcall.} =
+        # The borrow checker prevents capturing `var` and `openArray`
+        # so we capture pointers instead.
+        f[].millerLoopBW6_761(Qs, Ps, len)
+
+      tp.spawn millerLoop_wrapper(
+        partials[iter.chunkID].addr,
+        Qs +% iter.start, Ps +% iter.start, iter.size)
+
+  f = partials[0]
+  for i in 1 ..< chunkDesc.numChunks:
+    f *= partials[i]
+
+  freeHeapAligned(partials)
+
+proc pairing_bw6_761_parallel*[Name: static Algebra](
+       tp: Threadpool,
+       gt: var Fp6[Name],
+       Ps: openArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: openArray[EC_ShortW_Aff[Fp[Name], G2]]) =
+  ## Compute the multi-pairing
+  ##   ∏ e(Pᵢ, Qᵢ)
+  ## with the Miller Loops distributed over the threadpool
+  ## and a single final exponentiation.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  debug: doAssert Ps.len == Qs.len
+  tp.millerLoopBW6_761_parallel(gt, Ps.asUnchecked(), Qs.asUnchecked(), Ps.len)
+  gt.finalExp_BW6_761()
+
+proc pairing_check_bw6_761_parallel*[Name: static Algebra](
+       tp: Threadpool,
+       Ps: openArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: openArray[EC_ShortW_Aff[Fp[Name], G2]]): bool =
+  ## Returns true if ∏ e(Pᵢ, Qᵢ) == 1
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  var gt {.noInit.}: Fp6[Name]
+  tp.pairing_bw6_761_parallel(gt, Ps, Qs)
+  return gt.isOne().bool()
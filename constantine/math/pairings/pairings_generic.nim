@@ -8,14 +8,19 @@
 
 import
   constantine/named/algebras,
+  constantine/platforms/abstractions,
   ./cyclotomic_subgroups,
-  ./pairings_bn, ./pairings_bls12,
+  ./pairings_bn, ./pairings_bls12, ./pairings_bw6_761,
+  ./miller_loops_prepared,
   constantine/math/extension_fields,
   constantine/math/elliptic/ec_shortweierstrass_affine,
   constantine/math/elliptic/ec_shortweierstrass_jacobian,
   constantine/math/elliptic/ec_shortweierstrass_projective,
   constantine/named/zoo_pairings
 
+export miller_loops_prepared.PreparedG2, miller_loops_prepared.prepare
+export miller_loops_prepared.preparedG2Lines, miller_loops_prepared.preparedG2NumLines # generic sandwich
+
 func pairing*[Name: static Algebra](gt: var AnyFp12[Name], P, Q: auto) {.inline.} =
   when family(Name) == BarretoNaehrig:
     pairing_bn(gt, P, Q)
@@ -24,6 +29,12 @@ func pairing*[Name: static Algebra](gt: var AnyFp12[Name], P, Q: auto) {.inline.
   else:
     {.error: "Pairing not implemented for " & $Name.}
 
+func pairing*[Name: static Algebra](gt: var Fp6[Name], P, Q: auto) {.inline.} =
+  when Name == BW6_761:
+    pairing_bw6_761(gt, P, Q)
+  else:
+    {.error: "Pairing not implemented for " & $Name.}
+
 func pairing_check*[Name: static Algebra](
        P0: EC_ShortW_Aff[Fp[Name], G1],
        Q0: EC_ShortW_Aff[Fp2[Name], G2],
@@ -121,3 +132,59 @@ func finalExpHard*[Name: static Algebra](gt: var AnyFp12[Name]) {.inline.} =
 func finalExp*[Name: static Algebra](gt: var AnyFp12[Name]){.inline.} =
   gt.finalExpEasy()
   gt.finalExpHard()
+
+export finalExpEasy_batch
+
+func finalExp_batch*[Name: static Algebra](
+       gts: ptr UncheckedArray[Fp12[Name]], N: int) {.tags:[HeapAlloc], meter.} =
+  ## Final exponentiation of N independent Miller loop outputs
+  ##
+  ## The easy part shares a single 𝔽p12 inversion
+  ## with Montgomery's batch inversion trick.
+  gts.finalExpEasy_batch(N)
+  for i in 0 ..< N:
+    gts[i].finalExpHard()
+
+func finalExp_batch*[Name: static Algebra](gts: var openArray[Fp12[Name]]) {.inline.} =
+  ## Final exponentiation of independent Miller loop outputs
+  ##
+  ## The easy part shares a single 𝔽p12 inversion
+  ## with Montgomery's batch inversion trick.
+  finalExp_batch(gts.asUnchecked(), gts.len)
+
+# Prepared 𝔾2 points
+# ----------------------------------------------------------------
+#
+# For pairings repeatedly computed with the same 𝔾2 point
+# (generator, trusted setup), the Miller loop lines can be precomputed.
+# See `miller_loops_prepared`
+#
+# Prepared points are passed by address to the Miller loop,
+# copying them into arrays would move ~20KB per pairing check.
+
+func pairing_check*[Name: static Algebra](
+       P0: EC_ShortW_Aff[Fp[Name], G1],
+       Q0: EC_ShortW_Aff[Fp2[Name], G2],
+       P1: EC_ShortW_Aff[Fp[Name], G1],
+       Q1: PreparedG2[Name]): bool =
+  var gt {.noInit.}: Name.getGT()
+  let preparedQs = [Q1.unsafeAddr]
+  gt.millerLoopPrepared(
+    cast[ptr UncheckedArray[EC_ShortW_Aff[Fp2[Name], G2]]](Q0.unsafeAddr),
+    cast[ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]]](P0.unsafeAddr), 1,
+    preparedQs.asUnchecked(),
+    cast[ptr UncheckedArray[EC_ShortW_Aff[Fp[Name], G1]]](P1.unsafeAddr), 1)
+  gt.finalExp()
+  return gt.isOne().bool()
+
+func pairing_check*[Name: static Algebra](
+       P0: EC_ShortW_Aff[Fp[Name], G1],
+       Q0: PreparedG2[Name],
+       P1: EC_ShortW_Aff[Fp[Name], G1],
+       Q1: PreparedG2[Name]): bool =
+  var gt {.noInit.}: Name.getGT()
+  let preparedQs = [Q0.unsafeAddr, Q1.unsafeAddr]
+  let Ps = [P0, P1]
+  gt.millerLoopPrepared(nil, nil, 0, preparedQs.asUnchecked(), Ps.asUnchecked(), 2)
+  gt.finalExp()
+  return gt.isOne().bool()
@@ -0,0 +1,153 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+when not compileOption("threads"):
+  {.error: "This requires --threads:on compilation flag".}
+
+import
+  constantine/named/algebras,
+  constantine/math/extension_fields,
+  constantine/math/elliptic/ec_shortweierstrass_affine,
+  constantine/platforms/abstractions,
+  constantine/threadpool/[threadpool, partitioners],
+  ./pairings_generic,
+  ./miller_accumulators
+
+# No exceptions allowed in core cryptographic operations
+{.push raises: [].}
+{.push checks: off.}
+
+# ############################################################
+#
+#                  Multi-Pairings
+#                 Parallel Edition
+#
+# ############################################################
+
+# Each task accumulates a shard of the pairs in a Miller Loop accumulator,
+# accumulators are merged in the threadpool reduction tree
+# and a single final exponentiation is done on the caller thread.
+
+proc multiMillerLoop_parallel*[FF1, FF2, FpK](
+       tp: Threadpool,
+       gt: var FpK,
+       Ps: ptr UncheckedArray[EC_ShortW_Aff[FF1, G1]],
+       Qs: ptr UncheckedArray[EC_ShortW_Aff[FF2, G2]],
+       len: int) =
+  ## Compute the product of Miller Loops
+  ##   ∏ fᵢ(Pᵢ, Qᵢ)
+  ## Pairs where Pᵢ or Qᵢ is the point at infinity are skipped
+  ## as they do not contribute to the product of pairings.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  ##
+  ## ⚠️: This reveals if a point is infinity through timing side-channels
+  type Acc = MillerAccumulator[FF1, FF2, FpK]
+
+  mixin globalAcc
+
+  const chunkSize = 8 # Matches the accumulator buffer size
+
+  tp.parallelFor i in 0 ..< len:
+    stride: chunkSize
+    captures: {Ps, Qs, len}
+    reduceInto(globalAcc: Flowvar[ptr Acc]):
+      prologue:
+        var workerAcc = allocHeap(Acc)
+        workerAcc[].init()
+      forLoop:
+        for j in i ..< min(i+chunkSize, len):
+          discard workerAcc[].update(Ps[j], Qs[j])
+      merge(remoteAccFut: Flowvar[ptr Acc]):
+        let remoteAcc = sync(remoteAccFut)
+        workerAcc[].merge(remoteAcc[])
+        freeHeap(remoteAcc)
+      epilogue:
+        workerAcc[].handover()
+        return workerAcc
+
+  let ctx = sync(globalAcc)
+  ctx[].finish(gt)
+  freeHeap(ctx)
+
+proc multiMillerLoop_parallel*[FF1, FF2, FpK](
+       tp: Threadpool,
+       gt: var FpK,
+       Ps: openArray[EC_ShortW_Aff[FF1, G1]],
+       Qs: openArray[EC_ShortW_Aff[FF2, G2]]) {.inline.} =
+  ## Compute the product of Miller Loops
+  ##   ∏ fᵢ(Pᵢ, Qᵢ)
+  ## Pairs where Pᵢ or Qᵢ is the point at infinity are skipped.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  debug: doAssert Ps.len == Qs.len
+  tp.multiMillerLoop_parallel(gt, Ps.asUnchecked(), Qs.asUnchecked(), Ps.len)
+
+proc pairing_parallel*[Name: static Algebra](
+       tp: Threadpool,
+       gt: var AnyFp12[Name],
+       Ps: openArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: openArray[EC_ShortW_Aff[Fp2[Name], G2]]) =
+  ## Compute the multi-pairing
+  ##   ∏ e(Pᵢ, Qᵢ)
+  ## with the Miller Loops distributed over the threadpool
+  ## and a single final exponentiation.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  tp.multiMillerLoop_parallel(gt, Ps, Qs)
+  gt.finalExp()
+
+proc pairing_check_parallel*[Name: static Algebra](
+       tp: Threadpool,
+       Ps: openArray[EC_ShortW_Aff[Fp[Name], G1]],
+       Qs: openArray[EC_ShortW_Aff[Fp2[Name], G2]]): bool =
+  ## Returns true if ∏ e(Pᵢ, Qᵢ) == 1
+  ## The empty product is 1, hence no pairs returns true.
+  ## Returns false if Ps and Qs have different lengths.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  if Ps.len != Qs.len:
+    return false
+  if Ps.len == 0:
+    return true
+  var gt {.noInit.}: Name.getGT()
+  tp.pairing_parallel(gt, Ps, Qs)
+  return gt.isOne().bool()
+
+# ############################################################
+#
+#            Batched Final Exponentiation
+#                 Parallel Edition
+#
+# ############################################################
+
+proc finalExp_batch_parallel*[Name: static Algebra](
+       tp: Threadpool,
+       gts: var openArray[Fp12[Name]]) =
+  ## Final exponentiation of independent Miller loop outputs
+  ##
+  ## The outputs are split into one chunk per thread,
+  ## each chunk shares a single 𝔽p12 inversion for its easy part.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let N = gts.len
+  if N == 0:
+    return
+
+  let chunkDesc = balancedChunksPrioNumber(
+    start = 0, stopEx = N,
+    numChunks = min(N, tp.numThreads.int))
+
+  syncScope:
+    for iter in items(chunkDesc):
+      proc finalExp_batch_wrapper(gts: ptr UncheckedArray[Fp12[Name]], len: int) {.nimcall.} =
+        # The borrow checker prevents capturing `var` and `openArray`
+        # so we capture pointers instead.
+        gts.finalExp_batch(len)
+
+      tp.spawn finalExp_batch_wrapper(gts.asUnchecked() +% iter.start, iter.size)
@@ -36,6 +36,7 @@ type
     FFT_InconsistentInputOutputLengths = "Output length must match input length"
     FFT_TooManyValues = "Input length greater than the field 2-adicity (number of roots of unity)"
     FFT_SizeNotPowerOfTwo = "Input must be of a power of 2 length"
+    FFT_BatchSizeMismatch = "Input length must be a multiple of the batch size"
 
 template checkSizesReturnEarly*(desc, output, vals: untyped): untyped =
   ## Validate FFT input sizes and return early with appropriate FFTStatus on failure.
@@ -123,6 +124,40 @@ func bit_reversal_permutation_naive[T](buf: var openArray[T]) {.used.} =
     if i < rev_i:
       swap(buf[i], buf[rev_i])
 
+func bit_reversal_permutation_cobra_tiles[T](
+       dst{.noalias.}: ptr UncheckedArray[T],
+       src{.noalias.}: ptr UncheckedArray[T],
+       t: ptr UncheckedArray[T],
+       logN, logTileSize: uint,
+       bStart, bStop: uint) =
+  ## COBRA inner loops for the tiles b ∈ [bStart, bStop)
+  ## `t` is a scratch buffer of size 2^(2*logTileSize)
+  ##
+  ## Tiles write to disjoint destinations
+  ## and can be processed independently.
+  let logBLen = logN - 2*logTileSize
+  let tileSize = 1'u shl logTileSize
+
+  for b in bStart ..< bStop:
+    let bRev = reverseBits(b, logBLen)
+
+    for a in 0'u ..< tileSize:
+      let aRev = reverseBits(a, logTileSize)
+      for c in 0'u ..< tileSize:
+        # T[a'c] = A[abc]
+        let tIdx = (aRev shl logTileSize) or c
+        let idx = (a shl (logBLen+logTileSize)) or
+                  (b shl logTileSize) or c
+        t[tIdx] = src[idx]
+
+    for c in 0'u ..< tileSize:
+      let cRev = reverseBits(c, logTileSize)
+      for aRev in 0'u ..< tileSize:
+        let idx = (cRev shl (logBLen+logTileSize)) or
+                  (bRev shl logTileSize) or aRev
+        let tIdx = (aRev shl logTileSize) or c
+        dst[idx] = t[tIdx]
+
 func bit_reversal_permutation_cobra[T](dst{.noalias.}: var openArray[T], src{.noalias.}: openArray[T]) =
   ## Out-of-place bit reversal permutation using the COBRA algorithm
   ## (Cache Optimal BitReverse Algorithm from Carter & Gatlin, 1998)
@@ -159,32 +194,13 @@ func bit_reversal_permutation_cobra[T](dst{.noalias.}: var openArray[T], src{.no
 
   let logN = log2_vartime(uint src.len)
   let logTileSize = deriveLogTileSize(T, logN)
-  let logBLen = logN - 2*logTileSize
-  let bLen = 1'u shl logBLen
+  let bLen = 1'u shl (logN - 2*logTileSize)
   let tileSize = 1'u shl logTileSize
 
   let t = allocHeapArray(T, tileSize*tileSize)
-
-  for b in 0'u ..< bLen:
-    let bRev = reverseBits(b, logBLen)
-
-    for a in 0'u ..< tileSize:
-      let aRev = reverseBits(a, logTileSize)
-      for c in 0'u ..< tileSize:
-        # T[a'c] = A[abc]
-        let tIdx = (aRev shl logTileSize) or c
-        let idx = (a shl (logBLen+logTileSize)) or
-                  (b shl logTileSize) or c
-        t[tIdx] = src[idx]
-
-    for c in 0'u ..< tileSize:
-      let cRev = reverseBits(c, logTileSize)
-      for aRev in 0'u ..< tileSize:
-        let idx = (cRev shl (logBLen+logTileSize)) or
-                  (bRev shl logTileSize) or aRev
-        let tIdx = (aRev shl logTileSize) or c
-        dst[idx] = t[tIdx]
-
+  bit_reversal_permutation_cobra_tiles(
+    dst.asUnchecked(), src.asUnchecked(), t,
+    logN, logTileSize, 0'u, bLen)
   freeHeap(t)
 
 func bit_reversal_permutation_cobra[T](buf: var openArray[T]) {.used.} =
@@ -0,0 +1,110 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Test with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_bit_reversal_parallel.nim
+
+import ./fft_common {.all.}
+export fft_common
+
+import
+  constantine/platforms/[abstractions, allocs, views],
+  constantine/threadpool/threadpool
+
+{.push raises: [], checks: off.} # No exceptions
+
+# ############################################################
+#
+#              Bit-Reversal Permutations for FFT
+#                     Parallel Edition
+#
+# ############################################################
+
+const bitReversalParallelThreshold* = 14
+  ## Threshold (as log2) above which the bit-reversal permutation is parallelized.
+  ## Below this threshold, the permutation fits in cache and threading overhead dominates.
+
+proc bit_reversal_permutation_noalias_parallel[T](
+       tp: Threadpool,
+       dst{.noalias.}: ptr UncheckedArray[T],
+       src{.noalias.}: ptr UncheckedArray[T],
+       len: int) =
+  ## Out-of-place parallel bit reversal permutation (no aliasing between dst and src).
+  ##
+  ## COBRA tiles write to disjoint destinations,
+  ## each task processes a band of tiles with its own L1-sized scratch buffer.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let logN = log2_vartime(uint len)
+  if logN < bitReversalParallelThreshold:
+    bit_reversal_permutation_noalias(dst.toOpenArray(len), src.toOpenArray(len))
+    return
+
+  let logTileSize = deriveLogTileSize(T, logN)
+  let bLen = int(1'u shl (logN - 2*logTileSize))
+  let tileSize = 1'u shl logTileSize
+
+  const tilesPerTask = 16
+
+  syncScope:
+    tp.parallelFor b in 0 ..< bLen:
+      stride: tilesPerTask
+      captures: {dst, src, logN, logTileSize, bLen, tileSize}
+      let t = allocHeapArray(T, tileSize*tileSize)
+      bit_reversal_permutation_cobra_tiles(
+        dst, src, t, logN, logTileSize,
+        uint(b), uint(min(b+tilesPerTask, bLen)))
+      freeHeap(t)
+
+proc copy_parallel[T](
+       tp: Threadpool,
+       dst{.noalias.}: ptr UncheckedArray[T],
+       src{.noalias.}: ptr UncheckedArray[T],
+       len: int) =
+  ## Parallel copy of `len` elements from src to dst
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  const chunkSize = 4096
+  syncScope:
+    tp.parallelFor i in 0 ..< len:
+      stride: chunkSize
+      captures: {dst, src, len}
+      copyMem(dst[i].addr, src[i].addr, min(chunkSize, len-i) * sizeof(T))
+
+proc bit_reversal_permutation_parallel*[T](
+       tp: Threadpool,
+       dst: var openArray[T],
+       src: openArray[T]) =
+  ## Parallel out-of-place bit reversal permutation with aliasing detection.
+  ##
+  ## If dst and src are the same array (aliasing), a temporary buffer is allocated.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  debug: doAssert dst.len.uint.isPowerOf2_vartime()
+  debug: doAssert dst.len == src.len
+  debug: doAssert dst.len > 0
+
+  let n = src.len
+  if dst[0].addr == src[0].addr:
+    # Alias: allocate temp, permute to temp, copy back
+    let tmp = allocHeapArrayAligned(T, n, alignment = 64)
+    tp.bit_reversal_permutation_noalias_parallel(tmp, src.asUnchecked(), n)
+    tp.copy_parallel(dst.asUnchecked(), tmp, n)
+    freeHeapAligned(tmp)
+  else:
+    tp.bit_reversal_permutation_noalias_parallel(dst.asUnchecked(), src.asUnchecked(), n)
+
+proc bit_reversal_permutation_parallel*[T](
+       tp: Threadpool,
+       buf: var openArray[T]) =
+  ## Parallel in-place bit reversal permutation.
+  ##
+  ## Out-of-place is at least 2x faster than in-place so dispatch to out-of-place
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  tp.bit_reversal_permutation_parallel(buf, buf)
@@ -16,6 +16,7 @@ import
   constantine/math/io/[io_bigints, io_fields],
   constantine/math/ec_shortweierstrass,
   constantine/math/elliptic/ec_scalar_mul_vartime,
+  constantine/math/matrix/transpose,
   constantine/platforms/[abstractions, allocs, views],
   ./fft_common
 
@@ -31,15 +32,42 @@ export
 #
 # ############################################################
 
+const fftCosetCacheSize* = 2
+  ## Number of (coset shift, size) pairs whose fused twiddles
+  ## can be cached in a FrFFT_Descriptor
+
 type
+  FFTRadix* = enum
+    ## Radix of the iterative FFT kernels.
+    ## Higher radices fuse several radix-2 stages
+    ## and reduce the number of passes over memory.
+    kRadix2
+    kRadix4
+    kRadix8
+
+  CosetTwiddles[F] = object
+    ## Coset FFT twiddles with the coset shift powers folded in,
+    ## see `precomputeCosetTwiddles`
+    size: int
+    shift: F
+    fwd: ptr UncheckedArray[F]
+    inv: ptr UncheckedArray[F]
+
   FrFFT_Descriptor*[F] = object
     ## Metadata for FFT on field elements
     order*: int
     rootsOfUnity*: ptr UncheckedArray[F]
+    radix*: FFTRadix
+    cosets: array[fftCosetCacheSize, CosetTwiddles[F]]
 
 proc `=destroy`*[F](ctx: FrFFT_Descriptor[F]) =
   if not ctx.rootsOfUnity.isNil():
     ctx.rootsOfUnity.freeHeapAligned()
+  for i in 0 ..< ctx.cosets.len:
+    if not ctx.cosets[i].fwd.isNil():
+      ctx.cosets[i].fwd.freeHeapAligned()
+    if not ctx.cosets[i].inv.isNil():
+      ctx.cosets[i].inv.freeHeapAligned()
 
 func computeRootsOfUnity[F](ctx: var FrFFT_Descriptor[F], generatorRootOfUnity: F) =
   ctx.rootsOfUnity[0].setOne()
@@ -51,8 +79,9 @@ func computeRootsOfUnity[F](ctx: var FrFFT_Descriptor[F], generatorRootOfUnity:
 
   doAssert ctx.rootsOfUnity[ctx.order].isOne().bool()
 
-func new*(T: type FrFFT_Descriptor, order: int, generatorRootOfUnity: auto): T =
+func new*(T: type FrFFT_Descriptor, order: int, generatorRootOfUnity: auto, radix = kRadix2): T =
   result.order = order
+  result.radix = radix
   result.rootsOfUnity = allocHeapArrayAligned(T.F, order+1, alignment = 64)
 
   result.computeRootsOfUnity(generatorRootOfUnity)
@@ -147,6 +176,321 @@ func ifft_nn_recursive[F](
 
   return FFT_Success
 
+# ############################################################
+#
+#          Higher-Radix Iterative FFT kernels
+#
+# ############################################################
+# Radix-2 iterative FFTs load and store every element once per stage,
+# i.e. log₂(n) passes over memory.
+# Radix-4 (resp. radix-8) kernels fuse 2 (resp. 3) radix-2 stages
+# by keeping 4 (resp. 8) elements in registers.
+# When log₂(n) is not a multiple of the radix bits,
+# the remaining stages use a smaller radix (mixed-radix).
+#
+# Radix-4 DIF butterfly, for a block of length L with q = L/4,
+# ω a L-th root of unity and i = ω^q a 4th root of unity:
+#   x₀, x₁, x₂, x₃ = x[j], x[j+q], x[j+2q], x[j+3q]
+#
+#   x[j]    =  (x₀+x₂) +  (x₁+x₃)
+#   x[j+q]  = ((x₀+x₂) -  (x₁+x₃)) ω²ʲ
+#   x[j+2q] = ((x₀-x₂) + i(x₁-x₃)) ωʲ
+#   x[j+3q] = ((x₀-x₂) - i(x₁-x₃)) ω³ʲ
+#
+# Radix-4 DIT butterfly, with
+#   y₀, y₁, y₂, y₃ = x[j], x[j+q]ω²ʲ, x[j+2q]ωʲ, x[j+3q]ω³ʲ
+#
+#   x[j]    = (y₀+y₁) +  (y₂+y₃)
+#   x[j+q]  = (y₀-y₁) + i(y₂-y₃)
+#   x[j+2q] = (y₀+y₁) -  (y₂+y₃)
+#   x[j+3q] = (y₀-y₁) - i(y₂-y₃)
+#
+# i is read once per pass from the precomputed roots of unity.
+# Radix-8 butterflies are a radix-2 stage fused with radix-4 butterflies on each half.
+# The first butterfly of each block (j = 0) has trivial twiddles ω⁰ = 1 which are skipped.
+
+func dif_butterfly4[F](
+       x0, x1, x2, x3: var F,
+       w1, w2, w3, imag: F,
+       trivialTwiddles: bool) {.inline.} =
+  ## Radix-4 DIF butterfly
+  ## w1, w2, w3 are ωʲ, ω²ʲ, ω³ʲ
+  var t0 {.noInit.}: F
+  var t1 {.noInit.}: F
+  var t2 {.noInit.}: F
+  var t3 {.noInit.}: F
+
+  t0.sum(x0, x2)
+  t1.diff(x0, x2)
+  t2.sum(x1, x3)
+  t3.diff(x1, x3)
+  t3 *= imag
+
+  x0.sum(t0, t2)
+  x1.diff(t0, t2)
+  x2.sum(t1, t3)
+  x3.diff(t1, t3)
+
+  if not trivialTwiddles:
+    x1 *= w2
+    x2 *= w1
+    x3 *= w3
+
+func dit_butterfly4[F](
+       x0, x1, x2, x3: var F,
+       w1, w2, w3, imag: F,
+       trivialTwiddles: bool) {.inline.} =
+  ## Radix-4 DIT butterfly
+  ## w1, w2, w3 are ωʲ, ω²ʲ, ω³ʲ
+  if not trivialTwiddles:
+    x1 *= w2
+    x2 *= w1
+    x3 *= w3
+
+  var t0 {.noInit.}: F
+  var t1 {.noInit.}: F
+  var t2 {.noInit.}: F
+  var t3 {.noInit.}: F
+
+  t0.sum(x0, x1)
+  t1.diff(x0, x1)
+  t2.sum(x2, x3)
+  t3.diff(x2, x3)
+  t3 *= imag
+
+  x0.sum(t0, t2)
+  x2.diff(t0, t2)
+  x1.sum(t1, t3)
+  x3.diff(t1, t3)
+
+func fft_dif_radix2_pass[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       length: int) =
+  ## Radix-2 DIF stage on blocks of size `length`
+  let n = output.len
+  let half = length shr 1
+  let step = n div length
+
+  var i = 0
+  while i < n:
+    for j in 0 ..< half:
+      var t {.noInit.}: F
+      t.diff(output[i + j], output[i + j + half])
+      output[i + j] += output[i + j + half]
+      output[i + j + half].prod(t, rootsOfUnity[j*step])
+    i += length
+
+func fft_dit_radix2_pass[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       length: int) =
+  ## Radix-2 DIT stage on blocks of size `length`
+  let n = output.len
+  let half = length shr 1
+  let step = n div length
+
+  var i = 0
+  while i < n:
+    for j in 0 ..< half:
+      var t {.noInit.}: F
+      t.prod(output[i + j + half], rootsOfUnity[j*step])
+      output[i + j + half].diff(output[i + j], t)
+      output[i + j] += t
+    i += length
+
+func fft_dif_radix4_pass[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       length: int) =
+  ## Radix-4 DIF pass on blocks of size `length`
+  ## Fuses the radix-2 stages of size `length` and `length/2`
+  let n = output.len
+  let q = length shr 2
+  let step = n div length
+  let imag = rootsOfUnity[n shr 2]
+
+  var i = 0
+  while i < n:
+    for j in 0 ..< q:
+      var x0 = output[i + j]
+      var x1 = output[i + j + q]
+      var x2 = output[i + j + 2*q]
+      var x3 = output[i + j + 3*q]
+      dif_butterfly4(
+        x0, x1, x2, x3,
+        rootsOfUnity[j*step], rootsOfUnity[2*j*step], rootsOfUnity[3*j*step],
+        imag, trivialTwiddles = j == 0)
+      output[i + j]       = x0
+      output[i + j + q]   = x1
+      output[i + j + 2*q] = x2
+      output[i + j + 3*q] = x3
+    i += length
+
+func fft_dit_radix4_pass[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       length: int) =
+  ## Radix-4 DIT pass on blocks of size `length`
+  ## Fuses the radix-2 stages of size `length/2` and `length`
+  let n = output.len
+  let q = length shr 2
+  let step = n div length
+  let imag = rootsOfUnity[n shr 2]
+
+  var i = 0
+  while i < n:
+    for j in 0 ..< q:
+      var x0 = output[i + j]
+      var x1 = output[i + j + q]
+      var x2 = output[i + j + 2*q]
+      var x3 = output[i + j + 3*q]
+      dit_butterfly4(
+        x0, x1, x2, x3,
+        rootsOfUnity[j*step], rootsOfUnity[2*j*step], rootsOfUnity[3*j*step],
+        imag, trivialTwiddles = j == 0)
+      output[i + j]       = x0
+      output[i + j + q]   = x1
+      output[i + j + 2*q] = x2
+      output[i + j + 3*q] = x3
+    i += length
+
+func fft_dif_radix8_pass[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       length: int) =
+  ## Radix-8 DIF pass on blocks of size `length`
+  ## Fuses the radix-2 stages of size `length`, `length/2` and `length/4`
+  let n = output.len
+  let s = length shr 3
+  let step = n div length
+  let imag = rootsOfUnity[n shr 2]
+
+  var x {.noInit.}: array[8, F]
+
+  var i = 0
+  while i < n:
+    for j in 0 ..< s:
+      for m in 0 ..< 8:
+        x[m] = output[i + j + m*s]
+
+      # Radix-2 stage of size L, twiddles ω^(j+ms) = ωʲ⋅ω₈ᵐ
+      for m in 0 ..< 4:
+        var t {.noInit.}: F
+        t.diff(x[m], x[m+4])
+        x[m] += x[m+4]
+        if j == 0 and m == 0:
+          x[m+4] = t
+        else:
+          x[m+4].prod(t, rootsOfUnity[(j + m*s)*step])
+
+      # Radix-4 stages of size L/2 and L/4 on each half, twiddles (ω²)ʲ, (ω²)²ʲ, (ω²)³ʲ
+      let trivial = j == 0
+      let w1 = rootsOfUnity[2*j*step]
+      let w2 = rootsOfUnity[4*j*step]
+      let w3 = rootsOfUnity[6*j*step]
+      dif_butterfly4(x[0], x[1], x[2], x[3], w1, w2, w3, imag, trivial)
+      dif_butterfly4(x[4], x[5], x[6], x[7], w1, w2, w3, imag, trivial)
+
+      for m in 0 ..< 8:
+        output[i + j + m*s] = x[m]
+    i += length
+
+func fft_dit_radix8_pass[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       length: int) =
+  ## Radix-8 DIT pass on blocks of size `length`
+  ## Fuses the radix-2 stages of size `length/4`, `length/2` and `length`
+  let n = output.len
+  let s = length shr 3
+  let step = n div length
+  let imag = rootsOfUnity[n shr 2]
+
+  var x {.noInit.}: array[8, F]
+
+  var i = 0
+  while i < n:
+    for j in 0 ..< s:
+      for m in 0 ..< 8:
+        x[m] = output[i + j + m*s]
+
+      # Radix-4 stages of size L/4 and L/2 on each half, twiddles (ω²)ʲ, (ω²)²ʲ, (ω²)³ʲ
+      let trivial = j == 0
+      let w1 = rootsOfUnity[2*j*step]
+      let w2 = rootsOfUnity[4*j*step]
+      let w3 = rootsOfUnity[6*j*step]
+      dit_butterfly4(x[0], x[1], x[2], x[3], w1, w2, w3, imag, trivial)
+      dit_butterfly4(x[4], x[5], x[6], x[7], w1, w2, w3, imag, trivial)
+
+      # Radix-2 stage of size L, twiddles ω^(j+ms) = ωʲ⋅ω₈ᵐ
+      for m in 0 ..< 4:
+        var t {.noInit.}: F
+        if j == 0 and m == 0:
+          t = x[m+4]
+        else:
+          t.prod(x[m+4], rootsOfUnity[(j + m*s)*step])
+        x[m+4].diff(x[m], t)
+        x[m] += t
+
+      for m in 0 ..< 8:
+        output[i + j + m*s] = x[m]
+    i += length
+
+func fft_nr_impl_iterative_dif_mixed_radix[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       radix: FFTRadix) =
+  ## In-place iterative mixed-radix FFT (DIF - Decimation-In-Frequency)
+  ## Input: natural order values
+  ## Output: bit-reversed order values in Fourier domain
+  ##
+  ## Uses passes of the requested radix,
+  ## remaining stages use smaller radices.
+  var length = output.len
+
+  if radix == kRadix8:
+    while length >= 8:
+      output.fft_dif_radix8_pass(rootsOfUnity, length)
+      length = length shr 3
+  while length >= 4:
+    output.fft_dif_radix4_pass(rootsOfUnity, length)
+    length = length shr 2
+  if length == 2:
+    output.fft_dif_radix2_pass(rootsOfUnity, length)
+
+func fft_rn_impl_iterative_dit_mixed_radix[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       radix: FFTRadix) =
+  ## In-place iterative mixed-radix FFT (DIT - Decimation-In-Time)
+  ## Input: bit-reversed order values
+  ## Output: natural order values in Fourier domain
+  ##
+  ## Uses passes of the requested radix,
+  ## remaining (smallest) stages use smaller radices.
+  let n = output.len
+  let logN = int log2_vartime(uint n)
+  let radixBits = if radix == kRadix8: 3 else: 2
+
+  var length = 1
+  case logN mod radixBits
+  of 1:
+    length = 2
+    output.fft_dit_radix2_pass(rootsOfUnity, length)
+  of 2:
+    length = 4
+    output.fft_dit_radix4_pass(rootsOfUnity, length)
+  else:
+    discard
+
+  while length < n:
+    length = length shl radixBits
+    if radix == kRadix8:
+      output.fft_dit_radix8_pass(rootsOfUnity, length)
+    else:
+      output.fft_dit_radix4_pass(rootsOfUnity, length)
+
 # ############################################################
 #
 #              Iterative FFT (Natural → Bit-Reversed)
@@ -184,6 +528,16 @@ func fft_nr_impl_iterative_dif[F](
 
     length = length shr 1
 
+func fft_nr_impl_iterative_dif[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       radix: FFTRadix) {.inline.} =
+  ## In-place iterative FFT (DIF), dispatching on the kernel radix
+  if radix == kRadix2:
+    fft_nr_impl_iterative_dif(output, rootsOfUnity)
+  else:
+    fft_nr_impl_iterative_dif_mixed_radix(output, rootsOfUnity, radix)
+
 func fft_nr_iterative_dif[F](
        desc: FrFFT_Descriptor[F],
        output: var openarray[F],
@@ -216,7 +570,7 @@ func fft_nr_iterative_dif[F](
 
   # In-place iterative FFT
   var voutput = output.toStridedView()
-  fft_nr_impl_iterative_dif(voutput, rootz)
+  fft_nr_impl_iterative_dif(voutput, rootz, desc.radix)
 
   return FFT_Success
 
@@ -257,6 +611,16 @@ func fft_rn_impl_iterative_dit[F](
 
     length = length shl 1
 
+func fft_rn_impl_iterative_dit[F](
+       output: var StridedView[F],
+       rootsOfUnity: StridedView[F],
+       radix: FFTRadix) {.inline.} =
+  ## In-place iterative FFT (DIT), dispatching on the kernel radix
+  if radix == kRadix2:
+    fft_rn_impl_iterative_dit(output, rootsOfUnity)
+  else:
+    fft_rn_impl_iterative_dit_mixed_radix(output, rootsOfUnity, radix)
+
 func fft_rn_iterative_dit[F](
        desc: FrFFT_Descriptor[F],
        output: var openarray[F],
@@ -284,13 +648,14 @@ func fft_rn_iterative_dit[F](
 
   # In-place iterative DIT FFT (bit-reversed → natural)
   var voutput = output.toStridedView()
-  fft_rn_impl_iterative_dit(voutput, rootz)
+  fft_rn_impl_iterative_dit(voutput, rootz, desc.radix)
 
   return FFT_Success
 
 func ifft_rn_impl_iterative_dit[F](
        output: var StridedView[F],
-       rootsOfUnity: StridedView[F]) {.inline.} =
+       rootsOfUnity: StridedView[F],
+       radix: FFTRadix) {.inline.} =
   ## In-place iterative IFFT (Cooley-Tukey DIT - Decimation-In-Time)
   ## Input: bit-reversed order values in Fourier domain
   ## Output: natural order values
@@ -298,25 +663,7 @@ func ifft_rn_impl_iterative_dit[F](
   ## Uses inverse roots of unity and applies 1/n scaling at the end
   let n = output.len
 
-  var length = 2
-  while length <= n:
-    let half = length shr 1
-    let step = n div length
-
-    var i = 0
-    while i < n:
-      var k = 0
-      for j in 0 ..< half:
-        var t {.noInit.}: F
-        t.prod(output[i + j + half], rootsOfUnity[k])
-
-        output[i + j + half] = output[i + j] - t
-        output[i + j] += t
-
-        k += step
-      i += length
-
-    length = length shl 1
+  fft_rn_impl_iterative_dit(output, rootsOfUnity, radix)
 
   # Apply 1/n scaling
   var invLen {.noInit.}: F
@@ -356,7 +703,7 @@ func ifft_rn_iterative_dit[F](
 
   # In-place iterative DIT IFFT (bit-reversed → natural)
   var voutput = output.toStridedView()
-  ifft_rn_impl_iterative_dit(voutput, rootz)
+  ifft_rn_impl_iterative_dit(voutput, rootz, desc.radix)
 
   return FFT_Success
 
@@ -478,6 +825,129 @@ func fft_nn_stockham[F](
   freeHeapAligned(temp_buf)
   return FFT_Success
 
+# ############################################################
+#
+#           Four-Step FFT (Natural → Bit-Reversed)
+#
+# ############################################################
+# The four-step FFT views a vector of size n = n₁n₂ as a matrix
+# and replaces the log₂(n) passes over the whole array
+# by many small FFTs that fit in cache.
+#
+# With j = j₁ + n₁j₂ and k = k₂ + n₂k₁
+#   X[k₂ + n₂k₁] = ∑ⱼ₁ ω₁^(j₁k₁) ⋅ ω^(j₁k₂) ⋅ ∑ⱼ₂ ω₂^(j₂k₂) x[j₁ + n₁j₂]
+# with ω₁ = ω^n₂ a n₁-th root of unity and ω₂ = ω^n₁ a n₂-th root of unity
+#
+# 1. Transpose the n₂ x n₁ input into n₁ rows of length n₂
+# 2. FFT of size n₂ on each row, then multiply by the twiddles ω^(j₁k₂)
+# 3. Transpose into n₂ rows of length n₁
+# 4. FFT of size n₁ on each row
+#
+# The row FFTs are DIF and output bit-reversed rows.
+# With n = 2ᵏ¹⁺ᵏ², bitrev(k₂ + n₂k₁) = bitrev(k₂)⋅n₁ + bitrev(k₁)
+# so after step 4 the data is exactly in bit-reversed order,
+# no extra permutation or final transposition is needed.
+#
+# References:
+# - FFTs in External or Hierarchical Memory
+#   David H. Bailey, 1989
+#   https://www.davidhbailey.com/dhbpapers/fftq.pdf
+
+const fftFourStepThreshold* = 14
+  ## Threshold (as log2) above which the four-step FFT is used by `fft_nr` and `fft_nn`.
+  ## 2¹⁴ elements of 32 bytes is 512KiB, beyond the L2 cache of most CPUs.
+
+func fft_four_step_twiddle_row[F](
+       row: ptr UncheckedArray[F],
+       j1, rowLen, logRowLen: int,
+       rootsOfUnity: ptr UncheckedArray[F],
+       rootStride: int) {.inline.} =
+  ## Multiply the bit-reversed output of the row FFT j₁
+  ## by the twiddle factors ω^(j₁k₂)
+  ## `rootStride` is the index of ω in `rootsOfUnity`
+  if j1 == 0:
+    return
+  for r in 1 ..< rowLen:
+    let k2 = int reverseBits(uint r, uint logRowLen)
+    row[r] *= rootsOfUnity[j1 * k2 * rootStride]
+
+func fft_four_step_dims(logN: int): tuple[logN1, logN2, n1, n2: int] {.inline.} =
+  ## Split a size-2ᵏ FFT into n₁ x n₂ with n₁ <= n₂
+  result.logN1 = logN shr 1
+  result.logN2 = logN - result.logN1
+  result.n1 = 1 shl result.logN1
+  result.n2 = 1 shl result.logN2
+
+func fft_nr_impl_four_step[F](
+       output: ptr UncheckedArray[F],
+       vals: ptr UncheckedArray[F],
+       temp: ptr UncheckedArray[F],
+       logN: int,
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int,
+       radix: FFTRadix) =
+  ## Four-step FFT (natural to bit-reversed)
+  ##
+  ## `temp` is a scratch buffer of size 2ᵏ with k = logN
+  ## `output` and `vals` may alias.
+  let (logN1, logN2, n1, n2) = fft_four_step_dims(logN)
+  let roots1 = rootsOfUnity.toStridedView(order).slice(0, order-1, order shr logN1)
+  let roots2 = rootsOfUnity.toStridedView(order).slice(0, order-1, order shr logN2)
+
+  # 1. Transpose the n₂ x n₁ input into n₁ x n₂
+  transpose(temp, vals, n2, n1)
+
+  # 2. Row FFTs of size n₂, then twiddles while the row is hot in cache
+  for j1 in 0 ..< n1:
+    let row = temp +% j1*n2
+    var vrow = row.toStridedView(n2)
+    fft_nr_impl_iterative_dif(vrow, roots2, radix)
+    row.fft_four_step_twiddle_row(j1, n2, logN2, rootsOfUnity, order shr logN)
+
+  # 3. Transpose the n₁ x n₂ matrix into n₂ x n₁
+  transpose(output, temp, n1, n2)
+
+  # 4. Row FFTs of size n₁
+  for r in 0 ..< n2:
+    var vrow = toStridedView(output +% r*n1, n1)
+    fft_nr_impl_iterative_dif(vrow, roots1, radix)
+
+func fft_nr_four_step[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F]): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## FFT from natural order to bit-reversed order using the four-step algorithm.
+  ## Input: natural order values
+  ## Output: bit-reversed order values in Fourier domain
+  ## Domain: roots of unity (no shift)
+  ##
+  ## Algorithm: Four-step (Bailey) FFT with iterative DIF row FFTs
+  ##
+  ## Each row FFT works on at most √n elements which stay in cache,
+  ## this is faster than the iterative DIF once the data does not fit in L2.
+  ##
+  ## Trade-offs vs Iterative DIF:
+  ## - Pros: 2 transpositions and 2 cache-resident FFT passes instead of log₂(n) strided passes
+  ## - Cons: Requires 2x memory (temporary buffer)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  checkSizesReturnEarly(desc, output, vals)
+
+  let n = vals.len
+  let temp = allocHeapArrayAligned(F, n, alignment = 64)
+
+  fft_nr_impl_four_step(
+    output.asUnchecked(),
+    vals.asUnchecked(),
+    temp,
+    int log2_vartime(uint n),
+    desc.rootsOfUnity,
+    desc.order,
+    desc.radix)
+
+  freeHeapAligned(temp)
+  return FFT_Success
+
 # ############################################################
 #
 #              FFT/IFFT Combinations
@@ -529,36 +999,41 @@ proc ifft_nn_via_bitrev_and_iterative_dit[F](
 # Use the specific implementations (fft_nr_recursive, fft_nr_iterative_dif, etc.)
 # if you need to test or benchmark individual algorithms.
 
-func fft_nn*[F](
+func fft_nr*[F](
        desc: FrFFT_Descriptor[F],
        output: var openarray[F],
-      vals: openarray[F]): FFTStatus {.inline, tags: [VarTime, HeapAlloc], meter.} =
-  ## FFT from natural order to natural order.
-  ## Dispatches to: Iterative DIF (NR) + BitRev
+       vals: openarray[F]): FFTStatus {.inline, tags: [VarTime, HeapAlloc], meter.} =
+  ## FFT from natural order to bit-reversed order.
+  ## Dispatches to:
+  ## - Iterative DIF for sizes below 2^fftFourStepThreshold
+  ## - Four-step FFT otherwise
   ##
   ## Input: natural order values
-  ## Output: natural order values in Fourier domain
+  ## Output: bit-reversed order values in Fourier domain
   ## Domain: roots of unity (no shift)
   ##
   ## **Supports in-place operation**: `output` and `vals` can be the same array.
-  let status = fft_nr_iterative_dif(desc, output, vals)
-  if status != FFT_Success: return status
-  bit_reversal_permutation(output)
-  return FFT_Success
+  if vals.len >= 1 shl fftFourStepThreshold:
+    fft_nr_four_step(desc, output, vals)
+  else:
+    fft_nr_iterative_dif(desc, output, vals)
 
-func fft_nr*[F](
+func fft_nn*[F](
        desc: FrFFT_Descriptor[F],
        output: var openarray[F],
-       vals: openarray[F]): FFTStatus {.inline, tags: [VarTime], meter.} =
-  ## FFT from natural order to bit-reversed order.
-  ## Dispatches to: Iterative DIF directly
+      vals: openarray[F]): FFTStatus {.inline, tags: [VarTime, HeapAlloc], meter.} =
+  ## FFT from natural order to natural order.
+  ## Dispatches to: FFT NR + BitRev
   ##
   ## Input: natural order values
-  ## Output: bit-reversed order values in Fourier domain
+  ## Output: natural order values in Fourier domain
   ## Domain: roots of unity (no shift)
   ##
   ## **Supports in-place operation**: `output` and `vals` can be the same array.
-  fft_nr_iterative_dif(desc, output, vals)
+  let status = fft_nr(desc, output, vals)
+  if status != FFT_Success: return status
+  bit_reversal_permutation(output)
+  return FFT_Success
 
 func ifft_nn*[F](
        desc: FrFFT_Descriptor[F],
@@ -588,6 +1063,360 @@ func ifft_rn*[F](
   ## **Supports in-place operation**: `output` and `vals` can be the same array.
   ifft_rn_iterative_dit(desc, output, vals)
 
+# ############################################################
+#
+#          Batched FFT (many equal-size transforms)
+#
+# ############################################################
+# Erasure code extension and recovery, polyphase spectra
+# and column encodings compute many independent FFTs of the same size.
+# The batched kernel runs the DIF butterflies of several transforms in lockstep:
+# each twiddle is loaded once and applied to all transforms,
+# and the independent multiplications of a butterfly row give the CPU
+# instruction-level parallelism.
+
+type
+  FFTBatchLayout* = enum
+    ## Memory layout of `batchSize` polynomials of size `n`
+    kRowMajor ## Polynomial `b` is stored contiguously in [b⋅n, (b+1)⋅n)
+    kColMajor ## Coefficient `k` of polynomial `b` is stored at k⋅batchSize + b
+
+const fftBatchInterleave = 8
+  ## Number of row-major transforms processed in lockstep
+
+func fft_nr_impl_iterative_dif_batch[F](
+       data: ptr UncheckedArray[F],
+       n, count: int,
+       elemStride, batchStride: int,
+       rootsOfUnity: StridedView[F]) =
+  ## In-place iterative DIF FFT (natural to bit-reversed)
+  ## on `count` transforms of size `n` processed in lockstep.
+  ## Element `k` of transform `b` is data[k⋅elemStride + b⋅batchStride]
+  var length = n
+  while length >= 2:
+    let half = length shr 1
+    let step = n div length
+
+    var i = 0
+    while i < n:
+      for j in 0 ..< half:
+        let w = rootsOfUnity[j*step]
+        let lo = data +% (i+j)*elemStride
+        let hi = data +% (i+j+half)*elemStride
+        for b in 0 ..< count:
+          var t {.noInit.}: F
+          t.diff(lo[b*batchStride], hi[b*batchStride])
+          lo[b*batchStride] += hi[b*batchStride]
+          hi[b*batchStride].prod(t, w)
+      i += length
+
+    length = length shr 1
+
+func ifft_rn_impl_iterative_dit_batch[F](
+       data: ptr UncheckedArray[F],
+       n, count: int,
+       elemStride, batchStride: int,
+       invRootsOfUnity: StridedView[F]) =
+  ## In-place iterative DIT inverse FFT (bit-reversed to natural), without 1/n scaling,
+  ## on `count` transforms of size `n` processed in lockstep.
+  ## Element `k` of transform `b` is data[k⋅elemStride + b⋅batchStride]
+  var length = 2
+  while length <= n:
+    let half = length shr 1
+    let step = n div length
+
+    var i = 0
+    while i < n:
+      for j in 0 ..< half:
+        let w = invRootsOfUnity[j*step]
+        let lo = data +% (i+j)*elemStride
+        let hi = data +% (i+j+half)*elemStride
+        for b in 0 ..< count:
+          var t {.noInit.}: F
+          t.prod(hi[b*batchStride], w)
+          hi[b*batchStride].diff(lo[b*batchStride], t)
+          lo[b*batchStride] += t
+      i += length
+
+    length = length shl 1
+
+func fft_batch_dims[F](
+       desc: FrFFT_Descriptor[F],
+       outputLen, valsLen, batchSize: int,
+       n: var int): FFTStatus {.inline.} =
+  ## Validate the sizes of a batch of FFTs
+  ## and return the size of each transform in `n`
+  if batchSize <= 0 or valsLen mod batchSize != 0:
+    return FFT_BatchSizeMismatch
+  if outputLen != valsLen:
+    return FFT_InconsistentInputOutputLengths
+  n = valsLen div batchSize
+  if n > desc.order:
+    return FFT_TooManyValues
+  if not n.uint64.isPowerOf2_vartime():
+    return FFT_SizeNotPowerOfTwo
+  return FFT_Success
+
+func fft_nr_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int,
+       radix: FFTRadix) {.tags: [VarTime, HeapAlloc].} =
+  ## In-place FFT (natural to bit-reversed)
+  ## of the transforms [batchStart, batchStop) of a batch
+  ##
+  ## `radix` is only used by the four-step FFT of large row-major transforms.
+  ## The interleaved row-major and the column-major kernels
+  ## are radix-2 DIF whatever the descriptor radix.
+  let logN = int log2_vartime(uint n)
+  let rootz = rootsOfUnity
+                .toStridedView(order)
+                .slice(0, order-1, order shr logN)
+
+  case layout
+  of kRowMajor:
+    if logN >= fftFourStepThreshold:
+      # Large transforms do not fit in cache together,
+      # process them one at a time with the cache-friendly four-step FFT.
+      let temp = allocHeapArrayAligned(F, n, alignment = 64)
+      for b in batchStart ..< batchStop:
+        let row = data +% b*n
+        fft_nr_impl_four_step(row, row, temp, logN, rootsOfUnity, order, radix)
+      freeHeapAligned(temp)
+    else:
+      var b = batchStart
+      while b < batchStop:
+        let count = min(fftBatchInterleave, batchStop - b)
+        fft_nr_impl_iterative_dif_batch(data +% b*n, n, count, elemStride = 1, batchStride = n, rootz)
+        b += count
+  of kColMajor:
+    fft_nr_impl_iterative_dif_batch(
+      data +% batchStart, n, batchStop - batchStart,
+      elemStride = batchSize, batchStride = 1, rootz)
+
+func bit_reversal_permutation_batch[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout) =
+  ## In-place bit-reversal permutation
+  ## of the transforms [batchStart, batchStop) of a batch
+  case layout
+  of kRowMajor:
+    for b in batchStart ..< batchStop:
+      bit_reversal_permutation((data +% b*n).toOpenArray(n))
+  of kColMajor:
+    # Swap whole rows of the n x batchSize matrix
+    if n <= 1:
+      return
+    let logN = log2_vartime(uint n)
+    for i in 0'u ..< uint(n):
+      let rev_i = reverseBits(i, logN)
+      if i < rev_i:
+        for b in batchStart ..< batchStop:
+          swap(data[int(i)*batchSize + b], data[int(rev_i)*batchSize + b])
+
+func fft_nr_batch*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       layout = kRowMajor): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Batched FFT from natural order to bit-reversed order
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## The transforms share the descriptor roots of unity.
+  ##
+  ## Input: natural order values
+  ## Output: bit-reversed order values in Fourier domain, in the same layout
+  ## Domain: roots of unity (no shift)
+  ##
+  ## The descriptor radix is honoured by the four-step FFT of large row-major transforms only,
+  ## smaller row-major transforms and the column-major layout use radix-2 DIF kernels.
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  fft_nr_batch_rows(
+    output.asUnchecked(), n, 0, batchSize, batchSize, layout,
+    desc.rootsOfUnity, desc.order, desc.radix)
+  return FFT_Success
+
+func fft_nn_batch*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       layout = kRowMajor): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Batched FFT from natural order to natural order
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## Dispatches to: Batched FFT NR + BitRev
+  ##
+  ## Input: natural order values
+  ## Output: natural order values in Fourier domain, in the same layout
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  let status = desc.fft_nr_batch(output, vals, batchSize, layout)
+  if status != FFT_Success:
+    return status
+
+  let n = vals.len div batchSize
+  bit_reversal_permutation_batch(output.asUnchecked(), n, 0, batchSize, batchSize, layout)
+  return FFT_Success
+
+func ifft_rn_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int) {.tags: [VarTime].} =
+  ## In-place inverse FFT (bit-reversed to natural), without 1/n scaling,
+  ## of the transforms [batchStart, batchStop) of a batch.
+  ## The kernels are radix-2 DIT whatever the descriptor radix.
+  let invRootz = rootsOfUnity
+                   .toStridedView(order+1)
+                   .reversed()
+                   .slice(0, order-1, order shr log2_vartime(uint n))
+
+  case layout
+  of kRowMajor:
+    var b = batchStart
+    while b < batchStop:
+      let count = min(fftBatchInterleave, batchStop - b)
+      ifft_rn_impl_iterative_dit_batch(data +% b*n, n, count, elemStride = 1, batchStride = n, invRootz)
+      b += count
+  of kColMajor:
+    ifft_rn_impl_iterative_dit_batch(
+      data +% batchStart, n, batchStop - batchStart,
+      elemStride = batchSize, batchStride = 1, invRootz)
+
+func scale_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       factors: ptr UncheckedArray[F]) =
+  ## Multiply element `k` of the transforms [batchStart, batchStop) of a batch
+  ## by factors[k]
+  case layout
+  of kRowMajor:
+    for b in batchStart ..< batchStop:
+      let row = data +% b*n
+      for k in 0 ..< n:
+        row[k] *= factors[k]
+  of kColMajor:
+    for k in 0 ..< n:
+      let row = data +% k*batchSize
+      for b in batchStart ..< batchStop:
+        row[b] *= factors[k]
+
+func allocScalingFactors[F](n: int, first, ratio: F): ptr UncheckedArray[F] {.tags: [HeapAlloc].} =
+  ## Returns first⋅ratioᵏ for k in [0, n), shared by all transforms of a batch.
+  ## The buffer must be freed with `freeHeapAligned`.
+  result = allocHeapArrayAligned(F, n, alignment = 64)
+  result[0] = first
+  for k in 1 ..< n:
+    result[k].prod(result[k-1], ratio)
+
+func coset_fft_nr_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       shifts: ptr UncheckedArray[F],
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int,
+       radix: FFTRadix) {.tags: [VarTime, HeapAlloc].} =
+  ## In-place coset FFT (natural to bit-reversed)
+  ## of the transforms [batchStart, batchStop) of a batch.
+  ## `shifts` holds the powers gᵏ of the coset shift.
+  scale_batch_rows(data, n, batchStart, batchStop, batchSize, layout, shifts)
+  fft_nr_batch_rows(data, n, batchStart, batchStop, batchSize, layout, rootsOfUnity, order, radix)
+
+func coset_ifft_rn_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       factors: ptr UncheckedArray[F],
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int) {.tags: [VarTime].} =
+  ## In-place coset IFFT (bit-reversed to natural)
+  ## of the transforms [batchStart, batchStop) of a batch.
+  ## `factors` holds g⁻ᵏ/n, g⁻ᵏ being the powers of the inverse coset shift
+  ## and g = 1 for the plain IFFT.
+  ifft_rn_batch_rows(data, n, batchStart, batchStop, batchSize, layout, rootsOfUnity, order)
+  scale_batch_rows(data, n, batchStart, batchStop, batchSize, layout, factors)
+
+func ifft_rn_batch*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       layout = kRowMajor): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Batched IFFT from bit-reversed order to natural order
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## The transforms share the descriptor roots of unity.
+  ##
+  ## Input: bit-reversed order values in Fourier domain
+  ## Output: natural order values, in the same layout
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  var invLen {.noInit.}, one {.noInit.}: F
+  invLen.fromUint(n.uint64)
+  invLen.inv_vartime()
+  one.setOne()
+  let factors = allocScalingFactors(n, invLen, one)
+
+  coset_ifft_rn_batch_rows(
+    output.asUnchecked(), n, 0, batchSize, batchSize, layout,
+    factors, desc.rootsOfUnity, desc.order)
+
+  freeHeapAligned(factors)
+  return FFT_Success
+
+func ifft_nn_batch*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       layout = kRowMajor): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Batched IFFT from natural order to natural order
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## Dispatches to: BitRev + Batched IFFT RN
+  ##
+  ## Input: natural order values in Fourier domain
+  ## Output: natural order values, in the same layout
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  bit_reversal_permutation_batch(output.asUnchecked(), n, 0, batchSize, batchSize, layout)
+  return desc.ifft_rn_batch(output, output, batchSize, layout)
+
 # ############################################################
 #
 #               Coset FFT (for Reed-Solomon erasure coding)
@@ -626,64 +1455,389 @@ func unshift_vals*[F](
     output[i].prod(vals[i], inv_shift_pow)
     inv_shift_pow *= inv_shift_factor
 
-func coset_fft_nn*[F](
+# Fused coset FFT
+# ------------------------------------------------------------------------------
+#
+# Instead of a separate pass multiplying the input by powers of the shift g,
+# the shift is folded into the first DIF stage (resp. last DIT stage).
+# With h = n/2, a = x[j], b = x[j+h]:
+#
+#   first DIF stage over the shifted input (a⋅gʲ, b⋅gʲ⁺ʰ):
+#     y[j]   = (a + gʰ⋅b) ⋅ gʲ
+#     y[j+h] = (a - gʰ⋅b) ⋅ gʲωʲ
+#
+#   last DIT stage of the IFFT followed by the 1/n scaling and the unshift by g⁻ⁱ:
+#     A = a ⋅ g⁻ʲ/n
+#     B = b ⋅ g⁻ʲω⁻ʲ/n
+#     y[j]   = A + B
+#     y[j+h] = (A - B) ⋅ g⁻ʰ
+#
+# This saves a full memory pass and n multiplications (n + 2n for the IFFT).
+# The combined twiddles depend on the shift and the FFT size,
+# they are cached in the descriptor.
+
+func precomputeCosetTwiddles*[F](
+       desc: var FrFFT_Descriptor[F],
+       cosetShift: F,
+       size: int) {.tags: [VarTime, HeapAlloc].} =
+  ## Precompute and cache the fused coset twiddles
+  ## for coset FFTs of size `size` with shift `cosetShift`.
+  ## Subsequent coset FFTs with the same shift and size
+  ## skip the separate shift/unshift pass.
+  ##
+  ## Up to `fftCosetCacheSize` (shift, size) pairs are cached,
+  ## once full the last entry is replaced.
+  ##
+  ## `size` must be a power of 2, greater or equal to 2 and at most `desc.order`.
+  debug: doAssert size.uint64.isPowerOf2_vartime() and 2 <= size and size <= desc.order
+
+  var slot = desc.cosets.len-1
+  for i in 0 ..< desc.cosets.len:
+    if desc.cosets[i].size == 0 or
+         (desc.cosets[i].size == size and bool(desc.cosets[i].shift == cosetShift)):
+      slot = i
+      break
+
+  template c: untyped = desc.cosets[slot]
+
+  if not c.fwd.isNil():
+    c.fwd.freeHeapAligned()
+  if not c.inv.isNil():
+    c.inv.freeHeapAligned()
+
+  let half = size shr 1
+  let step = desc.order div size
+
+  # Layout: [gʲ for j < h] [gʲωʲ for j < h] [gʰ]
+  #    and: [g⁻ʲ/n for j < h] [g⁻ʲω⁻ʲ/n for j < h] [g⁻ʰ]
+  c.fwd = allocHeapArrayAligned(F, 2*half+1, alignment = 64)
+  c.inv = allocHeapArrayAligned(F, 2*half+1, alignment = 64)
+
+  var invShift {.noInit.}: F
+  invShift.inv_vartime(cosetShift)
+
+  var invShiftPow {.noInit.}: F
+  invShiftPow.fromUint(size.uint64)
+  invShiftPow.inv_vartime()
+
+  var shiftPow {.noInit.}: F
+  shiftPow.setOne()
+
+  for j in 0 ..< half:
+    c.fwd[j] = shiftPow
+    c.fwd[half+j].prod(shiftPow, desc.rootsOfUnity[j*step])
+    c.inv[j] = invShiftPow
+    # ω⁻ʲ = ω^(order - j⋅step)
+    c.inv[half+j].prod(invShiftPow, desc.rootsOfUnity[desc.order - j*step])
+    shiftPow *= cosetShift
+    invShiftPow *= invShift
+
+  c.fwd[2*half] = shiftPow
+  c.inv[2*half].inv_vartime(shiftPow)
+
+  c.shift = cosetShift
+  c.size = size
+
+func findCosetTwiddles[F](desc: FrFFT_Descriptor[F], cosetShift: F, size: int): int {.inline.} =
+  ## Returns the index of the cached fused twiddles
+  ## for coset FFTs of size `size` with shift `cosetShift`
+  ## or -1 if they are not cached.
+  if size < 2:
+    return -1
+  for i in 0 ..< desc.cosets.len:
+    if desc.cosets[i].size == size and bool(desc.cosets[i].shift == cosetShift):
+      return i
+  return -1
+
+func coset_dif_first_stage[F](
+       output: ptr UncheckedArray[F],
+       vals: ptr UncheckedArray[F],
+       twiddles: ptr UncheckedArray[F],
+       half: int) =
+  ## First DIF stage of a size 2h FFT with the coset shift folded in.
+  ## `output` and `vals` may alias.
+  let shiftHalf = twiddles[2*half]
+  for j in 0 ..< half:
+    var u {.noInit.}: F
+    var t {.noInit.}: F
+    u.prod(vals[j+half], shiftHalf)
+    t.diff(vals[j], u)
+    u += vals[j]
+    output[j].prod(u, twiddles[j])
+    output[j+half].prod(t, twiddles[half+j])
+
+func coset_dit_last_stage[F](
+       output: ptr UncheckedArray[F],
+       invTwiddles: ptr UncheckedArray[F],
+       half: int) =
+  ## Last DIT stage of a size 2h IFFT with the 1/n scaling
+  ## and the inverse coset shift folded in.
+  let invShiftHalf = invTwiddles[2*half]
+  for j in 0 ..< half:
+    var a {.noInit.}: F
+    var b {.noInit.}: F
+    a.prod(output[j], invTwiddles[j])
+    b.prod(output[j+half], invTwiddles[half+j])
+    output[j].sum(a, b)
+    a -= b
+    output[j+half].prod(a, invShiftHalf)
+
+func coset_fft_nr_fused[F](
        desc: FrFFT_Descriptor[F],
        output: var openarray[F],
        vals: openarray[F],
-       cosetShift: F): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
-  ## Compute FFT over a coset of the roots of unity (natural to natural order).
-  ##
-  ## This is used for polynomial operations where we need to avoid
-  ## division by zero. By shifting the domain, polynomials that vanish
-  ## at certain points won't cause issues during division.
+       twiddles: ptr UncheckedArray[F]) {.tags: [VarTime, HeapAlloc].} =
+  ## Coset FFT (natural to bit-reversed) using the cached fused twiddles
+  let n = vals.len
+  let half = n shr 1
+  let logHalf = int log2_vartime(uint half)
+  let data = output.asUnchecked()
+
+  coset_dif_first_stage(data, vals.asUnchecked(), twiddles, half)
+
+  # The remaining DIF stages are 2 independent FFTs of size n/2
+  if logHalf >= fftFourStepThreshold:
+    let temp = allocHeapArrayAligned(F, half, alignment = 64)
+    fft_nr_impl_four_step(data, data, temp, logHalf, desc.rootsOfUnity, desc.order, desc.radix)
+    fft_nr_impl_four_step(data +% half, data +% half, temp, logHalf, desc.rootsOfUnity, desc.order, desc.radix)
+    freeHeapAligned(temp)
+  else:
+    let rootz = desc.rootsOfUnity
+                    .toStridedView(desc.order)
+                    .slice(0, desc.order-1, desc.order shr logHalf)
+    var lo = data.toStridedView(half)
+    var hi = toStridedView(data +% half, half)
+    fft_nr_impl_iterative_dif(lo, rootz, desc.radix)
+    fft_nr_impl_iterative_dif(hi, rootz, desc.radix)
+
+func coset_ifft_rn_fused[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       invTwiddles: ptr UncheckedArray[F]) =
+  ## Coset IFFT (bit-reversed to natural) using the cached fused twiddles
+  let n = vals.len
+  let half = n shr 1
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< n:
+      output[i] = vals[i]
+
+  # The first DIT stages are 2 independent IFFTs of size n/2 (without scaling)
+  let rootz = desc.rootsOfUnity
+                  .toStridedView(desc.order+1)
+                  .reversed()
+                  .slice(0, desc.order-1, desc.order shr log2_vartime(uint half))
+  let data = output.asUnchecked()
+  var lo = data.toStridedView(half)
+  var hi = toStridedView(data +% half, half)
+  fft_rn_impl_iterative_dit(lo, rootz, desc.radix)
+  fft_rn_impl_iterative_dit(hi, rootz, desc.radix)
+
+  coset_dit_last_stage(data, invTwiddles, half)
+
+# Batched coset FFTs
+# ----------------------------------------------------------------
+#
+# With cached fused twiddles, the first DIF stage (resp. last DIT stage)
+# of each transform absorbs the coset shift, the remaining stages are
+# 2 independent transforms of size n/2 per polynomial:
+# - in row-major layout, the 2 halves of each polynomial are consecutive rows of size n/2,
+# - in column-major layout, the top and bottom halves are 2 column-major batches of size n/2.
+# Otherwise the batch is shifted in a separate pass with the powers of the shift.
+
+func coset_dif_first_stage_batch[F](
+       data: ptr UncheckedArray[F],
+       half, count: int,
+       elemStride, batchStride: int,
+       twiddles: ptr UncheckedArray[F]) =
+  ## First DIF stage with the coset shift folded in
+  ## of `count` transforms of size 2h processed in lockstep.
+  ## Element `k` of transform `b` is data[k⋅elemStride + b⋅batchStride]
+  let shiftHalf = twiddles[2*half]
+  for j in 0 ..< half:
+    let lo = data +% j*elemStride
+    let hi = data +% (j+half)*elemStride
+    for b in 0 ..< count:
+      var u {.noInit.}, t {.noInit.}: F
+      u.prod(hi[b*batchStride], shiftHalf)
+      t.diff(lo[b*batchStride], u)
+      u += lo[b*batchStride]
+      lo[b*batchStride].prod(u, twiddles[j])
+      hi[b*batchStride].prod(t, twiddles[half+j])
+
+func coset_dit_last_stage_batch[F](
+       data: ptr UncheckedArray[F],
+       half, count: int,
+       elemStride, batchStride: int,
+       invTwiddles: ptr UncheckedArray[F]) =
+  ## Last DIT stage with the 1/n scaling and the inverse coset shift folded in
+  ## of `count` transforms of size 2h processed in lockstep.
+  ## Element `k` of transform `b` is data[k⋅elemStride + b⋅batchStride]
+  let invShiftHalf = invTwiddles[2*half]
+  for j in 0 ..< half:
+    let lo = data +% j*elemStride
+    let hi = data +% (j+half)*elemStride
+    for b in 0 ..< count:
+      var a {.noInit.}, c {.noInit.}: F
+      a.prod(lo[b*batchStride], invTwiddles[j])
+      c.prod(hi[b*batchStride], invTwiddles[half+j])
+      lo[b*batchStride].sum(a, c)
+      a -= c
+      hi[b*batchStride].prod(a, invShiftHalf)
+
+func coset_fft_nr_fused_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       twiddles: ptr UncheckedArray[F],
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int,
+       radix: FFTRadix) {.tags: [VarTime, HeapAlloc].} =
+  ## In-place coset FFT (natural to bit-reversed)
+  ## of the transforms [batchStart, batchStop) of a batch
+  ## using the cached fused twiddles.
+  let half = n shr 1
+  case layout
+  of kRowMajor:
+    coset_dif_first_stage_batch(
+      data +% batchStart*n, half, batchStop - batchStart,
+      elemStride = 1, batchStride = n, twiddles)
+    fft_nr_batch_rows(
+      data, half, 2*batchStart, 2*batchStop, 2*batchSize, kRowMajor,
+      rootsOfUnity, order, radix)
+  of kColMajor:
+    coset_dif_first_stage_batch(
+      data +% batchStart, half, batchStop - batchStart,
+      elemStride = batchSize, batchStride = 1, twiddles)
+    fft_nr_batch_rows(
+      data, half, batchStart, batchStop, batchSize, kColMajor,
+      rootsOfUnity, order, radix)
+    fft_nr_batch_rows(
+      data +% half*batchSize, half, batchStart, batchStop, batchSize, kColMajor,
+      rootsOfUnity, order, radix)
+
+func coset_ifft_rn_fused_batch_rows[F](
+       data: ptr UncheckedArray[F],
+       n, batchStart, batchStop, batchSize: int,
+       layout: FFTBatchLayout,
+       invTwiddles: ptr UncheckedArray[F],
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int) {.tags: [VarTime].} =
+  ## In-place coset IFFT (bit-reversed to natural)
+  ## of the transforms [batchStart, batchStop) of a batch
+  ## using the cached fused twiddles.
+  let half = n shr 1
+  case layout
+  of kRowMajor:
+    ifft_rn_batch_rows(
+      data, half, 2*batchStart, 2*batchStop, 2*batchSize, kRowMajor,
+      rootsOfUnity, order)
+    coset_dit_last_stage_batch(
+      data +% batchStart*n, half, batchStop - batchStart,
+      elemStride = 1, batchStride = n, invTwiddles)
+  of kColMajor:
+    ifft_rn_batch_rows(
+      data, half, batchStart, batchStop, batchSize, kColMajor,
+      rootsOfUnity, order)
+    ifft_rn_batch_rows(
+      data +% half*batchSize, half, batchStart, batchStop, batchSize, kColMajor,
+      rootsOfUnity, order)
+    coset_dit_last_stage_batch(
+      data +% batchStart, half, batchStop - batchStart,
+      elemStride = batchSize, batchStride = 1, invTwiddles)
+
+func coset_fft_nr_batch*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       cosetShift: F,
+       layout = kRowMajor): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Batched FFT over a coset of the roots of unity (natural to bit-reversed order)
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
   ##
-  ## Algorithm:
-  ##   1. Multiply vals[i] by shift_factor^i (shift into coset)
-  ##   2. Apply standard FFT (natural to natural order)
+  ## If the descriptor caches twiddles for this shift and size (see `precomputeCosetTwiddles`),
+  ## the shift is folded into the first FFT stage,
+  ## otherwise the powers of `cosetShift` are computed once for the whole batch.
+  ## The transforms share the batched FFT kernels.
   ##
-  ## Parameters:
-  ##   - desc: FFT descriptor with roots of unity
-  ##   - output: output array (must have same length as vals)
-  ##   - vals: input values in evaluation form
-  ##   - cosetShift, the coset shift
+  ## Input: natural order values
+  ## Output: bit-reversed order values over the coset, in the same layout
   ##
-  ## Returns FFT_Success on success, error code otherwise
-  let n = vals.len
-  var shifted = allocHeapArrayAligned(F, n, alignment = 64)
-  shifted.toOpenArray(n).shift_vals(vals, cosetShift)
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
 
-  result = desc.fft_nn(output, shifted.toOpenArray(n))
-  freeHeapAligned(shifted)
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
 
-func coset_ifft_nn*[F](
-      desc: FrFFT_Descriptor[F],
-      output: var openarray[F],
-      vals: openarray[F],
-      cosetShift: F): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
-  ## Compute inverse FFT over a coset of the roots of unity (natural to natural order).
-  ##
-  ## This is used after polynomial division in the coset domain
-  ## to get back the polynomial coefficients.
+  let slot = desc.findCosetTwiddles(cosetShift, n)
+  if slot >= 0:
+    coset_fft_nr_fused_batch_rows(
+      output.asUnchecked(), n, 0, batchSize, batchSize, layout,
+      desc.cosets[slot].fwd, desc.rootsOfUnity, desc.order, desc.radix)
+    return FFT_Success
+
+  var one {.noInit.}: F
+  one.setOne()
+  let shifts = allocScalingFactors(n, one, cosetShift)
+
+  coset_fft_nr_batch_rows(
+    output.asUnchecked(), n, 0, batchSize, batchSize, layout,
+    shifts, desc.rootsOfUnity, desc.order, desc.radix)
+
+  freeHeapAligned(shifts)
+  return FFT_Success
+
+func coset_ifft_rn_batch*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       cosetShift: F,
+       layout = kRowMajor): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Batched inverse FFT over a coset of the roots of unity (bit-reversed to natural order)
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
   ##
-  ## Algorithm:
-  ##   1. Apply standard IFFT (natural to natural)
-  ##   2. Multiply result[i] by shift_factor⁻ⁱ (unshift from coset)
+  ## If the descriptor caches twiddles for this shift and size (see `precomputeCosetTwiddles`),
+  ## the 1/n scaling and the unshift by cosetShift⁻ᵏ are folded into the last IFFT stage,
+  ## otherwise they are merged in a single pass with factors computed once for the whole batch.
   ##
-  ## Parameters:
-  ##   - desc: FFT descriptor with roots of unity
-  ##   - output: output array (must have same length as vals)
-  ##   - vals: input values in evaluation form over coset
-  ##   - cosetShift, the coset shift (which will be inverted)
+  ## Input: bit-reversed order values over the coset
+  ## Output: natural order values, in the same layout
   ##
-  ## Returns FFT_Success on success, error code otherwise
-  let status = desc.ifft_nn(output, vals)
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
   if status != FFT_Success:
     return status
 
-  var inv_shift_factor {.noInit.}: F
-  inv_shift_factor.inv_vartime(cosetShift)
-  output.unshift_vals(output, inv_shift_factor)
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  let slot = desc.findCosetTwiddles(cosetShift, n)
+  if slot >= 0:
+    coset_ifft_rn_fused_batch_rows(
+      output.asUnchecked(), n, 0, batchSize, batchSize, layout,
+      desc.cosets[slot].inv, desc.rootsOfUnity, desc.order)
+    return FFT_Success
 
+  var invLen {.noInit.}, invShift {.noInit.}: F
+  invLen.fromUint(n.uint64)
+  invLen.inv_vartime()
+  invShift.inv_vartime(cosetShift)
+  let factors = allocScalingFactors(n, invLen, invShift)
+
+  coset_ifft_rn_batch_rows(
+    output.asUnchecked(), n, 0, batchSize, batchSize, layout,
+    factors, desc.rootsOfUnity, desc.order)
+
+  freeHeapAligned(factors)
   return FFT_Success
 
 
@@ -702,20 +1856,65 @@ func coset_fft_nr*[F](
   ##   1. Multiply vals[i] by shift_factor^i (shift into coset)
   ##   2. Apply standard FFT (natural to bit-reversed order)
   ##
+  ## If the descriptor caches twiddles for this shift and size (see `precomputeCosetTwiddles`),
+  ## the shift is fused into the first FFT stage.
+  ##
   ## Parameters:
   ##   - desc: FFT descriptor with roots of unity
   ##   - output: output array (must have same length as vals)
   ##   - vals: input values in evaluation form
   ##   - cosetShift, the coset shift
   ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
   ## Returns FFT_Success on success, error code otherwise
+  checkSizesReturnEarly(desc, output, vals)
+
   let n = vals.len
+  let slot = desc.findCosetTwiddles(cosetShift, n)
+  if slot >= 0:
+    desc.coset_fft_nr_fused(output, vals, desc.cosets[slot].fwd)
+    return FFT_Success
+
   var shifted = allocHeapArrayAligned(F, n, alignment = 64)
   shifted.toOpenArray(n).shift_vals(vals, cosetShift)
 
   result = desc.fft_nr(output, shifted.toOpenArray(n))
   freeHeapAligned(shifted)
 
+func coset_fft_nn*[F](
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       cosetShift: F): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Compute FFT over a coset of the roots of unity (natural to natural order).
+  ##
+  ## This is used for polynomial operations where we need to avoid
+  ## division by zero. By shifting the domain, polynomials that vanish
+  ## at certain points won't cause issues during division.
+  ##
+  ## Algorithm:
+  ##   1. Multiply vals[i] by shift_factor^i (shift into coset)
+  ##   2. Apply standard FFT (natural to natural order)
+  ##
+  ## If the descriptor caches twiddles for this shift and size (see `precomputeCosetTwiddles`),
+  ## the shift is fused into the first FFT stage.
+  ##
+  ## Parameters:
+  ##   - desc: FFT descriptor with roots of unity
+  ##   - output: output array (must have same length as vals)
+  ##   - vals: input values in evaluation form
+  ##   - cosetShift, the coset shift
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Returns FFT_Success on success, error code otherwise
+  let status = desc.coset_fft_nr(output, vals, cosetShift)
+  if status != FFT_Success:
+    return status
+  bit_reversal_permutation(output)
+  return FFT_Success
+
 func coset_ifft_rn*[F](
        desc: FrFFT_Descriptor[F],
        output: var openarray[F],
@@ -727,13 +1926,25 @@ func coset_ifft_rn*[F](
   ##   1. Apply IFFT (bit-reversed → natural) via `ifft_rn`
   ##   2. Multiply result[i] by shift_factor⁻ⁱ (unshift from coset)
   ##
+  ## If the descriptor caches twiddles for this shift and size (see `precomputeCosetTwiddles`),
+  ## the 1/n scaling and the unshift are fused into the last IFFT stage.
+  ##
   ## Parameters:
   ##   - desc: FFT descriptor with roots of unity
   ##   - output: output array (must have same length as vals)
   ##   - vals: input values in evaluation form over coset
   ##   - cosetShift: the coset shift (which will be inverted)
   ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
   ## Returns FFT_Success on success, error code otherwise
+  checkSizesReturnEarly(desc, output, vals)
+
+  let slot = desc.findCosetTwiddles(cosetShift, vals.len)
+  if slot >= 0:
+    desc.coset_ifft_rn_fused(output, vals, desc.cosets[slot].inv)
+    return FFT_Success
+
   let status = desc.ifft_rn(output, vals)
   if status != FFT_Success:
     return status
@@ -743,3 +1954,47 @@ func coset_ifft_rn*[F](
   output.unshift_vals(output, inv_shift_factor)
 
   return FFT_Success
+
+func coset_ifft_nn*[F](
+      desc: FrFFT_Descriptor[F],
+      output: var openarray[F],
+      vals: openarray[F],
+      cosetShift: F): FFTStatus {.tags: [VarTime, HeapAlloc], meter.} =
+  ## Compute inverse FFT over a coset of the roots of unity (natural to natural order).
+  ##
+  ## This is used after polynomial division in the coset domain
+  ## to get back the polynomial coefficients.
+  ##
+  ## Algorithm:
+  ##   1. Apply standard IFFT (natural to natural)
+  ##   2. Multiply result[i] by shift_factor⁻ⁱ (unshift from coset)
+  ##
+  ## If the descriptor caches twiddles for this shift and size (see `precomputeCosetTwiddles`),
+  ## the 1/n scaling and the unshift are fused into the last IFFT stage.
+  ##
+  ## Parameters:
+  ##   - desc: FFT descriptor with roots of unity
+  ##   - output: output array (must have same length as vals)
+  ##   - vals: input values in evaluation form over coset
+  ##   - cosetShift, the coset shift (which will be inverted)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Returns FFT_Success on success, error code otherwise
+  checkSizesReturnEarly(desc, output, vals)
+
+  let slot = desc.findCosetTwiddles(cosetShift, vals.len)
+  if slot >= 0:
+    bit_reversal_permutation(output, vals)
+    desc.coset_ifft_rn_fused(output, output, desc.cosets[slot].inv)
+    return FFT_Success
+
+  let status = desc.ifft_nn(output, vals)
+  if status != FFT_Success:
+    return status
+
+  var inv_shift_factor {.noInit.}: F
+  inv_shift_factor.inv_vartime(cosetShift)
+  output.unshift_vals(output, inv_shift_factor)
+
+  return FFT_Success
@@ -0,0 +1,425 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Test with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_fft_fields_parallel.nim
+
+import ./fft_fields {.all.}
+export fft_fields
+
+import
+  constantine/math/arithmetic,
+  constantine/math/matrix/transpose,
+  constantine/platforms/[abstractions, allocs, views],
+  constantine/threadpool/threadpool,
+  ./fft_common,
+  ./fft_common_parallel
+
+{.push raises: [], checks: off.} # No exceptions
+
+# ############################################################
+#
+#                  Finite Fields FFT
+#                  Parallel Edition
+#
+# ############################################################
+
+proc transpose_parallel[F](
+       tp: Threadpool,
+       dst, src: ptr UncheckedArray[F],
+       M, N: int) =
+  ## Transpose a M x N matrix from src into dst
+  ## Each task transposes a band of rows of `src`
+  ## into a band of columns of `dst`.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  const bandSize = 16 # Rows per task, matches the transposition tile size
+
+  syncScope:
+    tp.parallelFor i in 0 ..< M:
+      stride: bandSize
+      captures: {dst, src, M, N}
+      transpose(dst +% i, M, src +% i*N, N, min(bandSize, M-i), N)
+
+proc fft_nr_impl_four_step_parallel[F](
+       tp: Threadpool,
+       output: ptr UncheckedArray[F],
+       vals: ptr UncheckedArray[F],
+       temp: ptr UncheckedArray[F],
+       logN: int,
+       rootsOfUnity: ptr UncheckedArray[F],
+       order: int,
+       radix: FFTRadix) =
+  ## Parallel four-step FFT (natural to bit-reversed)
+  ## Rows FFTs are independent and distributed over the threadpool.
+  ##
+  ## `temp` is a scratch buffer of size 2ᵏ with k = logN
+  ## `output` and `vals` may alias.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let (logN1, logN2, n1, n2) = fft_four_step_dims(logN)
+  let rootStride = order shr logN
+
+  # 1. Transpose the n₂ x n₁ input into n₁ x n₂
+  tp.transpose_parallel(temp, vals, n2, n1)
+
+  # 2. Row FFTs of size n₂, then twiddles while the row is hot in cache
+  syncScope:
+    tp.parallelFor j1 in 0 ..< n1:
+      captures: {temp, rootsOfUnity, order, logN2, n2, rootStride, radix}
+      let row = temp +% j1*n2
+      let roots2 = rootsOfUnity.toStridedView(order).slice(0, order-1, order shr logN2)
+      var vrow = row.toStridedView(n2)
+      fft_nr_impl_iterative_dif(vrow, roots2, radix)
+      row.fft_four_step_twiddle_row(j1, n2, logN2, rootsOfUnity, rootStride)
+
+  # 3. Transpose the n₁ x n₂ matrix into n₂ x n₁
+  tp.transpose_parallel(output, temp, n1, n2)
+
+  # 4. Row FFTs of size n₁
+  syncScope:
+    tp.parallelFor r in 0 ..< n2:
+      captures: {output, rootsOfUnity, order, logN1, n1, radix}
+      let roots1 = rootsOfUnity.toStridedView(order).slice(0, order-1, order shr logN1)
+      var vrow = toStridedView(output +% r*n1, n1)
+      fft_nr_impl_iterative_dif(vrow, roots1, radix)
+
+proc fft_nr_four_step_parallel[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F]): FFTStatus =
+  ## Parallel FFT from natural order to bit-reversed order using the four-step algorithm.
+  ## Input: natural order values
+  ## Output: bit-reversed order values in Fourier domain
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  checkSizesReturnEarly(desc, output, vals)
+
+  let n = vals.len
+  let temp = allocHeapArrayAligned(F, n, alignment = 64)
+
+  tp.fft_nr_impl_four_step_parallel(
+    output.asUnchecked(),
+    vals.asUnchecked(),
+    temp,
+    int log2_vartime(uint n),
+    desc.rootsOfUnity,
+    desc.order,
+    desc.radix)
+
+  freeHeapAligned(temp)
+  return FFT_Success
+
+# ############################################################
+#
+#              High-Level FFT API (Auto-dispatch)
+#
+# ############################################################
+
+proc fft_nr_parallel*[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F]): FFTStatus =
+  ## Parallel FFT from natural order to bit-reversed order.
+  ## Dispatches to:
+  ## - Serial iterative DIF for sizes below 2^fftFourStepThreshold
+  ## - Parallel four-step FFT otherwise
+  ##
+  ## Input: natural order values
+  ## Output: bit-reversed order values in Fourier domain
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  if vals.len >= 1 shl fftFourStepThreshold:
+    tp.fft_nr_four_step_parallel(desc, output, vals)
+  else:
+    fft_nr_iterative_dif(desc, output, vals)
+
+proc fft_nn_parallel*[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F]): FFTStatus =
+  ## Parallel FFT from natural order to natural order.
+  ## Dispatches to: Parallel FFT NR + BitRev
+  ##
+  ## Input: natural order values
+  ## Output: natural order values in Fourier domain
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let status = tp.fft_nr_parallel(desc, output, vals)
+  if status != FFT_Success: return status
+  tp.bit_reversal_permutation_parallel(output)
+  return FFT_Success
+
+# ############################################################
+#
+#          Batched FFT (many equal-size transforms)
+#
+# ############################################################
+
+proc fft_nr_batch_parallel*[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       layout = kRowMajor): FFTStatus =
+  ## Parallel batched FFT from natural order to bit-reversed order
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## The transforms are distributed over the threadpool.
+  ##
+  ## Input: natural order values
+  ## Output: bit-reversed order values in Fourier domain, in the same layout
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  let data = output.asUnchecked()
+  let rootsOfUnity = desc.rootsOfUnity
+  let order = desc.order
+  let radix = desc.radix
+
+  case layout
+  of kRowMajor:
+    syncScope:
+      tp.parallelFor b in 0 ..< batchSize:
+        stride: fftBatchInterleave
+        captures: {data, n, batchSize, layout, rootsOfUnity, order, radix}
+        fft_nr_batch_rows(
+          data, n, b, min(b+fftBatchInterleave, batchSize), batchSize, layout,
+          rootsOfUnity, order, radix)
+  of kColMajor:
+    # Each task owns a band of contiguous columns
+    const bandSize = 32
+    syncScope:
+      tp.parallelFor b in 0 ..< batchSize:
+        stride: bandSize
+        captures: {data, n, batchSize, layout, rootsOfUnity, order, radix}
+        fft_nr_batch_rows(
+          data, n, b, min(b+bandSize, batchSize), batchSize, layout,
+          rootsOfUnity, order, radix)
+
+  return FFT_Success
+
+proc fft_nn_batch_parallel*[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       layout = kRowMajor): FFTStatus =
+  ## Parallel batched FFT from natural order to natural order
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## Dispatches to: Parallel batched FFT NR + BitRev
+  ##
+  ## Input: natural order values
+  ## Output: natural order values in Fourier domain, in the same layout
+  ## Domain: roots of unity (no shift)
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let status = tp.fft_nr_batch_parallel(desc, output, vals, batchSize, layout)
+  if status != FFT_Success:
+    return status
+
+  let data = output.asUnchecked()
+  let n = vals.len div batchSize
+  syncScope:
+    tp.parallelFor b in 0 ..< batchSize:
+      stride: fftBatchInterleave
+      captures: {data, n, batchSize, layout}
+      bit_reversal_permutation_batch(data, n, b, min(b+fftBatchInterleave, batchSize), batchSize, layout)
+
+  return FFT_Success
+
+proc coset_fft_nr_batch_parallel*[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       cosetShift: F,
+       layout = kRowMajor): FFTStatus =
+  ## Parallel batched FFT over a coset of the roots of unity (natural to bit-reversed order)
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## The transforms are distributed over the threadpool
+  ## and use the descriptor cached coset twiddles if available.
+  ##
+  ## Input: natural order values
+  ## Output: bit-reversed order values over the coset, in the same layout
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  let data = output.asUnchecked()
+  let rootsOfUnity = desc.rootsOfUnity
+  let order = desc.order
+  let radix = desc.radix
+
+  let slot = desc.findCosetTwiddles(cosetShift, n)
+  if slot >= 0:
+    let twiddles = desc.cosets[slot].fwd
+    case layout
+    of kRowMajor:
+      syncScope:
+        tp.parallelFor b in 0 ..< batchSize:
+          stride: fftBatchInterleave
+          captures: {data, n, batchSize, layout, twiddles, rootsOfUnity, order, radix}
+          coset_fft_nr_fused_batch_rows(
+            data, n, b, min(b+fftBatchInterleave, batchSize), batchSize, layout,
+            twiddles, rootsOfUnity, order, radix)
+    of kColMajor:
+      const bandSize = 32
+      syncScope:
+        tp.parallelFor b in 0 ..< batchSize:
+          stride: bandSize
+          captures: {data, n, batchSize, layout, twiddles, rootsOfUnity, order, radix}
+          coset_fft_nr_fused_batch_rows(
+            data, n, b, min(b+bandSize, batchSize), batchSize, layout,
+            twiddles, rootsOfUnity, order, radix)
+    return FFT_Success
+
+  var one {.noInit.}: F
+  one.setOne()
+  let shifts = allocScalingFactors(n, one, cosetShift)
+
+  case layout
+  of kRowMajor:
+    syncScope:
+      tp.parallelFor b in 0 ..< batchSize:
+        stride: fftBatchInterleave
+        captures: {data, n, batchSize, layout, shifts, rootsOfUnity, order, radix}
+        coset_fft_nr_batch_rows(
+          data, n, b, min(b+fftBatchInterleave, batchSize), batchSize, layout,
+          shifts, rootsOfUnity, order, radix)
+  of kColMajor:
+    const bandSize = 32
+    syncScope:
+      tp.parallelFor b in 0 ..< batchSize:
+        stride: bandSize
+        captures: {data, n, batchSize, layout, shifts, rootsOfUnity, order, radix}
+        coset_fft_nr_batch_rows(
+          data, n, b, min(b+bandSize, batchSize), batchSize, layout,
+          shifts, rootsOfUnity, order, radix)
+
+  freeHeapAligned(shifts)
+  return FFT_Success
+
+proc coset_ifft_rn_batch_parallel*[F](
+       tp: Threadpool,
+       desc: FrFFT_Descriptor[F],
+       output: var openarray[F],
+       vals: openarray[F],
+       batchSize: int,
+       cosetShift: F,
+       layout = kRowMajor): FFTStatus =
+  ## Parallel batched inverse FFT over a coset of the roots of unity (bit-reversed to natural order)
+  ## of `batchSize` polynomials of equal size n = vals.len / batchSize.
+  ## The transforms are distributed over the threadpool
+  ## and use the descriptor cached coset twiddles if available.
+  ##
+  ## Input: bit-reversed order values over the coset
+  ## Output: natural order values, in the same layout
+  ##
+  ## **Supports in-place operation**: `output` and `vals` can be the same array.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  var n: int
+  let status = desc.fft_batch_dims(output.len, vals.len, batchSize, n)
+  if status != FFT_Success:
+    return status
+
+  if output[0].addr != vals[0].addr:
+    for i in 0 ..< vals.len:
+      output[i] = vals[i]
+
+  let data = output.asUnchecked()
+  let rootsOfUnity = desc.rootsOfUnity
+  let order = desc.order
+
+  let slot = desc.findCosetTwiddles(cosetShift, n)
+  if slot >= 0:
+    let invTwiddles = desc.cosets[slot].inv
+    case layout
+    of kRowMajor:
+      syncScope:
+        tp.parallelFor b in 0 ..< batchSize:
+          stride: fftBatchInterleave
+          captures: {data, n, batchSize, layout, invTwiddles, rootsOfUnity, order}
+          coset_ifft_rn_fused_batch_rows(
+            data, n, b, min(b+fftBatchInterleave, batchSize), batchSize, layout,
+            invTwiddles, rootsOfUnity, order)
+    of kColMajor:
+      const bandSize = 32
+      syncScope:
+        tp.parallelFor b in 0 ..< batchSize:
+          stride: bandSize
+          captures: {data, n, batchSize, layout, invTwiddles, rootsOfUnity, order}
+          coset_ifft_rn_fused_batch_rows(
+            data, n, b, min(b+bandSize, batchSize), batchSize, layout,
+            invTwiddles, rootsOfUnity, order)
+    return FFT_Success
+
+  var invLen {.noInit.}, invShift {.noInit.}: F
+  invLen.fromUint(n.uint64)
+  invLen.inv_vartime()
+  invShift.inv_vartime(cosetShift)
+  let factors = allocScalingFactors(n, invLen, invShift)
+
+  case layout
+  of kRowMajor:
+    syncScope:
+      tp.parallelFor b in 0 ..< batchSize:
+        stride: fftBatchInterleave
+        captures: {data, n, batchSize, layout, factors, rootsOfUnity, order}
+        coset_ifft_rn_batch_rows(
+          data, n, b, min(b+fftBatchInterleave, batchSize), batchSize, layout,
+          factors, rootsOfUnity, order)
+  of kColMajor:
+    const bandSize = 32
+    syncScope:
+      tp.parallelFor b in 0 ..< batchSize:
+        stride: bandSize
+        captures: {data, n, batchSize, layout, factors, rootsOfUnity, order}
+        coset_ifft_rn_batch_rows(
+          data, n, b, min(b+bandSize, batchSize), batchSize, layout,
+          factors, rootsOfUnity, order)
+
+  freeHeapAligned(factors)
+  return FFT_Success
@@ -11,7 +11,7 @@ import
   constantine/math/arithmetic,
   constantine/math/io/io_fields,
   constantine/math/polynomials/fft_fields,
-  constantine/platforms/[primitives, allocs, static_for]
+  constantine/platforms/[primitives, allocs, static_for, views]
 
 ## ############################################################
 ##
@@ -202,6 +202,663 @@ func `-=`*(f: var PolynomialCoef, g: PolynomialCoef) =
   for i in 0 ..< f.coefs.len:
     f.coefs[i] -= g.coefs[i]
 
+# Polynomials in coefficient form
+#   Subquadratic arithmetic
+# ------------------------------------------------------
+#
+# Multiplication dispatches on the operand sizes:
+# - schoolbook O(n²) for small polynomials
+# - Karatsuba O(n^1.58) for medium polynomials
+#   or when no FFT descriptor large enough is available
+# - NTT O(n log n) otherwise
+#
+# Division uses Newton iteration on the reversed divisor
+# to compute the quotient with a constant number of multiplications.
+#
+# Sizes are dynamic, the polynomials are passed as coefficients
+# in increasing degree order [a₀, a₁, ..., aₙ₋₁]
+# and do not need to have a power-of-2 length.
+#
+# References:
+# - Modern Computer Algebra, 3rd edition
+#   von zur Gathen, Gerhard, 2013
+#   Chapter 8 (Fast multiplication) and 9 (Newton iteration)
+
+const
+  polyMulKaratsubaThreshold* = 32
+    ## Operand size above which Karatsuba multiplication is used instead of schoolbook
+  polyMulNttThreshold* = 128
+    ## Operand size above which NTT multiplication is used instead of Karatsuba
+  polyDivNewtonThreshold* = 64
+    ## Quotient and divisor size above which Newton division is used instead of long division
+
+func polyMulSchoolbook[F](r: ptr UncheckedArray[F], a: ptr UncheckedArray[F], la: int, b: ptr UncheckedArray[F], lb: int) =
+  ## Schoolbook polynomial multiplication
+  ## r[0 ..< la+lb-1] <- a * b
+  ## r must not alias a or b
+  for i in 0 ..< la+lb-1:
+    r[i].setZero()
+  for i in 0 ..< la:
+    for j in 0 ..< lb:
+      var t {.noInit.}: F
+      t.prod(a[i], b[j])
+      r[i+j] += t
+
+func polyMulKaratsuba_impl[F](r: ptr UncheckedArray[F], a, b: ptr UncheckedArray[F], n: int) =
+  ## Karatsuba multiplication of 2 polynomials of size n
+  ## r[0 ..< 2n-1] <- a * b
+  ## r must not alias a or b
+  if n <= polyMulKaratsubaThreshold:
+    polyMulSchoolbook(r, a, n, b, n)
+    return
+
+  # a = a₀ + Xʰ a₁, b = b₀ + Xʰ b₁
+  # a*b = a₀b₀ + Xʰ((a₀+a₁)(b₀+b₁) - a₀b₀ - a₁b₁) + X²ʰ a₁b₁
+  let h = n shr 1
+  let h2 = n - h # h2 ∈ {h, h+1}
+
+  # z₀ = a₀b₀ in r[0 ..< 2h-1]
+  # z₂ = a₁b₁ in r[2h ..< 2n-1]
+  polyMulKaratsuba_impl(r, a, b, h)
+  r[2*h-1].setZero()
+  polyMulKaratsuba_impl(r +% 2*h, a +% h, b +% h, h2)
+
+  # z₁ = (a₀+a₁)(b₀+b₁) - z₀ - z₂
+  let scratch = allocHeapArrayAligned(F, 4*h2-1, alignment = 64)
+  let sa = scratch
+  let sb = scratch +% h2
+  let z1 = scratch +% 2*h2
+
+  for i in 0 ..< h:
+    sa[i].sum(a[i], a[h+i])
+    sb[i].sum(b[i], b[h+i])
+  if h2 > h:
+    sa[h] = a[n-1]
+    sb[h] = b[n-1]
+
+  polyMulKaratsuba_impl(z1, sa, sb, h2)
+  for i in 0 ..< 2*h-1:
+    z1[i] -= r[i]
+  for i in 0 ..< 2*h2-1:
+    z1[i] -= r[2*h+i]
+
+  for i in 0 ..< 2*h2-1:
+    r[h+i] += z1[i]
+
+  freeHeapAligned(scratch)
+
+func polyMulKaratsuba[F](r: ptr UncheckedArray[F], a: ptr UncheckedArray[F], la: int, b: ptr UncheckedArray[F], lb: int) =
+  ## Karatsuba polynomial multiplication
+  ## r[0 ..< la+lb-1] <- a * b
+  ## r must not alias a or b
+  ##
+  ## Unbalanced operands are split in chunks of the smaller size.
+  if la < lb:
+    polyMulKaratsuba(r, b, lb, a, la)
+    return
+  if la == lb:
+    polyMulKaratsuba_impl(r, a, b, la)
+    return
+  if lb <= polyMulKaratsubaThreshold:
+    polyMulSchoolbook(r, a, la, b, lb)
+    return
+
+  for i in 0 ..< la+lb-1:
+    r[i].setZero()
+
+  let chunk = allocHeapArrayAligned(F, 2*lb-1, alignment = 64)
+  var offset = 0
+  while offset < la:
+    let len = min(lb, la - offset)
+    polyMulKaratsuba(chunk, a +% offset, len, b, lb)
+    for i in 0 ..< len+lb-1:
+      r[offset+i] += chunk[i]
+    offset += lb
+  freeHeapAligned(chunk)
+
+func polyMulNTT[F](
+       r: ptr UncheckedArray[F],
+       a: ptr UncheckedArray[F], la: int,
+       b: ptr UncheckedArray[F], lb: int,
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## NTT polynomial multiplication
+  ## r[0 ..< la+lb-1] <- a * b
+  ##
+  ## `fft_desc` must have an order at least la+lb-1 rounded up to the next power of 2
+  let lr = la+lb-1
+  let n = int nextPowerOfTwo_vartime(uint lr)
+  debug: doAssert n <= fft_desc.order
+
+  let ea = allocHeapArrayAligned(F, n, alignment = 64)
+  let eb = allocHeapArrayAligned(F, n, alignment = 64)
+
+  for i in 0 ..< la:
+    ea[i] = a[i]
+  for i in la ..< n:
+    ea[i].setZero()
+  for i in 0 ..< lb:
+    eb[i] = b[i]
+  for i in lb ..< n:
+    eb[i].setZero()
+
+  # Natural → Bit-reversed, pointwise product, Bit-reversed → Natural
+  var status = fft_desc.fft_nr(ea.toOpenArray(n), ea.toOpenArray(n))
+  doAssert status == FFT_Success
+  status = fft_desc.fft_nr(eb.toOpenArray(n), eb.toOpenArray(n))
+  doAssert status == FFT_Success
+
+  for i in 0 ..< n:
+    ea[i] *= eb[i]
+
+  status = fft_desc.ifft_rn(ea.toOpenArray(n), ea.toOpenArray(n))
+  doAssert status == FFT_Success
+
+  for i in 0 ..< lr:
+    r[i] = ea[i]
+
+  freeHeapAligned(eb)
+  freeHeapAligned(ea)
+
+func polyMul_impl[F](
+       r: ptr UncheckedArray[F],
+       a: ptr UncheckedArray[F], la: int,
+       b: ptr UncheckedArray[F], lb: int,
+       fft_desc: ptr FrFFT_Descriptor[F]) =
+  ## Polynomial multiplication with automatic algorithm selection
+  ## r[0 ..< la+lb-1] <- a * b
+  ## r must not alias a or b
+  ## `fft_desc` may be nil, NTT multiplication is then not available.
+  let minLen = min(la, lb)
+  if minLen <= polyMulKaratsubaThreshold:
+    polyMulSchoolbook(r, a, la, b, lb)
+  elif minLen <= polyMulNttThreshold or fft_desc.isNil() or
+         int(nextPowerOfTwo_vartime(uint(la+lb-1))) > fft_desc.order:
+    polyMulKaratsuba(r, a, la, b, lb)
+  else:
+    polyMulNTT(r, a, la, b, lb, fft_desc[])
+
+func polyMul*[F](
+       r: var openArray[F],
+       a, b: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Polynomial multiplication in coefficient form
+  ## r <- a * b
+  ##
+  ## r.len must be a.len + b.len - 1
+  ## r must not alias a or b
+  ##
+  ## Dispatches to schoolbook, Karatsuba or NTT multiplication depending on the sizes.
+  ## NTT multiplication requires `fft_desc` to have an order
+  ## at least r.len rounded up to the next power of 2,
+  ## otherwise Karatsuba multiplication is used.
+  debug: doAssert r.len == a.len + b.len - 1
+  polyMul_impl(r.asUnchecked(), a.asUnchecked(), a.len, b.asUnchecked(), b.len, fft_desc.unsafeAddr)
+
+func polyMul*[F](
+       r: var openArray[F],
+       a, b: openArray[F]) =
+  ## Polynomial multiplication in coefficient form
+  ## r <- a * b
+  ##
+  ## r.len must be a.len + b.len - 1
+  ## r must not alias a or b
+  ##
+  ## Dispatches to schoolbook or Karatsuba multiplication depending on the sizes.
+  debug: doAssert r.len == a.len + b.len - 1
+  polyMul_impl(r.asUnchecked(), a.asUnchecked(), a.len, b.asUnchecked(), b.len, nil)
+
+func polyMul*[N, M, K: static int, F](
+       r: var PolynomialCoef[K, F],
+       a: PolynomialCoef[N, F],
+       b: PolynomialCoef[M, F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Polynomial multiplication in coefficient form
+  ## r <- a * b
+  static: doAssert K == N+M-1, "K was " & $K & " but N+M-1 was " & $(N+M-1)
+  r.coefs.polyMul(a.coefs, b.coefs, fft_desc)
+
+func polyInverse_impl[F](
+       r: ptr UncheckedArray[F], n: int,
+       a: ptr UncheckedArray[F], la: int,
+       fft_desc: ptr FrFFT_Descriptor[F]) =
+  ## Power series inverse r <- a⁻¹ mod Xⁿ
+  ## a[0] must be non-zero
+  #
+  # Newton iteration for g = 1/a doubles the precision at each step:
+  #   g₂ₖ = gₖ(2 - a gₖ) mod X²ᵏ
+  #       = gₖ - gₖ(a gₖ - 1)
+  # and a gₖ - 1 ≡ 0 mod Xᵏ, hence with h = (a gₖ)[k ..< 2k]
+  #   g₂ₖ[k ..< 2k] = -(gₖ h)[0 ..< k]
+  r[0].inv_vartime(a[0])
+  if n == 1:
+    return
+
+  let prod = allocHeapArrayAligned(F, 2*n, alignment = 64)
+  let corr = allocHeapArrayAligned(F, 2*n, alignment = 64)
+
+  var k = 1
+  while k < n:
+    let k2 = min(2*k, n)
+    let lta = min(la, k2)
+
+    # a gₖ, only the coefficients [k, k2) are needed
+    polyMul_impl(prod, a, lta, r, k, fft_desc)
+    for i in lta+k-1 ..< k2:
+      prod[i].setZero()
+
+    # gₖ h mod X^(k2-k)
+    let lh = k2-k
+    polyMul_impl(corr, r, min(k, lh), prod +% k, lh, fft_desc)
+
+    for i in 0 ..< lh:
+      r[k+i].neg(corr[i])
+
+    k = k2
+
+  freeHeapAligned(corr)
+  freeHeapAligned(prod)
+
+func polyInverse*[F](
+       r: var openArray[F],
+       a: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Power series inverse in coefficient form
+  ## r <- a⁻¹ mod Xⁿ with n = r.len
+  ##
+  ## a[0] must be non-zero.
+  ## r must not alias a.
+  debug: doAssert r.len >= 1 and a.len >= 1
+  debug: doAssert not a[0].isZero().bool()
+  polyInverse_impl(r.asUnchecked(), r.len, a.asUnchecked(), a.len, fft_desc.unsafeAddr)
+
+func polyDivRemSchoolbook[F](
+       q: ptr UncheckedArray[F],
+       rem: ptr UncheckedArray[F],
+       a: ptr UncheckedArray[F], la: int,
+       b: ptr UncheckedArray[F], lb: int) =
+  ## Long division
+  ## a = q b + rem
+  ## q has size la-lb+1 and rem has size lb-1
+  let working = allocHeapArrayAligned(F, la, alignment = 64)
+  for i in 0 ..< la:
+    working[i] = a[i]
+
+  var invLead {.noInit.}: F
+  invLead.inv_vartime(b[lb-1])
+
+  for i in countdown(la-lb, 0):
+    q[i].prod(working[i+lb-1], invLead)
+    for j in 0 ..< lb-1:
+      var t {.noInit.}: F
+      t.prod(b[j], q[i])
+      working[i+j] -= t
+
+  for i in 0 ..< lb-1:
+    rem[i] = working[i]
+
+  freeHeapAligned(working)
+
+func polyDivRemNewton[F](
+       q: ptr UncheckedArray[F],
+       rem: ptr UncheckedArray[F],
+       a: ptr UncheckedArray[F], la: int,
+       b: ptr UncheckedArray[F], lb: int,
+       fft_desc: ptr FrFFT_Descriptor[F]) =
+  ## Division via Newton iteration
+  ## a = q b + rem
+  ## q has size m = la-lb+1 and rem has size lb-1
+  #
+  # With rev(p)(X) = Xᵈᵉᵍ⁽ᵖ⁾ p(1/X):
+  #   rev(q) = rev(a) rev(b)⁻¹ mod Xᵐ
+  let m = la-lb+1
+
+  let lrb = min(lb, m)
+  let ra = allocHeapArrayAligned(F, m, alignment = 64)
+  let rb = allocHeapArrayAligned(F, lrb, alignment = 64)
+  let rbInv = allocHeapArrayAligned(F, m, alignment = 64)
+  let rq = allocHeapArrayAligned(F, 2*m-1, alignment = 64)
+
+  for i in 0 ..< m:
+    ra[i] = a[la-1-i]
+  for i in 0 ..< lrb:
+    rb[i] = b[lb-1-i]
+
+  polyInverse_impl(rbInv, m, rb, lrb, fft_desc)
+  polyMul_impl(rq, ra, m, rbInv, m, fft_desc)
+
+  for i in 0 ..< m:
+    q[i] = rq[m-1-i]
+
+  freeHeapAligned(rq)
+  freeHeapAligned(rbInv)
+  freeHeapAligned(rb)
+  freeHeapAligned(ra)
+
+  # rem = a - q b, only the low lb-1 coefficients are non-zero
+  if lb > 1:
+    let lqb = min(m, lb-1)
+    let qb = allocHeapArrayAligned(F, lqb+lb-2, alignment = 64)
+    polyMul_impl(qb, q, lqb, b, lb-1, fft_desc)
+    for i in 0 ..< lb-1:
+      rem[i].diff(a[i], qb[i])
+    freeHeapAligned(qb)
+
+func polyDivRem_impl[F](
+       q: ptr UncheckedArray[F],
+       rem: ptr UncheckedArray[F],
+       a: ptr UncheckedArray[F], la: int,
+       b: ptr UncheckedArray[F], lb: int,
+       fft_desc: ptr FrFFT_Descriptor[F]) =
+  ## Polynomial division with remainder
+  ## a = q b + rem
+  ## q has size max(la-lb+1, 0) and rem has size lb-1
+  if la < lb:
+    for i in 0 ..< la:
+      rem[i] = a[i]
+    for i in la ..< lb-1:
+      rem[i].setZero()
+    return
+
+  let m = la - lb + 1
+  if min(m, lb) <= polyDivNewtonThreshold:
+    polyDivRemSchoolbook(q, rem, a, la, b, lb)
+  else:
+    polyDivRemNewton(q, rem, a, la, b, lb, fft_desc)
+
+func polyDivRem*[F](
+       q: var openArray[F],
+       rem: var openArray[F],
+       a, b: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Polynomial division with remainder in coefficient form
+  ## a = q b + rem, with deg(rem) < deg(b)
+  ##
+  ## The leading coefficient b[b.len-1] must be non-zero.
+  ## q.len must be max(a.len - b.len + 1, 0) and rem.len must be b.len - 1
+  ## q and rem must not alias a or b
+  ##
+  ## Dispatches to long division for small quotients or divisors
+  ## and to Newton division otherwise.
+  debug: doAssert b.len >= 1 and not b[b.len-1].isZero().bool()
+  debug: doAssert q.len == max(a.len - b.len + 1, 0)
+  debug: doAssert rem.len == b.len - 1
+
+  polyDivRem_impl(
+    q.asUnchecked(), rem.asUnchecked(),
+    a.asUnchecked(), a.len, b.asUnchecked(), b.len,
+    fft_desc.unsafeAddr)
+
+# Polynomials in coefficient form
+#   Multipoint evaluation and interpolation
+# ------------------------------------------------------
+#
+# A subproduct tree over points x₀, ..., xₙ₋₁ stores at level k
+# the products Mₖ,ⱼ(X) = ∏ (X - xᵢ) for i in [j 2ᵏ, (j+1) 2ᵏ)
+# - level 0 has the n leaves (X - xᵢ)
+# - the root is the vanishing polynomial of all points.
+#
+# Evaluation reduces the polynomial modulo the tree nodes from the root down,
+# interpolation combines the Lagrange weights from the leaves up.
+# With subquadratic multiplication and division,
+# both are O(n log² n) instead of O(n²).
+#
+# The points are arbitrary, they do not need to be roots of unity
+# and n does not need to be a power of 2.
+#
+# References:
+# - Modern Computer Algebra, 3rd edition
+#   von zur Gathen, Gerhard, 2013
+#   Chapter 10 (Fast polynomial evaluation and interpolation)
+
+const multipointEvalHornerThreshold* = 32
+  ## Node size below which the remainder is evaluated at each point with Horner's method
+
+type
+  SubproductTree*[F] = object
+    ## Subproduct tree over arbitrary evaluation points.
+    ##
+    ## Node j of level k covers the points [j 2ᵏ, min((j+1) 2ᵏ, n))
+    ## and its monic polynomial of s+1 coefficients, s the number of points covered,
+    ## is stored at nodes[levelOffsets[k] + j (2ᵏ+1)].
+    numPoints*: int
+    numLevels*: int
+    points: ptr UncheckedArray[F]
+    nodes: ptr UncheckedArray[F]
+    levelOffsets: ptr UncheckedArray[int]
+
+proc `=destroy`*[F](tree: var SubproductTree[F]) {.raises: [].} =
+  if not tree.points.isNil():
+    freeHeapAligned(tree.points)
+  if not tree.nodes.isNil():
+    freeHeapAligned(tree.nodes)
+  if not tree.levelOffsets.isNil():
+    freeHeap(tree.levelOffsets)
+  tree.points = nil
+  tree.nodes = nil
+  tree.levelOffsets = nil
+
+proc `=copy`*[F](dst: var SubproductTree[F], src: SubproductTree[F]) {.error: "A subproduct tree cannot be copied".}
+
+func subproductTreeNode[F](
+       nodes: ptr UncheckedArray[F],
+       levelOffsets: ptr UncheckedArray[int],
+       k, j: int): ptr UncheckedArray[F] {.inline.} =
+  nodes +% (levelOffsets[k] + j*((1 shl k) + 1))
+
+func subproductTreeNodeSize(numPoints, k, j: int): int {.inline.} =
+  ## Number of points covered by node j at level k
+  min(1 shl k, numPoints - (j shl k))
+
+func subproductTreeNumNodes(numPoints, k: int): int {.inline.} =
+  (numPoints + (1 shl k) - 1) shr k
+
+func subproductTreeBuildNode[F](
+       nodes: ptr UncheckedArray[F],
+       levelOffsets: ptr UncheckedArray[int],
+       numPoints, k, j: int,
+       fft_desc: ptr FrFFT_Descriptor[F]) =
+  ## Build node j of level k >= 1 from its children
+  let dst = subproductTreeNode(nodes, levelOffsets, k, j)
+  let left = subproductTreeNode(nodes, levelOffsets, k-1, 2*j)
+  let sL = subproductTreeNodeSize(numPoints, k-1, 2*j)
+
+  if 2*j+1 < subproductTreeNumNodes(numPoints, k-1):
+    let right = subproductTreeNode(nodes, levelOffsets, k-1, 2*j+1)
+    let sR = subproductTreeNodeSize(numPoints, k-1, 2*j+1)
+    polyMul_impl(dst, left, sL+1, right, sR+1, fft_desc)
+  else:
+    for i in 0 .. sL:
+      dst[i] = left[i]
+
+func subproductTreeAlloc[F](tree: var SubproductTree[F], points: openArray[F]) =
+  ## Allocate the tree storage and set the leaves (X - xᵢ)
+  `=destroy`(tree)
+
+  let n = points.len
+  tree.numPoints = n
+  tree.numLevels = 1
+  while (1 shl (tree.numLevels-1)) < n:
+    tree.numLevels += 1
+  tree.levelOffsets = allocHeapArray(int, tree.numLevels)
+
+  var size = 0
+  for k in 0 ..< tree.numLevels:
+    tree.levelOffsets[k] = size
+    size += n + subproductTreeNumNodes(n, k)
+
+  tree.points = allocHeapArrayAligned(F, n, alignment = 64)
+  tree.nodes = allocHeapArrayAligned(F, size, alignment = 64)
+
+  for i in 0 ..< n:
+    tree.points[i] = points[i]
+    let leaf = subproductTreeNode(tree.nodes, tree.levelOffsets, 0, i)
+    leaf[0].neg(points[i])
+    leaf[1].setOne()
+
+func init*[F](
+       tree: var SubproductTree[F],
+       points: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Build the subproduct tree over the evaluation points.
+  ##
+  ## The points must be distinct for interpolation.
+  ## `fft_desc` enables NTT multiplication for large nodes,
+  ## see `polyMul`.
+  debug: doAssert points.len >= 1
+
+  tree.subproductTreeAlloc(points)
+  for k in 1 ..< tree.numLevels:
+    for j in 0 ..< subproductTreeNumNodes(tree.numPoints, k):
+      subproductTreeBuildNode(
+        tree.nodes, tree.levelOffsets,
+        tree.numPoints, k, j, fft_desc.unsafeAddr)
+
+func vanishingPoly*[F](tree: SubproductTree[F]): ptr UncheckedArray[F] {.inline.} =
+  ## Returns the vanishing polynomial ∏ (X - xᵢ) of all points
+  ## with numPoints+1 coefficients, stored in the tree
+  subproductTreeNode(tree.nodes, tree.levelOffsets, tree.numLevels-1, 0)
+
+func evalHorner[F](r: var F, poly: ptr UncheckedArray[F], len: int, x: F) {.inline.} =
+  r = poly[len-1]
+  for i in countdown(len-2, 0):
+    r *= x
+    r += poly[i]
+
+func multipointEval_impl[F](
+       tree: SubproductTree[F],
+       r: ptr UncheckedArray[F],
+       poly: ptr UncheckedArray[F], polyLen: int,
+       fft_desc: ptr FrFFT_Descriptor[F]) =
+  ## Evaluate a polynomial in coefficient form at all points of the tree
+  let n = tree.numPoints
+  let rem = allocHeapArrayAligned(F, n, alignment = 64)
+  let remNext = allocHeapArrayAligned(F, n, alignment = 64)
+  let quotient = allocHeapArrayAligned(F, max(n, polyLen), alignment = 64)
+
+  # 1. Reduce modulo the vanishing polynomial
+  polyDivRem_impl(quotient, rem, poly, polyLen, tree.vanishingPoly(), n+1, fft_desc)
+
+  # 2. Reduce modulo the children of each node, down to the Horner threshold.
+  #    At each level the remainder of node j of size sⱼ is stored at rem[j 2ᵏ ..< j 2ᵏ + sⱼ].
+  var cur = rem
+  var next = remNext
+  var k = tree.numLevels-1
+  while k > 0 and (1 shl k) > multipointEvalHornerThreshold:
+    let half = 1 shl (k-1)
+    for j in 0 ..< subproductTreeNumNodes(n, k):
+      let offset = j shl k
+      let s = subproductTreeNodeSize(n, k, j)
+      for c in 0 ..< 2:
+        let child = 2*j+c
+        if child >= subproductTreeNumNodes(n, k-1):
+          break
+        let sC = subproductTreeNodeSize(n, k-1, child)
+        polyDivRem_impl(
+          quotient, next +% (offset + c*half),
+          cur +% offset, s,
+          subproductTreeNode(tree.nodes, tree.levelOffsets, k-1, child), sC+1,
+          fft_desc)
+    swap(cur, next)
+    k -= 1
+
+  # 3. Evaluate the small remainders directly
+  for j in 0 ..< subproductTreeNumNodes(n, k):
+    let offset = j shl k
+    let s = subproductTreeNodeSize(n, k, j)
+    for i in offset ..< offset+s:
+      r[i].evalHorner(cur +% offset, s, tree.points[i])
+
+  freeHeapAligned(quotient)
+  freeHeapAligned(remNext)
+  freeHeapAligned(rem)
+
+func multipointEval*[F](
+       tree: SubproductTree[F],
+       r: var openArray[F],
+       poly: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Evaluate a polynomial in coefficient form
+  ## at all the points of the subproduct tree
+  ## r[i] <- poly(xᵢ)
+  ##
+  ## r.len must be the number of points.
+  ## The polynomial can have any number of coefficients.
+  debug: doAssert r.len == tree.numPoints
+  debug: doAssert poly.len >= 1
+  tree.multipointEval_impl(r.asUnchecked(), poly.asUnchecked(), poly.len, fft_desc.unsafeAddr)
+
+func interpolate*[F](
+       tree: SubproductTree[F],
+       r: var openArray[F],
+       values: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Interpolate the unique polynomial of degree < n
+  ## with r(xᵢ) = values[i] for the points of the subproduct tree
+  ##
+  ## r.len and values.len must be the number of points n.
+  ## Output coefficients are in natural order [r₀, r₁, ..., rₙ₋₁].
+  ## The points must be distinct.
+  #
+  # r(X) = ∑ yᵢ/M'(xᵢ) . M(X)/(X - xᵢ)
+  # with M the vanishing polynomial and M'(xᵢ) = ∏ⱼ₌ᵢ (xᵢ - xⱼ)
+  # The sum is computed bottom-up: Pₖ₊₁ = Pₖ,left . Mₖ,right + Pₖ,right . Mₖ,left
+  let n = tree.numPoints
+  debug: doAssert r.len == n
+  debug: doAssert values.len == n
+
+  # 1. Weights cᵢ = yᵢ/M'(xᵢ)
+  let weights = allocHeapArrayAligned(F, n, alignment = 64)
+  let deriv = allocHeapArrayAligned(F, n, alignment = 64)
+
+  let M = tree.vanishingPoly()
+  for i in 0 ..< n:
+    var degree {.noInit.}: F
+    degree.fromInt(i+1)
+    deriv[i].prod(M[i+1], degree)
+
+  tree.multipointEval_impl(weights, deriv, n, fft_desc.unsafeAddr)
+
+  # batchInv_vartime uses 1 byte of stack per element,
+  # chunk the inversions to bound stack usage to 4 KiB.
+  # A single inversion is still amortized over 4096 elements.
+  const elemsPerBatch = 4096
+  for iStart in countup(0, n-1, elemsPerBatch):
+    batchInv_vartime(deriv +% iStart, weights +% iStart, min(elemsPerBatch, n-iStart))
+  for i in 0 ..< n:
+    weights[i].prod(deriv[i], values[i])
+
+  # 2. Linear combination, from the leaves up.
+  #    At each level the partial sum of node j of size sⱼ is stored at cur[j 2ᵏ ..< j 2ᵏ + sⱼ].
+  let tmp = allocHeapArrayAligned(F, n, alignment = 64)
+  var cur = weights
+  var next = deriv
+  for k in 1 ..< tree.numLevels:
+    let half = 1 shl (k-1)
+    for j in 0 ..< subproductTreeNumNodes(n, k):
+      let offset = j shl k
+      let sL = subproductTreeNodeSize(n, k-1, 2*j)
+      if 2*j+1 >= subproductTreeNumNodes(n, k-1):
+        for i in 0 ..< sL:
+          next[offset+i] = cur[offset+i]
+        continue
+
+      let sR = subproductTreeNodeSize(n, k-1, 2*j+1)
+      let mL = subproductTreeNode(tree.nodes, tree.levelOffsets, k-1, 2*j)
+      let mR = subproductTreeNode(tree.nodes, tree.levelOffsets, k-1, 2*j+1)
+
+      polyMul_impl(next +% offset, cur +% offset, sL, mR, sR+1, fft_desc.unsafeAddr)
+      polyMul_impl(tmp, cur +% (offset+half), sR, mL, sL+1, fft_desc.unsafeAddr)
+      for i in 0 ..< sL+sR:
+        next[offset+i] += tmp[i]
+    swap(cur, next)
+
+  for i in 0 ..< n:
+    r[i] = cur[i]
+
+  freeHeapAligned(tmp)
+  freeHeapAligned(deriv)
+  freeHeapAligned(weights)
+
 func computeEvalsAtCoset*[L, R: static int, Name: static Algebra](
        ys: var array[L, Fr[Name]],
        poly: PolynomialCoef,
@@ -439,6 +1096,116 @@ func evalPolyAt*[N: static int, Field; Ord](
 
   freeHeapAligned(invRootsMinusZ)
 
+# Polynomials in evaluation/Lagrange form
+#   Domain = roots of unity
+#   Batched evaluation
+# ------------------------------------------------------
+#
+# Evaluating M polynomials at K points shares the barycentric weights
+#   ωⁱ/(ωⁱ-zₖ) and (1-zₖⁿ)/n
+# across polynomials, and computes the K.N inverses with one batch inversion
+# per chunk of points.
+
+func barycentricWeightsAt[N: static int, Field; Ord](
+       domain: PolyEvalRootsDomain[N, Field, Ord],
+       weights: ptr UncheckedArray[Field],
+       factors: ptr UncheckedArray[Field],
+       zIndices: ptr UncheckedArray[int],
+       zs: ptr UncheckedArray[Field],
+       kStart, kStop: int) =
+  ## Compute for the points zₖ, k in [kStart, kStop)
+  ## - weights[k*N + i] = ωⁱ/(ωⁱ-zₖ)
+  ## - factors[k] = (1-zₖⁿ)/n
+  ## - zIndices[k] = i if zₖ = ωⁱ and -1 otherwise
+  ## with a single batch inversion
+  static: doAssert N.isPowerOf2_vartime()
+
+  let len = (kStop-kStart)*N
+  let w = weights +% kStart*N
+  let diffs = allocHeapArrayAligned(Field, len, alignment = 64)
+
+  for k in kStart ..< kStop:
+    zIndices[k] = -1
+    for i in 0 ..< N:
+      let d = diffs +% (k-kStart)*N
+      d[i].diff(domain.rootsOfUnity[i], zs[k])
+      if d[i].isZero().bool():
+        zIndices[k] = i
+
+  batchInv_vartime(w, diffs, len)
+
+  for k in kStart ..< kStop:
+    let wk = weights +% k*N
+    for i in 0 ..< N:
+      wk[i] *= domain.rootsOfUnity[i]
+
+    const numDoublings = log2_vartime(uint32 N) # N is a power of 2
+    var t {.noInit.}: Field
+    t = zs[k]
+    t.square_repeated(int numDoublings)         # exponentiation by a power of 2
+    t.diff(Field.getOne(), t)
+    factors[k].prod(t, domain.invMaxDegree)
+
+  freeHeapAligned(diffs)
+
+func barycentricEvalAt[N: static int, Field; Ord](
+       r: var Field,
+       poly: PolynomialEval[N, Field, Ord],
+       weights: ptr UncheckedArray[Field],
+       factor: Field,
+       zIndex: int) {.inline.} =
+  ## Evaluate a polynomial in evaluation form
+  ## using the precomputed barycentric weights of a point z
+  if zIndex != -1:
+    r = poly.evals[zIndex]
+    return
+
+  r.setZero()
+  for i in 0 ..< N:
+    var summand {.noInit.}: Field
+    summand.prod(weights[i], poly.evals[i])
+    r += summand
+  r *= factor
+
+func evalPolysAt*[N: static int, Field; Ord](
+       domain: PolyEvalRootsDomain[N, Field, Ord],
+       r: var openArray[Field],
+       polys: openArray[PolynomialEval[N, Field, Ord]],
+       zs: openArray[Field]) =
+  ## Evaluate M polynomials in evaluation form
+  ## at K points z
+  ## r[m*K + k] <- polys[m](zs[k])
+  ##
+  ## r.len must be polys.len * zs.len.
+  ## The points z may be in the domain.
+  ##
+  ## **variable-time**:
+  ## This leaks whether each z is in the domain or not.
+  let M = polys.len
+  let K = zs.len
+  debug: doAssert r.len == M*K
+  if K == 0:
+    return
+
+  let weights = allocHeapArrayAligned(Field, K*N, alignment = 64)
+  let factors = allocHeapArrayAligned(Field, K, alignment = 64)
+  let zIndices = allocHeapArray(int, K)
+
+  # batchInv_vartime uses 1 byte of stack per element,
+  # chunk the points to bound stack usage to 16*N bytes.
+  # A single inversion is still amortized over 16*N elements.
+  const pointsPerBatch = 16
+  for kStart in countup(0, K-1, pointsPerBatch):
+    domain.barycentricWeightsAt(weights, factors, zIndices, zs.asUnchecked(), kStart, min(kStart+pointsPerBatch, K))
+
+  for m in 0 ..< M:
+    for k in 0 ..< K:
+      r[m*K + k].barycentricEvalAt(polys[m], weights +% k*N, factors[k], zIndices[k])
+
+  freeHeap(zIndices)
+  freeHeapAligned(factors)
+  freeHeapAligned(weights)
+
 # Polynomials in evaluation/Lagrange form
 #   Domain = generic
 # ------------------------------------------------------
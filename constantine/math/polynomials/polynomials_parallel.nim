@@ -11,7 +11,7 @@ export polynomials
 
 import
   constantine/math/arithmetic,
-  constantine/platforms/[allocs, bithacks],
+  constantine/platforms/[primitives, allocs, bithacks],
   ../../threadpool/threadpool
 
 ## ############################################################
@@ -95,3 +95,87 @@ proc evalPolyAt_parallel*[N: static int, Field; Ordering: static PolyOrdering](
     r = poly.evals[zIndex]
 
   freeHeapAligned(invRootsMinusZ)
+
+proc init_parallel*[F](
+       tp: Threadpool,
+       tree: var SubproductTree[F],
+       points: openArray[F],
+       fft_desc: FrFFT_Descriptor[F]) =
+  ## Build the subproduct tree over the evaluation points.
+  ## The nodes of each level are independent and distributed over the threadpool.
+  ##
+  ## The points must be distinct for interpolation.
+  ## `fft_desc` enables NTT multiplication for large nodes,
+  ## see `polyMul`.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  debug: doAssert points.len >= 1
+
+  tree.subproductTreeAlloc(points)
+
+  let nodes = tree.nodes
+  let levelOffsets = tree.levelOffsets
+  let numPoints = tree.numPoints
+  let pDesc = fft_desc.unsafeAddr
+
+  for k in 1 ..< tree.numLevels:
+    syncScope:
+      tp.parallelFor j in 0 ..< subproductTreeNumNodes(numPoints, k):
+        captures: {nodes, levelOffsets, numPoints, k, pDesc}
+        subproductTreeBuildNode(nodes, levelOffsets, numPoints, k, j, pDesc)
+
+
+proc evalPolysAt_parallel*[N: static int, Field; Ordering: static PolyOrdering](
+       tp: Threadpool,
+       domain: PolyEvalRootsDomain[N, Field, Ordering],
+       r: var openArray[Field],
+       polys: openArray[PolynomialEval[N, Field, Ordering]],
+       zs: openArray[Field]) =
+  ## Evaluate M polynomials in evaluation form
+  ## at K points z
+  ## r[m*K + k] <- polys[m](zs[k])
+  ##
+  ## r.len must be polys.len * zs.len.
+  ## The points z may be in the domain.
+  ##
+  ## Each task computes the barycentric weights of a chunk of points
+  ## with a single batch inversion, the weights are then shared across polynomials.
+  ##
+  ## **variable-time**:
+  ## This leaks whether each z is in the domain or not.
+  ##
+  ## Parallelism: This only returns when computation is fully done
+  let M = polys.len
+  let K = zs.len
+  debug: doAssert r.len == M*K
+  if K == 0:
+    return
+
+  let weights = allocHeapArrayAligned(Field, K*N, alignment = 64)
+  let factors = allocHeapArrayAligned(Field, K, alignment = 64)
+  let zIndices = allocHeapArray(int, K)
+
+  let pDomain = domain.unsafeAddr
+  let pZs = zs.asUnchecked()
+  let pPolys = polys.asUnchecked()
+  let pR = r.asUnchecked()
+  let domainSize = N
+
+  # 1. Barycentric weights, one batch inversion per chunk of points
+  const pointsPerTask = 4
+  syncScope:
+    tp.parallelFor k in 0 ..< K:
+      stride: pointsPerTask
+      captures: {pDomain, weights, factors, zIndices, pZs, K}
+      pDomain[].barycentricWeightsAt(weights, factors, zIndices, pZs, k, min(k+pointsPerTask, K))
+
+  # 2. Evaluations
+  syncScope:
+    tp.parallelFor mk in 0 ..< M*K:
+      captures: {pR, pPolys, weights, factors, zIndices, K, domainSize}
+      let k = mk mod K
+      pR[mk].barycentricEvalAt(pPolys[mk div K], weights +% k*domainSize, factors[k], zIndices[k])
+
+  freeHeap(zIndices)
+  freeHeapAligned(factors)
+  freeHeapAligned(weights)
@@ -0,0 +1,144 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  constantine/named/algebras,
+  constantine/math/io/io_fields
+
+{.used.}
+
+# Poseidon2 Fp[Goldilocks], width 8
+# -----------------------------------------------------------------
+# Generated by sage/derive_poseidon2.sage
+
+const Goldilocks_poseidon2_Width* = 8
+const Goldilocks_poseidon2_Alpha* = 7
+const Goldilocks_poseidon2_FullRounds* = 8
+const Goldilocks_poseidon2_PartialRounds* = 22
+
+const Goldilocks_poseidon2_FullRoundConstants* = [
+  # Initial full rounds
+  [
+    Fp[Goldilocks].fromHex("0xdd5743e7f2a5a5d9"),
+    Fp[Goldilocks].fromHex("0xcb3a864e58ada44b"),
+    Fp[Goldilocks].fromHex("0xffa2449ed32f8cdc"),
+    Fp[Goldilocks].fromHex("0x42025f65d6bd13ee"),
+    Fp[Goldilocks].fromHex("0x7889175e25506323"),
+    Fp[Goldilocks].fromHex("0x34b98bb03d24b737"),
+    Fp[Goldilocks].fromHex("0xbdcc535ecc4faa2a"),
+    Fp[Goldilocks].fromHex("0x5b20ad869fc0d033"),
+  ],
+  [
+    Fp[Goldilocks].fromHex("0xf1dda5b9259dfcb4"),
+    Fp[Goldilocks].fromHex("0x27515210be112d59"),
+    Fp[Goldilocks].fromHex("0x4227d1718c766c3f"),
+    Fp[Goldilocks].fromHex("0x26d333161a5bd794"),
+    Fp[Goldilocks].fromHex("0x49b938957bf4b026"),
+    Fp[Goldilocks].fromHex("0x4a56b5938b213669"),
+    Fp[Goldilocks].fromHex("0x1120426b48c8353d"),
+    Fp[Goldilocks].fromHex("0x6b323c3f10a56cad"),
+  ],
+  [
+    Fp[Goldilocks].fromHex("0xce57d6245ddca6b2"),
+    Fp[Goldilocks].fromHex("0xb1fc8d402bba1eb1"),
+    Fp[Goldilocks].fromHex("0xb5c5096ca959bd04"),
+    Fp[Goldilocks].fromHex("0x6db55cd306d31f7f"),
+    Fp[Goldilocks].fromHex("0xc49d293a81cb9641"),
+    Fp[Goldilocks].fromHex("0x1ce55a4fe979719f"),
+    Fp[Goldilocks].fromHex("0xa92e60a9d178a4d1"),
+    Fp[Goldilocks].fromHex("0x002cc64973bcfd8c"),
+  ],
+  [
+    Fp[Goldilocks].fromHex("0xcea721cce82fb11b"),
+    Fp[Goldilocks].fromHex("0xe5b55eb8098ece81"),
+    Fp[Goldilocks].fromHex("0x4e30525c6f1ddd66"),
+    Fp[Goldilocks].fromHex("0x43c6702827070987"),
+    Fp[Goldilocks].fromHex("0xaca68430a7b5762a"),
+    Fp[Goldilocks].fromHex("0x3674238634df9c93"),
+    Fp[Goldilocks].fromHex("0x88cee1c825e33433"),
+    Fp[Goldilocks].fromHex("0xde99ae8d74b57176"),
+  ],
+  # Terminal full rounds
+  [
+    Fp[Goldilocks].fromHex("0x014ef1197d341346"),
+    Fp[Goldilocks].fromHex("0x9725e20825d07394"),
+    Fp[Goldilocks].fromHex("0xfdb25aef2c5bae3b"),
+    Fp[Goldilocks].fromHex("0xbe5402dc598c971e"),
+    Fp[Goldilocks].fromHex("0x93a5711f04cdca3d"),
+    Fp[Goldilocks].fromHex("0xc45a9a5b2f8fb97b"),
+    Fp[Goldilocks].fromHex("0xfe8946a924933545"),
+    Fp[Goldilocks].fromHex("0x2af997a27369091c"),
+  ],
+  [
+    Fp[Goldilocks].fromHex("0xaa62c88e0b294011"),
+    Fp[Goldilocks].fromHex("0x058eb9d810ce9f74"),
+    Fp[Goldilocks].fromHex("0xb3cb23eced349ae4"),
+    Fp[Goldilocks].fromHex("0xa3648177a77b4a84"),
+    Fp[Goldilocks].fromHex("0x43153d905992d95d"),
+    Fp[Goldilocks].fromHex("0xf4e2a97cda44aa4b"),
+    Fp[Goldilocks].fromHex("0x5baa2702b908682f"),
+    Fp[Goldilocks].fromHex("0x082923bdf4f750d1"),
+  ],
+  [
+    Fp[Goldilocks].fromHex("0x98ae09a325893803"),
+    Fp[Goldilocks].fromHex("0xf8a6475077968838"),
+    Fp[Goldilocks].fromHex("0xceb0735bf00b2c5f"),
+    Fp[Goldilocks].fromHex("0x0a1a5d953888e072"),
+    Fp[Goldilocks].fromHex("0x2fcb190489f94475"),
+    Fp[Goldilocks].fromHex("0xb5be06270dec69fc"),
+    Fp[Goldilocks].fromHex("0x739cb934b09acf8b"),
+    Fp[Goldilocks].fromHex("0x537750b75ec7f25b"),
+  ],
+  [
+    Fp[Goldilocks].fromHex("0xe9dd318bae1f3961"),
+    Fp[Goldilocks].fromHex("0xf7462137299efe1a"),
+    Fp[Goldilocks].fromHex("0xb1f6b8eee9adb940"),
+    Fp[Goldilocks].fromHex("0xbdebcc8a809dfe6b"),
+    Fp[Goldilocks].fromHex("0x40fc1f791b178113"),
+    Fp[Goldilocks].fromHex("0x3ac1c3362d014864"),
+    Fp[Goldilocks].fromHex("0x9a016184bdb8aeba"),
+    Fp[Goldilocks].fromHex("0x95f2394459fbc25e"),
+  ],
+]
+
+const Goldilocks_poseidon2_PartialRoundConstants* = [
+  Fp[Goldilocks].fromHex("0x488897d85ff51f56"),
+  Fp[Goldilocks].fromHex("0x1140737ccb162218"),
+  Fp[Goldilocks].fromHex("0xa7eeb9215866ed35"),
+  Fp[Goldilocks].fromHex("0x9bd2976fee49fcc9"),
+  Fp[Goldilocks].fromHex("0xc0c8f0de580a3fcc"),
+  Fp[Goldilocks].fromHex("0x4fb2dae6ee8fc793"),
+  Fp[Goldilocks].fromHex("0x343a89f35f37395b"),
+  Fp[Goldilocks].fromHex("0x223b525a77ca72c8"),
+  Fp[Goldilocks].fromHex("0x56ccb62574aaa918"),
+  Fp[Goldilocks].fromHex("0xc4d507d8027af9ed"),
+  Fp[Goldilocks].fromHex("0xa080673cf0b7e95c"),
+  Fp[Goldilocks].fromHex("0xf0184884eb70dcf8"),
+  Fp[Goldilocks].fromHex("0x044f10b0cb3d5c69"),
+  Fp[Goldilocks].fromHex("0xe9e3f7993938f186"),
+  Fp[Goldilocks].fromHex("0x1b761c80e772f459"),
+  Fp[Goldilocks].fromHex("0x606cec607a1b5fac"),
+  Fp[Goldilocks].fromHex("0x14a0c2e1d45f03cd"),
+  Fp[Goldilocks].fromHex("0x4eace8855398574f"),
+  Fp[Goldilocks].fromHex("0xf905ca7103eff3e6"),
+  Fp[Goldilocks].fromHex("0xf8c8f8d20862c059"),
+  Fp[Goldilocks].fromHex("0xb524fe8bdd678e5a"),
+  Fp[Goldilocks].fromHex("0xfbb7865901a1ec41"),
+]
+
+const Goldilocks_poseidon2_InternalDiagMinus1* = [
+  # The internal matrix is 1 + diag(InternalDiagMinus1)
+  Fp[Goldilocks].fromHex("0xa98811a1fed4e3a5"),
+  Fp[Goldilocks].fromHex("0x1cc48b54f377e2a0"),
+  Fp[Goldilocks].fromHex("0xe40cd4f6c5609a26"),
+  Fp[Goldilocks].fromHex("0x11de79ebca97a4a3"),
+  Fp[Goldilocks].fromHex("0x9177c73d8b7e929c"),
+  Fp[Goldilocks].fromHex("0x2a6fe8085797e791"),
+  Fp[Goldilocks].fromHex("0x3de6e93329f8d5ad"),
+  Fp[Goldilocks].fromHex("0x3f7af9125da962fe"),
+]
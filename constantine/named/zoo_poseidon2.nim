@@ -0,0 +1,25 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  std/macros,
+  ./algebras,
+  ./constants/bls12_381_poseidon2,
+  ./constants/bn254_snarks_poseidon2,
+  ./constants/goldilocks_poseidon2
+
+{.experimental: "dynamicBindSym".}
+
+macro poseidon2Const*(Name: static Algebra, value: untyped): untyped =
+  ## Get a Poseidon2 constant
+  ## for the Poseidon2 instance over the field `Name`
+  return bindSym($Name & "_poseidon2_" & $value)
+
+template hasPoseidon2*(Name: static Algebra): bool =
+  ## Returns true if a Poseidon2 instance is defined over the field `Name`
+  Name in {BN254_Snarks, BLS12_381, Goldilocks}
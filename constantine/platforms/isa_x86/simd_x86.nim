@@ -71,6 +71,8 @@ func mm_setr_epi32(e3, e2, e1, e0: int32 or uint32): m128i {.importc: "_mm_setr_
   ## Initialize m128i with {e3, e2, e1, e0} (big endian order)
   ## in order [e3, e2, e1, e0]
 
+func mm_and_si128(a, b: m128i): m128i {.importc: "_mm_and_si128", x86.}
+func mm_or_si128(a, b: m128i): m128i {.importc: "_mm_or_si128", x86.}
 func mm_xor_si128(a, b: m128i): m128i {.importc: "_mm_xor_si128", x86.}
 
 func mm_add_epi8(a, b: m128i): m128i {.importc: "_mm_add_epi8", x86.}
@@ -168,6 +170,106 @@ func mm_mask_add_epi32(src: m128i, mask: mmask8, a, b: m128i): m128i {.importc:
   ##   else:
   ##     dst[i+31:i] := src[i+31:i]
 
+# ############################################################
+#
+#                    AVX2 - integer - packed
+#
+# ############################################################
+
+func mm256_setzero_si256(): m256i {.importc: "_mm256_setzero_si256", x86.}
+func mm256_set1_epi32(a: int32 or uint32): m256i {.importc: "_mm256_set1_epi32", x86.}
+func mm256_set1_epi64x(a: int64 or uint64): m256i {.importc: "_mm256_set1_epi64x", x86.}
+func mm256_load_si256(mem_addr: ptr m256i): m256i {.importc: "_mm256_load_si256", x86.}
+func mm256_store_si256(mem_addr: ptr m256i, a: m256i) {.importc: "_mm256_store_si256", x86.}
+func mm256_loadu_si256(mem_addr: ptr m256i): m256i {.importc: "_mm256_loadu_si256", x86.}
+func mm256_storeu_si256(mem_addr: ptr m256i, a: m256i) {.importc: "_mm256_storeu_si256", x86.}
+func mm256_setr_epi64x(e0, e1, e2, e3: int64 or uint64): m256i {.importc: "_mm256_setr_epi64x", x86.}
+func mm256_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7: int32 or uint32): m256i {.importc: "_mm256_setr_epi32", x86.}
+
+func mm256_and_si256(a, b: m256i): m256i {.importc: "_mm256_and_si256", x86.}
+func mm256_andnot_si256(a, b: m256i): m256i {.importc: "_mm256_andnot_si256", x86.}
+  ## dst = (not a) and b
+func mm256_or_si256(a, b: m256i): m256i {.importc: "_mm256_or_si256", x86.}
+func mm256_xor_si256(a, b: m256i): m256i {.importc: "_mm256_xor_si256", x86.}
+
+func mm256_add_epi32(a, b: m256i): m256i {.importc: "_mm256_add_epi32", x86.}
+func mm256_slli_epi32(a: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_slli_epi32", x86.}
+func mm256_srli_epi32(a: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_srli_epi32", x86.}
+func mm256_slli_epi64(a: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_slli_epi64", x86.}
+func mm256_srli_epi64(a: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_srli_epi64", x86.}
+func mm256_add_epi64(a, b: m256i): m256i {.importc: "_mm256_add_epi64", x86.}
+func mm256_mul_epu32(a, b: m256i): m256i {.importc: "_mm256_mul_epu32", x86.}
+  ## Multiply the low unsigned 32-bit integers of each 64-bit lane of a and b
+  ## and store the unsigned 64-bit results in dst.
+
+func mm256_shuffle_epi8(a, b: m256i): m256i {.importc: "_mm256_shuffle_epi8", x86.}
+  ## Shuffle 8-bit integers in a within 128-bit lanes
+  ## according to shuffle control mask in the corresponding 8-bit element of b
+func mm256_shuffle_epi32(a: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_shuffle_epi32", x86.}
+  ## Shuffle 32-bit integers in a within 128-bit lanes using the control in imm8
+func mm256_permute4x64_epi64(a: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_permute4x64_epi64", x86.}
+  ## Shuffle 64-bit integers in a across lanes using the control in imm8
+func mm256_permute2x128_si256(a, b: m256i, imm8: int32 or uint32): m256i {.importc: "_mm256_permute2x128_si256", x86.}
+  ## Select 128-bit lanes from a and b using the control in imm8
+  ## imm8[1:0] selects the low lane of dst, imm8[5:4] the high lane:
+  ## 0 = a.lo, 1 = a.hi, 2 = b.lo, 3 = b.hi
+func mm256_unpacklo_epi32(a, b: m256i): m256i {.importc: "_mm256_unpacklo_epi32", x86.}
+  ## Interleave the low 32-bit integers of a and b within 128-bit lanes
+  ## dst = [a0, b0, a1, b1 | a4, b4, a5, b5]
+func mm256_unpackhi_epi32(a, b: m256i): m256i {.importc: "_mm256_unpackhi_epi32", x86.}
+  ## Interleave the high 32-bit integers of a and b within 128-bit lanes
+  ## dst = [a2, b2, a3, b3 | a6, b6, a7, b7]
+func mm256_unpacklo_epi64(a, b: m256i): m256i {.importc: "_mm256_unpacklo_epi64", x86.}
+  ## Interleave the low 64-bit integers of a and b within 128-bit lanes
+  ## dst = [a0, b0 | a2, b2]
+func mm256_unpackhi_epi64(a, b: m256i): m256i {.importc: "_mm256_unpackhi_epi64", x86.}
+  ## Interleave the high 64-bit integers of a and b within 128-bit lanes
+  ## dst = [a1, b1 | a3, b3]
+
+# ############################################################
+#
+#              AVX512F - integer - packed 512-bit
+#
+# ############################################################
+
+func mm512_setzero_si512(): m512i {.importc: "_mm512_setzero_si512", x86.}
+func mm512_set1_epi32(a: int32 or uint32): m512i {.importc: "_mm512_set1_epi32", x86.}
+func mm512_set1_epi64(a: int64 or uint64): m512i {.importc: "_mm512_set1_epi64", x86.}
+func mm512_load_si512(mem_addr: pointer): m512i {.importc: "_mm512_load_si512", x86.}
+func mm512_store_si512(mem_addr: pointer, a: m512i) {.importc: "_mm512_store_si512", x86.}
+func mm512_loadu_si512(mem_addr: pointer): m512i {.importc: "_mm512_loadu_si512", x86.}
+func mm512_storeu_si512(mem_addr: pointer, a: m512i) {.importc: "_mm512_storeu_si512", x86.}
+func mm512_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7,
+                      e8, e9, e10, e11, e12, e13, e14, e15: int32 or uint32): m512i {.importc: "_mm512_setr_epi32", x86.}
+
+func mm512_xor_si512(a, b: m512i): m512i {.importc: "_mm512_xor_si512", x86.}
+func mm512_add_epi32(a, b: m512i): m512i {.importc: "_mm512_add_epi32", x86.}
+func mm512_srli_epi32(a: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_srli_epi32", x86.}
+func mm512_ror_epi32(a: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_ror_epi32", x86.}
+  ## Rotate 16xint32 right
+func mm512_rol_epi32(a: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_rol_epi32", x86.}
+  ## Rotate 16xint32 left
+func mm512_rol_epi64(a: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_rol_epi64", x86.}
+  ## Rotate 8xint64 left
+
+func mm512_unpacklo_epi32(a, b: m512i): m512i {.importc: "_mm512_unpacklo_epi32", x86.}
+  ## Interleave the low 32-bit integers of a and b within 128-bit lanes
+func mm512_unpackhi_epi32(a, b: m512i): m512i {.importc: "_mm512_unpackhi_epi32", x86.}
+  ## Interleave the high 32-bit integers of a and b within 128-bit lanes
+func mm512_unpacklo_epi64(a, b: m512i): m512i {.importc: "_mm512_unpacklo_epi64", x86.}
+  ## Interleave the low 64-bit integers of a and b within 128-bit lanes
+func mm512_unpackhi_epi64(a, b: m512i): m512i {.importc: "_mm512_unpackhi_epi64", x86.}
+  ## Interleave the high 64-bit integers of a and b within 128-bit lanes
+func mm512_shuffle_i32x4(a, b: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_shuffle_i32x4", x86.}
+  ## Select 128-bit lanes, the 2 low lanes of dst from a, the 2 high lanes from b.
+  ## Each 2-bit field of imm8 selects the source lane:
+  ## dst = [a[imm8[1:0]], a[imm8[3:2]], b[imm8[5:4]], b[imm8[7:6]]]
+
+func mm512_ternarylogic_epi32(a, b, c: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_ternarylogic_epi32", x86.}
+  ## Bitwise ternary logic: for each bit, the bits of a, b, c
+  ## form the index (a << 2 | b << 1 | c) into the truth table imm8
+func mm512_ternarylogic_epi64(a, b, c: m512i, imm8: int32 or uint32): m512i {.importc: "_mm512_ternarylogic_epi64", x86.}
+
 # ############################################################
 #
 #                  SHA extensions
@@ -241,6 +343,8 @@ func mm_sha256rnds2_epu32(cdgh, abef, k: m128i): m128i {.importc: "_mm_sha256rnd
 
 template set_u64x2*(e1, e0: int64 or uint64): m128i =
   mm_set_epi64x(e1, e0)
+template set1_u32x4*(a: int32 or uint32): m128i =
+  mm_set1_epi32(a)
 template setr_u32x4*(e3, e2, e1, e0: int32 or uint32): m128i =
   mm_setr_epi32(e3, e2, e1, e0)
 template loada_u128*(data: pointer): m128i =
@@ -250,6 +354,10 @@ template loadu_u128*(data: pointer): m128i =
 template storea_u128*(mem_addr: pointer, a: m128i) =
   mm_store_si128(cast[ptr m128i](mem_addr), a)
 
+template and_u128*(a, b: m128i): m128i =
+  mm_and_si128(a, b)
+template or_u128*(a, b: m128i): m128i =
+  mm_or_si128(a, b)
 template xor_u128*(a, b: m128i): m128i =
   mm_xor_si128(a, b)
 
@@ -276,4 +384,110 @@ template sha256_msg1*(a, b: m128i): m128i =
 template sha256_msg2*(a, b: m128i): m128i =
   mm_sha256msg2_epu32(a, b)
 template sha256_2rounds*(cdgh, abef, k: m128i): m128i =
-  mm_sha256rnds2_epu32(cdgh, abef, k)
\ No newline at end of file
+  mm_sha256rnds2_epu32(cdgh, abef, k)
+
+template setzero_u256*(): m256i =
+  mm256_setzero_si256()
+template set1_u32x8*(a: int32 or uint32): m256i =
+  mm256_set1_epi32(a)
+template set1_u64x4*(a: int64 or uint64): m256i =
+  mm256_set1_epi64x(a)
+template loada_u256*(data: pointer): m256i =
+  mm256_load_si256(cast[ptr m256i](data))
+template storea_u256*(mem_addr: pointer, a: m256i) =
+  mm256_store_si256(cast[ptr m256i](mem_addr), a)
+template loadu_u256*(data: pointer): m256i =
+  mm256_loadu_si256(cast[ptr m256i](data))
+template storeu_u256*(mem_addr: pointer, a: m256i) =
+  mm256_storeu_si256(cast[ptr m256i](mem_addr), a)
+template setr_u64x4*(e0, e1, e2, e3: int64 or uint64): m256i =
+  mm256_setr_epi64x(e0, e1, e2, e3)
+template setr_u32x8*(e0, e1, e2, e3, e4, e5, e6, e7: int32 or uint32): m256i =
+  mm256_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7)
+
+template and_u256*(a, b: m256i): m256i =
+  mm256_and_si256(a, b)
+template andnot_u256*(a, b: m256i): m256i =
+  mm256_andnot_si256(a, b)
+template or_u256*(a, b: m256i): m256i =
+  mm256_or_si256(a, b)
+template xor_u256*(a, b: m256i): m256i =
+  mm256_xor_si256(a, b)
+
+template add_u32x8*(a, b: m256i): m256i =
+  mm256_add_epi32(a, b)
+template shl_u32x8*(a: m256i, imm8: int32 or uint32): m256i =
+  mm256_slli_epi32(a, imm8)
+template shr_u32x8*(a: m256i, imm8: int32 or uint32): m256i =
+  mm256_srli_epi32(a, imm8)
+template shl_u64x4*(a: m256i, imm8: int32 or uint32): m256i =
+  mm256_slli_epi64(a, imm8)
+template shr_u64x4*(a: m256i, imm8: int32 or uint32): m256i =
+  mm256_srli_epi64(a, imm8)
+template add_u64x4*(a, b: m256i): m256i =
+  mm256_add_epi64(a, b)
+template mul_u32_u64x4*(a, b: m256i): m256i =
+  ## 32x32 -> 64-bit multiplication of the low half of each 64-bit lane
+  mm256_mul_epu32(a, b)
+template shuf_u8x32*(a, mask: m256i): m256i =
+  mm256_shuffle_epi8(a, mask)
+template shuf_u32x8*(a: m256i, imm8: int32 or uint32): m256i =
+  mm256_shuffle_epi32(a, imm8)
+template permute_u64x4*(a: m256i, imm8: int32 or uint32): m256i =
+  mm256_permute4x64_epi64(a, imm8)
+template permute2x128_u256*(a, b: m256i, imm8: int32 or uint32): m256i =
+  mm256_permute2x128_si256(a, b, imm8)
+template unpacklo_u32x8*(a, b: m256i): m256i =
+  mm256_unpacklo_epi32(a, b)
+template unpackhi_u32x8*(a, b: m256i): m256i =
+  mm256_unpackhi_epi32(a, b)
+template unpacklo_u64x4*(a, b: m256i): m256i =
+  mm256_unpacklo_epi64(a, b)
+template unpackhi_u64x4*(a, b: m256i): m256i =
+  mm256_unpackhi_epi64(a, b)
+
+template setzero_u512*(): m512i =
+  mm512_setzero_si512()
+template set1_u32x16*(a: int32 or uint32): m512i =
+  mm512_set1_epi32(a)
+template set1_u64x8*(a: int64 or uint64): m512i =
+  mm512_set1_epi64(a)
+template loada_u512*(data: pointer): m512i =
+  mm512_load_si512(data)
+template storea_u512*(mem_addr: pointer, a: m512i) =
+  mm512_store_si512(mem_addr, a)
+template loadu_u512*(data: pointer): m512i =
+  mm512_loadu_si512(data)
+template storeu_u512*(mem_addr: pointer, a: m512i) =
+  mm512_storeu_si512(mem_addr, a)
+template setr_u32x16*(e0, e1, e2, e3, e4, e5, e6, e7,
+                      e8, e9, e10, e11, e12, e13, e14, e15: int32 or uint32): m512i =
+  mm512_setr_epi32(e0, e1, e2, e3, e4, e5, e6, e7,
+                   e8, e9, e10, e11, e12, e13, e14, e15)
+
+template xor_u512*(a, b: m512i): m512i =
+  mm512_xor_si512(a, b)
+template add_u32x16*(a, b: m512i): m512i =
+  mm512_add_epi32(a, b)
+template shr_u32x16*(a: m512i, imm8: int32 or uint32): m512i =
+  mm512_srli_epi32(a, imm8)
+template ror_u32x16*(a: m512i, imm8: int32 or uint32): m512i =
+  mm512_ror_epi32(a, imm8)
+template rotl_u32x16*(a: m512i, imm8: int32 or uint32): m512i =
+  mm512_rol_epi32(a, imm8)
+template ternlog_u32x16*(a, b, c: m512i, imm8: int32 or uint32): m512i =
+  mm512_ternarylogic_epi32(a, b, c, imm8)
+template rotl_u64x8*(a: m512i, imm8: int32 or uint32): m512i =
+  mm512_rol_epi64(a, imm8)
+template ternlog_u64x8*(a, b, c: m512i, imm8: int32 or uint32): m512i =
+  mm512_ternarylogic_epi64(a, b, c, imm8)
+template unpacklo_u32x16*(a, b: m512i): m512i =
+  mm512_unpacklo_epi32(a, b)
+template unpackhi_u32x16*(a, b: m512i): m512i =
+  mm512_unpackhi_epi32(a, b)
+template unpacklo_u64x8*(a, b: m512i): m512i =
+  mm512_unpacklo_epi64(a, b)
+template unpackhi_u64x8*(a, b: m512i): m512i =
+  mm512_unpackhi_epi64(a, b)
+template shuf_u128x4*(a, b: m512i, imm8: int32 or uint32): m512i =
+  mm512_shuffle_i32x4(a, b, imm8)
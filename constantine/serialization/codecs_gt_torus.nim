@@ -0,0 +1,512 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+## ############################################################
+##
+##            𝔾ₜ Serialization via Torus Compression
+##
+## ############################################################
+##
+## 𝔾ₜ elements of BN and BLS12 curves live in 𝔽p12 and take 12 𝔽p coordinates,
+## i.e. 576 bytes for BLS12-381 and 384 bytes for BN254.
+##
+## As 𝔾ₜ is a subgroup of the algebraic tori T2(𝔽p6) and T6(𝔽p2)
+## elements can be compressed.
+##
+## T2 compression
+## ~~~~~~~~~~~~~~
+##
+## With the quadratic-over-cubic towering 𝔽p12 = 𝔽p6[w]/(w² - v), 𝔽p6 = 𝔽p2[v]/(v³ - ξ)
+## an element α = a + bw of the cyclotomic subgroup has norm a² - b²v = 1
+## and is represented by x = -(a+1)/b ∈ 𝔽p6 (see `gt_prj.nim`).
+## Decompression is
+##   α = (x - w)/(x + w) = (x² + v)/(x² - v) - 2x/(x² - v) w
+## which costs one 𝔽p6 inversion, x² - v is never 0 as v is not a square in 𝔽p6.
+##
+## Encoding: 6 𝔽p coordinates, 288 bytes for BLS12-381 and 192 bytes for BN254.
+##
+## Compression by a factor 3
+## ~~~~~~~~~~~~~~~~~~~~~~~~~
+##
+## 𝔾ₜ has order dividing Φ₁₂(p) = p⁴ - p² + 1 which is a strict divisor of p⁶ + 1,
+## the order of T2(𝔽p6). The extra structure translates to a quadratic relation
+## on x = x₀ + x₁v + x₂v²:
+##
+##   3x₀x₁ - 3ξx₂² - 1 = 0
+##
+## so x₀ = (1 + 3ξx₂²)/(3x₁) can be recovered from (x₁, x₂),
+## at the cost of one 𝔽p2 inversion.
+## In the (negligible) case x₁ = 0, (x₀, x₂) are stored instead and flagged.
+##
+## - On Compressible Pairings and Their Computation
+##   Naehrig, Barreto, Schwabe, 2007
+##   https://eprint.iacr.org/2007/429
+##
+## Encoding: 4 𝔽p coordinates, 192 bytes for BLS12-381 and 128 bytes for BN254.
+##
+## Format
+## ~~~~~~
+##
+## 𝔽p elements are encoded in big-endian.
+## 𝔽p2 elements c₀ + c₁u are encoded c₁ then c₀, like the Zcash BLS12-381 format.
+## 𝔽p6 elements x₀ + x₁v + x₂v² are encoded x₂, x₁ then x₀.
+## The factor 3 compression encodes x₂ then x₁ (or x₀).
+##
+## The most significant bits of the first byte are flags,
+## BN254 and BLS12-381 moduli leave at least 2 free bits.
+## - bit 7: the element is the neutral element 1, all other bits must be 0.
+## - bit 6: factor 3 compression only, the second stored coordinate is x₀ and x₁ = 0.
+
+import
+    constantine/platforms/abstractions,
+    constantine/named/algebras,
+    constantine/named/zoo_pairings,
+    constantine/math/[arithmetic, extension_fields],
+    constantine/math/io/[io_bigints, io_fields],
+    constantine/math/pairings/[cyclotomic_subgroups, gt_prj],
+    ./codecs_status_codes
+
+export CttCodecGtStatus
+
+# No exceptions allowed
+{.push raises: [], checks: off.}
+
+const
+  gtFlagNeutral = byte 0b10000000
+  gtFlagX0 = byte 0b01000000
+  gtFlagsMask = byte 0b11000000
+
+template fpBytes(Name: static Algebra): int =
+  Fp[Name].bits().ceilDiv_vartime(8)
+
+func gtTorus2Size*(Name: static Algebra): int {.inline.} =
+  ## Size in bytes of a T2-compressed 𝔾ₜ element
+  6 * fpBytes(Name)
+
+func gtCompressedSize*(Name: static Algebra): int {.inline.} =
+  ## Size in bytes of a factor 3-compressed 𝔾ₜ element
+  4 * fpBytes(Name)
+
+# Coordinates
+# ------------------------------------------------------------------------------------------------
+
+func marshalFp2[Name: static Algebra](dst: var openArray[byte], offset: int, a: Fp2[Name]) =
+  const L = fpBytes(Name)
+  dst.toOpenArray(offset, offset+L-1).marshal(a.c1, bigEndian)
+  dst.toOpenArray(offset+L, offset+2*L-1).marshal(a.c0, bigEndian)
+
+func unmarshalFp[Name: static Algebra](dst: var Fp[Name], src: openArray[byte], offset: int, maskFlags: bool): CttCodecGtStatus =
+  const L = fpBytes(Name)
+  var t {.noInit.}: Fp[Name].getBigInt()
+  t.unmarshal(src.toOpenArray(offset, offset+L-1), bigEndian)
+  if maskFlags:
+    # The flags are in the most significant byte
+    t.limbs[t.limbs.len-1] = t.limbs[t.limbs.len-1] and (MaxWord shr 2)
+  if bool(t >= Fp[Name].getModulus()):
+    return cttCodecGt_CoordinateGreaterThanOrEqualModulus
+  dst.fromBig(t)
+  return cttCodecGt_Success
+
+func unmarshalFp2[Name: static Algebra](dst: var Fp2[Name], src: openArray[byte], offset: int, maskFlags: bool): CttCodecGtStatus =
+  const L = fpBytes(Name)
+  result = dst.c1.unmarshalFp(src, offset, maskFlags)
+  if result != cttCodecGt_Success:
+    return
+  result = dst.c0.unmarshalFp(src, offset+L, maskFlags = false)
+
+func checkNeutralEncoding(src: openArray[byte]): CttCodecGtStatus =
+  ## The neutral element is encoded with only the neutral flag set
+  if (src[0] and not gtFlagNeutral) != 0:
+    return cttCodecGt_InvalidEncoding
+  for i in 1 ..< src.len:
+    if src[i] != byte 0:
+      return cttCodecGt_InvalidEncoding
+  return cttCodecGt_Success
+
+func setNeutralEncoding(dst: var openArray[byte]) =
+  for i in 0 ..< dst.len:
+    dst[i] = byte 0
+  dst[0] = gtFlagNeutral
+
+# Torus maps
+# ------------------------------------------------------------------------------------------------
+
+func toTorus2[Name: static Algebra](x: var Fp6[Name], a: Fp12[Name]) =
+  ## x = -(a+1)/b for a 𝔾ₜ element a + bw
+  ## a must not be the neutral element
+  var g {.noInit.}: QuadraticExt[Fp6[Name]]
+  var t {.noInit.}, one {.noInit.}: Fp6[Name]
+  g.toQuadOverCube(a)
+  t.inv(g.c1)
+  one.setOne()
+  x.sum(g.c0, one)
+  x.neg()
+  x *= t
+
+func torus2Denominator[Name: static Algebra](den: var Fp6[Name], x: Fp6[Name]) =
+  ## x² - v
+  var one {.noInit.}: Fp2[Name]
+  one.setOne()
+  den.square(x)
+  den.c1 -= one
+
+func fromTorus2[Name: static Algebra](r: var Fp12[Name], x, denInv: Fp6[Name]) =
+  ## α = (x² + v)/(x² - v) - 2x/(x² - v) w
+  ## with denInv = 1/(x² - v)
+  var g {.noInit.}: QuadraticExt[Fp6[Name]]
+  var one {.noInit.}: Fp2[Name]
+  one.setOne()
+  g.c0.square(x)
+  g.c0.c1 += one
+  g.c0 *= denInv
+  g.c1.double(x)
+  g.c1.neg()
+  g.c1 *= denInv
+  r.fromQuadOverCube(g)
+
+func recoverX0Numerator[Name: static Algebra](num: var Fp2[Name], x2: Fp2[Name]) =
+  ## 1 + 3ξx₂²
+  var one {.noInit.}: Fp2[Name]
+  one.setOne()
+  num.square(x2)
+  num *= NonResidue
+  num *= 3
+  num += one
+
+# Validation
+# ------------------------------------------------------------------------------------------------
+
+func validate_gt*[Name: static Algebra](a: Fp12[Name]): CttCodecGtStatus =
+  ## Validate a 𝔾ₜ element
+  ## This is an expensive operation that can be cached
+  if not a.isInCyclotomicSubgroup().bool():
+    return cttCodecGt_NotInCyclotomicSubgroup
+  if not a.isInPairingSubgroup().bool():
+    return cttCodecGt_NotInPairingSubgroup
+  return cttCodecGt_Success
+
+# T2 codecs
+# ------------------------------------------------------------------------------------------------
+
+func serialize_gt_torus2*[Name: static Algebra](dst: var openArray[byte], a: Fp12[Name]): CttCodecGtStatus {.discardable.} =
+  ## Serialize a 𝔾ₜ element in T2 torus form.
+  ## `dst` must be of size `gtTorus2Size(Name)`
+  ##
+  ## `a` MUST be in 𝔾ₜ, for example a pairing output.
+  ##
+  ## Returns cttCodecGt_Success if successful
+  if dst.len != gtTorus2Size(Name):
+    return cttCodecGt_InvalidEncoding
+  if a.isOne().bool():
+    dst.setNeutralEncoding()
+    return cttCodecGt_Success
+
+  const L = fpBytes(Name)
+  var x {.noInit.}: Fp6[Name]
+  x.toTorus2(a)
+  dst.marshalFp2(0, x.c2)
+  dst.marshalFp2(2*L, x.c1)
+  dst.marshalFp2(4*L, x.c0)
+  return cttCodecGt_Success
+
+func parse_gt_torus2[Name: static Algebra](x: var Fp6[Name], isNeutral: var bool, src: openArray[byte]): CttCodecGtStatus =
+  if src.len != gtTorus2Size(Name):
+    return cttCodecGt_InvalidEncoding
+  if (src[0] and gtFlagNeutral) != 0:
+    isNeutral = true
+    return checkNeutralEncoding(src)
+  if (src[0] and gtFlagsMask) != 0:
+    return cttCodecGt_InvalidEncoding
+
+  const L = fpBytes(Name)
+  isNeutral = false
+  result = x.c2.unmarshalFp2(src, 0, maskFlags = true)
+  if result != cttCodecGt_Success:
+    return
+  result = x.c1.unmarshalFp2(src, 2*L, maskFlags = false)
+  if result != cttCodecGt_Success:
+    return
+  result = x.c0.unmarshalFp2(src, 4*L, maskFlags = false)
+
+func deserialize_gt_torus2_unchecked*[Name: static Algebra](dst: var Fp12[Name], src: openArray[byte]): CttCodecGtStatus =
+  ## Deserialize a 𝔾ₜ element in T2 torus form.
+  ##
+  ## Warning ⚠:
+  ##   This procedure skips the very expensive subgroup checks.
+  ##   Not checking subgroup exposes a protocol to small subgroup attacks.
+  ##
+  ## Returns cttCodecGt_Success if successful
+  var x {.noInit.}, den {.noInit.}: Fp6[Name]
+  var isNeutral: bool
+  result = x.parse_gt_torus2(isNeutral, src)
+  if result != cttCodecGt_Success:
+    return
+  if isNeutral:
+    dst.setOne()
+    return
+
+  den.torus2Denominator(x)
+  den.inv_vartime()
+  dst.fromTorus2(x, den)
+
+func deserialize_gt_torus2*[Name: static Algebra](dst: var Fp12[Name], src: openArray[byte]): CttCodecGtStatus =
+  ## Deserialize a 𝔾ₜ element in T2 torus form.
+  ##
+  ## Returns cttCodecGt_Success if successful
+  result = dst.deserialize_gt_torus2_unchecked(src)
+  if result != cttCodecGt_Success:
+    return
+  return dst.validate_gt()
+
+# Factor 3 compression codecs
+# ------------------------------------------------------------------------------------------------
+
+func serialize_gt_compressed*[Name: static Algebra](dst: var openArray[byte], a: Fp12[Name]): CttCodecGtStatus {.discardable.} =
+  ## Serialize a 𝔾ₜ element in factor 3 compressed form.
+  ## `dst` must be of size `gtCompressedSize(Name)`
+  ##
+  ## `a` MUST be in 𝔾ₜ, for example a pairing output.
+  ##
+  ## Returns cttCodecGt_Success if successful
+  if dst.len != gtCompressedSize(Name):
+    return cttCodecGt_InvalidEncoding
+  if a.isOne().bool():
+    dst.setNeutralEncoding()
+    return cttCodecGt_Success
+
+  const L = fpBytes(Name)
+  var x {.noInit.}: Fp6[Name]
+  x.toTorus2(a)
+  dst.marshalFp2(0, x.c2)
+  if x.c1.isZero().bool():
+    dst.marshalFp2(2*L, x.c0)
+    dst[0] = dst[0] or gtFlagX0
+  else:
+    dst.marshalFp2(2*L, x.c1)
+  return cttCodecGt_Success
+
+func parse_gt_compressed[Name: static Algebra](
+       x: var Fp6[Name], isNeutral, needsX0: var bool,
+       src: openArray[byte]): CttCodecGtStatus =
+  ## Parse the compressed coordinates.
+  ## If `needsX0`, x₀ must be recovered from x₁ and x₂
+  if src.len != gtCompressedSize(Name):
+    return cttCodecGt_InvalidEncoding
+  if (src[0] and gtFlagNeutral) != 0:
+    isNeutral = true
+    return checkNeutralEncoding(src)
+
+  const L = fpBytes(Name)
+  isNeutral = false
+  result = x.c2.unmarshalFp2(src, 0, maskFlags = true)
+  if result != cttCodecGt_Success:
+    return
+
+  if (src[0] and gtFlagX0) != 0:
+    needsX0 = false
+    x.c1.setZero()
+    result = x.c0.unmarshalFp2(src, 2*L, maskFlags = false)
+    if result == cttCodecGt_Success and x.c0.isZero().bool() and x.c2.isZero().bool():
+      # x = 0 maps to -1 which is not in 𝔾ₜ
+      # and must not be confused with the neutral encoding
+      return cttCodecGt_InvalidEncoding
+  else:
+    needsX0 = true
+    result = x.c1.unmarshalFp2(src, 2*L, maskFlags = false)
+    if result == cttCodecGt_Success and x.c1.isZero().bool():
+      # x₁ = 0 must be flagged
+      return cttCodecGt_InvalidEncoding
+
+func deserialize_gt_compressed_unchecked*[Name: static Algebra](dst: var Fp12[Name], src: openArray[byte]): CttCodecGtStatus =
+  ## Deserialize a 𝔾ₜ element in factor 3 compressed form.
+  ##
+  ## Warning ⚠:
+  ##   This procedure skips the very expensive subgroup checks.
+  ##   Not checking subgroup exposes a protocol to small subgroup attacks.
+  ##
+  ## Returns cttCodecGt_Success if successful
+  var x {.noInit.}, den {.noInit.}: Fp6[Name]
+  var isNeutral, needsX0: bool
+  result = x.parse_gt_compressed(isNeutral, needsX0, src)
+  if result != cttCodecGt_Success:
+    return
+  if isNeutral:
+    dst.setOne()
+    return
+
+  if needsX0:
+    var t {.noInit.}: Fp2[Name]
+    t.prod(x.c1, 3)
+    t.inv_vartime()
+    x.c0.recoverX0Numerator(x.c2)
+    x.c0 *= t
+
+  den.torus2Denominator(x)
+  den.inv_vartime()
+  dst.fromTorus2(x, den)
+
+func deserialize_gt_compressed*[Name: static Algebra](dst: var Fp12[Name], src: openArray[byte]): CttCodecGtStatus =
+  ## Deserialize a 𝔾ₜ element in factor 3 compressed form.
+  ##
+  ## Returns cttCodecGt_Success if successful
+  result = dst.deserialize_gt_compressed_unchecked(src)
+  if result != cttCodecGt_Success:
+    return
+  return dst.validate_gt()
+
+# Batch decompression
+# ------------------------------------------------------------------------------------------------
+#
+# Decompression is dominated by the inversions,
+# with Montgomery's batch inversion trick, n decompressions
+# cost a single 𝔽p6 inversion (and a single 𝔽p2 inversion for factor 3 compression)
+# and 3(n-1) multiplications.
+
+func deserialize_gt_torus2_batch_unchecked*[Name: static Algebra](
+       dst: var openArray[Fp12[Name]],
+       src: openArray[byte]): CttCodecGtStatus {.tags:[HeapAlloc, VarTime].} =
+  ## Deserialize `dst.len` 𝔾ₜ elements in T2 torus form
+  ## concatenated in `src`.
+  ##
+  ## Warning ⚠:
+  ##   This procedure skips the very expensive subgroup checks.
+  ##   Not checking subgroup exposes a protocol to small subgroup attacks.
+  ##
+  ## Returns cttCodecGt_Success if all elements were successfully deserialized
+  ## or the first error otherwise.
+  let n = dst.len
+  const size = gtTorus2Size(Name)
+  if src.len != n * size:
+    return cttCodecGt_InvalidEncoding
+  if n == 0:
+    return cttCodecGt_Success
+
+  let xs = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let dens = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let densInv = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let neutrals = allocHeapArray(bool, n)
+
+  result = cttCodecGt_Success
+  for i in 0 ..< n:
+    result = xs[i].parse_gt_torus2(neutrals[i], src.toOpenArray(i*size, (i+1)*size-1))
+    if result != cttCodecGt_Success:
+      break
+    if neutrals[i]:
+      dens[i].setZero() # Skipped by batch inversion
+    else:
+      dens[i].torus2Denominator(xs[i])
+
+  if result == cttCodecGt_Success:
+    densInv.batchInv_vartime(dens, n)
+    for i in 0 ..< n:
+      if neutrals[i]:
+        dst[i].setOne()
+      else:
+        dst[i].fromTorus2(xs[i], densInv[i])
+
+  freeHeap(neutrals)
+  freeHeapAligned(densInv)
+  freeHeapAligned(dens)
+  freeHeapAligned(xs)
+
+func deserialize_gt_compressed_batch_unchecked*[Name: static Algebra](
+       dst: var openArray[Fp12[Name]],
+       src: openArray[byte]): CttCodecGtStatus {.tags:[HeapAlloc, VarTime].} =
+  ## Deserialize `dst.len` 𝔾ₜ elements in factor 3 compressed form
+  ## concatenated in `src`.
+  ##
+  ## Warning ⚠:
+  ##   This procedure skips the very expensive subgroup checks.
+  ##   Not checking subgroup exposes a protocol to small subgroup attacks.
+  ##
+  ## Returns cttCodecGt_Success if all elements were successfully deserialized
+  ## or the first error otherwise.
+  let n = dst.len
+  const size = gtCompressedSize(Name)
+  if src.len != n * size:
+    return cttCodecGt_InvalidEncoding
+  if n == 0:
+    return cttCodecGt_Success
+
+  let xs = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let dens = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let densInv = allocHeapArrayAligned(Fp6[Name], n, alignment = 64)
+  let x1s = allocHeapArrayAligned(Fp2[Name], n, alignment = 64)
+  let x1sInv = allocHeapArrayAligned(Fp2[Name], n, alignment = 64)
+  let neutrals = allocHeapArray(bool, n)
+  let needsX0 = allocHeapArray(bool, n)
+
+  result = cttCodecGt_Success
+  for i in 0 ..< n:
+    result = xs[i].parse_gt_compressed(neutrals[i], needsX0[i], src.toOpenArray(i*size, (i+1)*size-1))
+    if result != cttCodecGt_Success:
+      break
+    if not neutrals[i] and needsX0[i]:
+      x1s[i].prod(xs[i].c1, 3)
+    else:
+      x1s[i].setZero()  # Skipped by batch inversion
+
+  if result == cttCodecGt_Success:
+    # x₀ = (1 + 3ξx₂²)/(3x₁)
+    x1sInv.batchInv_vartime(x1s, n)
+    for i in 0 ..< n:
+      if not neutrals[i] and needsX0[i]:
+        xs[i].c0.recoverX0Numerator(xs[i].c2)
+        xs[i].c0 *= x1sInv[i]
+
+    for i in 0 ..< n:
+      if neutrals[i]:
+        dens[i].setZero() # Skipped by batch inversion
+      else:
+        dens[i].torus2Denominator(xs[i])
+    densInv.batchInv_vartime(dens, n)
+    for i in 0 ..< n:
+      if neutrals[i]:
+        dst[i].setOne()
+      else:
+        dst[i].fromTorus2(xs[i], densInv[i])
+
+  freeHeap(needsX0)
+  freeHeap(neutrals)
+  freeHeapAligned(x1sInv)
+  freeHeapAligned(x1s)
+  freeHeapAligned(densInv)
+  freeHeapAligned(dens)
+  freeHeapAligned(xs)
+
+func deserialize_gt_torus2_batch*[Name: static Algebra](
+       dst: var openArray[Fp12[Name]],
+       src: openArray[byte]): CttCodecGtStatus {.tags:[HeapAlloc, VarTime].} =
+  ## Deserialize `dst.len` 𝔾ₜ elements in T2 torus form
+  ## concatenated in `src`.
+  ##
+  ## Returns cttCodecGt_Success if all elements were successfully deserialized
+  ## or the first error otherwise.
+  result = dst.deserialize_gt_torus2_batch_unchecked(src)
+  if result != cttCodecGt_Success:
+    return
+  for i in 0 ..< dst.len:
+    result = dst[i].validate_gt()
+    if result != cttCodecGt_Success:
+      return
+
+func deserialize_gt_compressed_batch*[Name: static Algebra](
+       dst: var openArray[Fp12[Name]],
+       src: openArray[byte]): CttCodecGtStatus {.tags:[HeapAlloc, VarTime].} =
+  ## Deserialize `dst.len` 𝔾ₜ elements in factor 3 compressed form
+  ## concatenated in `src`.
+  ##
+  ## Returns cttCodecGt_Success if all elements were successfully deserialized
+  ## or the first error otherwise.
+  result = dst.deserialize_gt_compressed_batch_unchecked(src)
+  if result != cttCodecGt_Success:
+    return
+  for i in 0 ..< dst.len:
+    result = dst[i].validate_gt()
+    if result != cttCodecGt_Success:
+      return
@@ -18,4 +18,11 @@ type
     cttCodecEcc_CoordinateGreaterThanOrEqualModulus
     cttCodecEcc_PointNotOnCurve
     cttCodecEcc_PointNotInSubgroup
-    cttCodecEcc_PointAtInfinity
\ No newline at end of file
+    cttCodecEcc_PointAtInfinity
+
+  CttCodecGtStatus* = enum
+    cttCodecGt_Success
+    cttCodecGt_InvalidEncoding
+    cttCodecGt_CoordinateGreaterThanOrEqualModulus
+    cttCodecGt_NotInCyclotomicSubgroup
+    cttCodecGt_NotInPairingSubgroup
@@ -22,6 +22,7 @@ void        ctt_bls12_381_g1_jac_multi_scalar_mul_big_coefs_vartime_parallel(con
 void        ctt_bls12_381_g1_jac_multi_scalar_mul_fr_coefs_vartime_parallel(const ctt_threadpool* tp, bls12_381_g1_jac* r, const bls12_381_fr coefs[], const bls12_381_g1_aff points[], size_t len);
 void        ctt_bls12_381_g1_prj_multi_scalar_mul_big_coefs_vartime_parallel(const ctt_threadpool* tp, bls12_381_g1_prj* r, const big255 coefs[], const bls12_381_g1_aff points[], size_t len);
 void        ctt_bls12_381_g1_prj_multi_scalar_mul_fr_coefs_vartime_parallel(const ctt_threadpool* tp, bls12_381_g1_prj* r, const bls12_381_fr coefs[], const bls12_381_g1_aff points[], size_t len);
+ctt_bool    ctt_bls12_381_pairing_check_parallel(const ctt_threadpool* tp, const bls12_381_g1_aff Ps[], const bls12_381_g2_aff Qs[], size_t len) __attribute__((warn_unused_result));
 
 #ifdef __cplusplus
 }
@@ -62,6 +62,27 @@ void ctt_keccak256_clear(ctt_keccak256_context* ctx);
  */
 void ctt_keccak256_hash(byte digest[32], const byte* message, size_t message_len, ctt_bool clear_memory);
 
+/** Compute the Keccak256 hash of `num_messages` independent messages
+ *  of the same length `message_len`, stored contiguously in `messages`
+ *  and store the results in digests.
+ *
+ *  digests[i] = Keccak256(messages[i*message_len ..< (i+1)*message_len])
+ *
+ *  Messages are hashed in parallel with one SIMD lane per message
+ *  if the CPU supports AVX2 (4 lanes) or AVX512 (8 lanes).
+ */
+void ctt_keccak256_hash_many(byte digests[][32], const byte* messages, size_t message_len, size_t num_messages);
+
+/** Compute the Keccak256 hash of `num_messages` independent messages
+ *  of variable lengths and store the results in digests.
+ *
+ *  digests[i] = Keccak256(messages[i][0 ..< message_lens[i]])
+ *
+ *  Messages are hashed in groups of 4 or 8 for as many blocks as the longest message
+ *  of the group. Grouping messages of similar lengths maximizes throughput.
+ */
+void ctt_keccak256_hash_many_varlen(byte digests[][32], const byte* const* messages, const size_t* message_lens, size_t num_messages);
+
 #ifdef __cplusplus
 }
 #endif
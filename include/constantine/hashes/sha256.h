@@ -66,6 +66,17 @@ void ctt_sha256_clear(ctt_sha256_context* ctx);
  */
 void ctt_sha256_hash(byte digest[32], const byte* message, size_t message_len, ctt_bool clear_memory);
 
+/** Compute the SHA-256 hash of `num_messages` independent messages
+ *  of the same length `message_len`, stored contiguously in `messages`
+ *  and store the results in digests.
+ *
+ *  digests[i] = SHA-256(messages[i*message_len ..< (i+1)*message_len])
+ *
+ *  On CPUs without SHA extensions, messages are hashed in parallel
+ *  with one SIMD lane per message (SSE2, AVX2 or AVX512).
+ */
+void ctt_sha256_hash_many(byte digests[][32], const byte* messages, size_t message_len, size_t num_messages);
+
 #ifdef __cplusplus
 }
 #endif
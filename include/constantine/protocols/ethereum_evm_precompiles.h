@@ -24,6 +24,8 @@ typedef enum __attribute__((__packed__)) {
     cttEVM_PointNotOnCurve,
     cttEVM_PointNotInSubgroup,
     cttEVM_VerificationFailure,
+    cttEVM_MalformedSignature,
+    cttEVM_InvalidFinalFlag,
 } ctt_evm_status;
 
 static const char* ctt_evm_status_to_string(ctt_evm_status status) {
@@ -35,6 +37,8 @@ static const char* ctt_evm_status_to_string(ctt_evm_status status) {
       "cttEVM_PointNotOnCurve",
       "cttEVM_PointNotInSubgroup",
       "cttEVM_VerificationFailure",
+      "cttEVM_MalformedSignature",
+      "cttEVM_InvalidFinalFlag",
   };
   size_t length = sizeof statuses / sizeof *statuses;
   if (0 <= status && status < length) {
@@ -83,6 +87,37 @@ ctt_evm_status ctt_eth_evm_ripemd160(
     const byte* inputs, size_t inputs_len
     ) __attribute__((warn_unused_result));
 
+/**
+ *  BLAKE2b compression function F
+ *
+ *  Name: BLAKE2F
+ *
+ *  Inputs:
+ *  - r: array with 64 bytes of storage for the result
+ *  - r_len: length of `r`. Must be 64
+ *  - inputs: rounds | h | m | t | f |
+ *  - inputs_len: length of the inputs array. Must be 213
+ *    - 4 bytes, the number of rounds, a 32-bit unsigned big-endian integer
+ *    - 64 bytes, the state vector h, 8 64-bit unsigned little-endian integers
+ *    - 128 bytes, the message block m, 16 64-bit unsigned little-endian integers
+ *    - 16 bytes, the offset counter t, 2 64-bit unsigned little-endian integers
+ *    - 1 byte, the final block indicator flag f, 0 or 1
+ *
+ *  Output:
+ *  - 64-byte updated state vector h
+ *  - status code:
+ *    cttEVM_Success
+ *    cttEVM_InvalidInputSize
+ *    cttEVM_InvalidOutputSize
+ *    cttEVM_InvalidFinalFlag
+ *
+ *  Spec https://eips.ethereum.org/EIPS/eip-152
+ */
+ctt_evm_status ctt_eth_evm_blake2f(
+    byte* r, size_t r_len,
+    const byte* inputs, size_t inputs_len
+    ) __attribute__((warn_unused_result));
+
 /**
  *  Helper for `eth_evm_modexp`. Returns the size required to be allocated based on the
  *  given input. Call this function first, then allocate space for the result buffer
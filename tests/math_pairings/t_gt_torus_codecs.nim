@@ -0,0 +1,171 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Standard library
+  std/[unittest, times],
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/math/[arithmetic, extension_fields, ec_shortweierstrass],
+  constantine/math/io/io_extfields,
+  constantine/named/algebras,
+  constantine/math/pairings/pairings_generic,
+  constantine/serialization/codecs_gt_torus,
+  # Test utilities
+  helpers/prng_unsafe
+
+# Random seed for reproducibility
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "𝔾ₜ torus codecs", " xoshiro512** seed: ", seed
+
+const Iters = 8
+const BatchSize = 17
+
+proc random_gt(rng: var RngState, Name: static Algebra): Fp12[Name] {.noInit.} =
+  let P = rng.random_unsafe(EC_ShortW_Aff[Fp[Name], G1])
+  let Q = rng.random_unsafe(EC_ShortW_Aff[Fp2[Name], G2])
+  result.pairing(P, Q)
+
+suite "𝔾ₜ serialization with torus compression":
+  test "T₂ roundtrip":
+    proc test(Name: static Algebra) =
+      var buf: array[gtTorus2Size(Name), byte]
+      for _ in 0 ..< Iters:
+        let a = rng.random_gt(Name)
+        var r {.noInit.}: Fp12[Name]
+        check: buf.serialize_gt_torus2(a) == cttCodecGt_Success
+        check: r.deserialize_gt_torus2(buf) == cttCodecGt_Success
+        doAssert bool(r == a), $Name & ":\n" & a.toHex(indent = 4)
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "Factor 3 compression roundtrip":
+    proc test(Name: static Algebra) =
+      var buf: array[gtCompressedSize(Name), byte]
+      for _ in 0 ..< Iters:
+        let a = rng.random_gt(Name)
+        var r {.noInit.}: Fp12[Name]
+        check: buf.serialize_gt_compressed(a) == cttCodecGt_Success
+        check: r.deserialize_gt_compressed(buf) == cttCodecGt_Success
+        doAssert bool(r == a), $Name & ":\n" & a.toHex(indent = 4)
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "Neutral element":
+    proc test(Name: static Algebra) =
+      var one {.noInit.}, r {.noInit.}: Fp12[Name]
+      one.setOne()
+
+      var buf2: array[gtTorus2Size(Name), byte]
+      check: buf2.serialize_gt_torus2(one) == cttCodecGt_Success
+      check: buf2[0] == byte 0b10000000
+      r.setZero()
+      check: r.deserialize_gt_torus2(buf2) == cttCodecGt_Success
+      check: bool r.isOne()
+
+      var buf3: array[gtCompressedSize(Name), byte]
+      check: buf3.serialize_gt_compressed(one) == cttCodecGt_Success
+      check: buf3[0] == byte 0b10000000
+      r.setZero()
+      check: r.deserialize_gt_compressed(buf3) == cttCodecGt_Success
+      check: bool r.isOne()
+
+      # Neutral flag with garbage
+      buf3[^1] = byte 1
+      check: r.deserialize_gt_compressed(buf3) == cttCodecGt_InvalidEncoding
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "Invalid encodings are rejected":
+    proc test(Name: static Algebra) =
+      var buf: array[gtCompressedSize(Name), byte]
+      var r {.noInit.}: Fp12[Name]
+
+      # Coordinates ≥ p
+      for i in 0 ..< buf.len:
+        buf[i] = byte 0xFF
+      buf[0] = byte 0x3F
+      check: r.deserialize_gt_compressed(buf) == cttCodecGt_CoordinateGreaterThanOrEqualModulus
+
+      # Wrong length
+      check: r.deserialize_gt_compressed(buf.toOpenArray(0, buf.len-2)) == cttCodecGt_InvalidEncoding
+
+      # Random T₂ coordinates are almost never in 𝔾ₜ
+      var buf2: array[gtTorus2Size(Name), byte]
+      let a = rng.random_gt(Name)
+      check: buf2.serialize_gt_torus2(a) == cttCodecGt_Success
+      buf2[^1] = buf2[^1] xor byte 1
+      check: r.deserialize_gt_torus2(buf2) != cttCodecGt_Success
+      check: r.deserialize_gt_torus2_unchecked(buf2) == cttCodecGt_Success
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "Batch decompression matches single decompression":
+    proc test(Name: static Algebra) =
+      const S2 = gtTorus2Size(Name)
+      const S3 = gtCompressedSize(Name)
+      var elems: array[BatchSize, Fp12[Name]]
+      var buf2: array[BatchSize*S2, byte]
+      var buf3: array[BatchSize*S3, byte]
+
+      for i in 0 ..< BatchSize:
+        if i mod 5 == 3:
+          elems[i].setOne()
+        else:
+          elems[i] = rng.random_gt(Name)
+        check: buf2.toOpenArray(i*S2, (i+1)*S2-1).serialize_gt_torus2(elems[i]) == cttCodecGt_Success
+        check: buf3.toOpenArray(i*S3, (i+1)*S3-1).serialize_gt_compressed(elems[i]) == cttCodecGt_Success
+
+      var r2, r3: array[BatchSize, Fp12[Name]]
+      check: r2.deserialize_gt_torus2_batch(buf2) == cttCodecGt_Success
+      check: r3.deserialize_gt_compressed_batch(buf3) == cttCodecGt_Success
+
+      for i in 0 ..< BatchSize:
+        var r {.noInit.}: Fp12[Name]
+        check: r.deserialize_gt_compressed(buf3.toOpenArray(i*S3, (i+1)*S3-1)) == cttCodecGt_Success
+        check: bool(r == elems[i])
+        check: bool(r2[i] == elems[i])
+        check: bool(r3[i] == elems[i])
+
+      # A single invalid element fails the batch
+      buf3[S3 + S3 - 1] = buf3[S3 + S3 - 1] xor byte 1
+      check: r3.deserialize_gt_compressed_batch(buf3) != cttCodecGt_Success
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "x = 0 is rejected by single and batch decompression":
+    # The x₀ flag with x₂ = x₀ = 0 encodes x = 0, i.e. -1 ∉ 𝔾ₜ.
+    # It must not be decoded as a second encoding of the neutral element.
+    proc test(Name: static Algebra) =
+      const S3 = gtCompressedSize(Name)
+      var buf: array[S3, byte]
+      buf[0] = byte 0b01000000 # x₀ flag
+
+      var r {.noInit.}: Fp12[Name]
+      check: r.deserialize_gt_compressed_unchecked(buf) == cttCodecGt_InvalidEncoding
+      check: r.deserialize_gt_compressed(buf) == cttCodecGt_InvalidEncoding
+
+      var rs: array[3, Fp12[Name]]
+      var bufs: array[3*S3, byte]
+      var one {.noInit.}: Fp12[Name]
+      one.setOne()
+      check: bufs.toOpenArray(0, S3-1).serialize_gt_compressed(one) == cttCodecGt_Success
+      bufs[S3] = byte 0b01000000
+      check: bufs.toOpenArray(2*S3, 3*S3-1).serialize_gt_compressed(rng.random_gt(Name)) == cttCodecGt_Success
+      check: rs.deserialize_gt_compressed_batch_unchecked(bufs) == cttCodecGt_InvalidEncoding
+      check: rs.deserialize_gt_compressed_batch(bufs) == cttCodecGt_InvalidEncoding
+
+    test(BN254_Snarks)
+    test(BLS12_381)
@@ -0,0 +1,132 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Standard library
+  std/[os, times, strformat],
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/math/[arithmetic, extension_fields, ec_shortweierstrass],
+  constantine/math/io/io_extfields,
+  constantine/named/[algebras, zoo_subgroups],
+  constantine/math/pairings/[pairings_bw6_761, cyclotomic_subgroups],
+  # Test utilities
+  helpers/prng_unsafe
+
+# Testing multipairing
+# ----------------------------------------------
+
+var rng: RngState
+let timeseed = uint32(toUnix(getTime()) and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+seed(rng, timeseed)
+echo "\n------------------------------------------------------\n"
+echo "test_pairing_bw6_761_multi xoshiro512** seed: ", timeseed
+
+func clearCofactor[F; G: static Subgroup](
+       ec: var EC_ShortW_Aff[F, G]) =
+  # For now we don't have any affine operation defined
+  var t {.noInit.}: EC_ShortW_Prj[F, G]
+  t.fromAffine(ec)
+  t.clearCofactor()
+  ec.affine(t)
+
+func random_point(rng: var RngState, EC: typedesc): EC {.noInit.} =
+  result = rng.random_unsafe(EC)
+  result.clearCofactor()
+
+proc testBilinearity(rng: var RngState) =
+  let P = rng.random_point(EC_ShortW_Aff[Fp[BW6_761], G1])
+  let Q = rng.random_point(EC_ShortW_Aff[Fp[BW6_761], G2])
+  let a = rng.random_unsafe(Fr[BW6_761])
+  let b = rng.random_unsafe(Fr[BW6_761])
+
+  var aP {.noInit.}: EC_ShortW_Aff[Fp[BW6_761], G1]
+  var bQ {.noInit.}: EC_ShortW_Aff[Fp[BW6_761], G2]
+  block:
+    var t {.noInit.}: EC_ShortW_Jac[Fp[BW6_761], G1]
+    t.fromAffine(P)
+    t.scalarMul_vartime(a.toBig())
+    aP.affine(t)
+  block:
+    var t {.noInit.}: EC_ShortW_Jac[Fp[BW6_761], G2]
+    t.fromAffine(Q)
+    t.scalarMul_vartime(b.toBig())
+    bQ.affine(t)
+
+  var ab {.noInit.}: Fr[BW6_761]
+  ab.prod(a, b)
+
+  var r {.noInit.}, rab {.noInit.}: Fp6[BW6_761]
+  r.pairing_bw6_761(P, Q)
+  rab.pairing_bw6_761(aP, bQ)
+
+  doAssert bool(not r.isOne()), "Degenerate pairing"
+  var r_ab = r
+  r_ab.pow_vartime(ab.toBig(), window = 3)
+  doAssert bool(r_ab == rab), "e([a]P, [b]Q) != e(P, Q)^(ab)\n" &
+    "  e(P, Q)^(ab):   " & r_ab.toHex(indent = 18) & "\n" &
+    "  e([a]P, [b]Q):  " & rab.toHex(indent = 18)
+
+  # e(P, Q) . e(-P, Q) == 1
+  var nP = P
+  nP.neg()
+  r.pairing_bw6_761([P, nP], [Q, Q])
+  doAssert bool r.isOne(), "e(P, Q) . e(-P, Q) != 1"
+
+proc testFinalExpHard(rng: var RngState) =
+  # The addition chain in u matches the exponentiation by 3(u³-u²+1)(p²-p+1)/r
+  var f = rng.random_unsafe(Fp6[BW6_761])
+  f.finalExpEasy()
+
+  var expected = f
+  expected.pow_vartime(BW6_761.pairing(finalexponent_hard), window = 3)
+  f.finalExpHard_BW6_761()
+  doAssert bool(f == expected), "Final exponentiation hard part mismatch"
+
+proc testMultiPairing(rng: var RngState, N: static int) =
+  var
+    Ps {.noInit.}: array[N, EC_ShortW_Aff[Fp[BW6_761], G1]]
+    Qs {.noInit.}: array[N, EC_ShortW_Aff[Fp[BW6_761], G2]]
+
+    GTs {.noInit.}: array[N, Fp6[BW6_761]]
+
+  for i in 0 ..< N:
+    Ps[i] = rng.random_point(typeof(Ps[0]))
+    Qs[i] = rng.random_point(typeof(Qs[0]))
+
+  # Simple pairing
+  let clockSimpleStart = cpuTime()
+  var GTsimple {.noInit.}: Fp6[BW6_761]
+  for i in 0 ..< N:
+    GTs[i].pairing_bw6_761(Ps[i], Qs[i])
+
+  GTsimple = GTs[0]
+  for i in 1 ..< N:
+    GTsimple *= GTs[i]
+  let clockSimpleStop = cpuTime()
+
+  # Multipairing
+  let clockMultiStart = cpuTime()
+  var GTmulti {.noInit.}: Fp6[BW6_761]
+  GTmulti.pairing_bw6_761(Ps, Qs)
+  let clockMultiStop = cpuTime()
+
+  echo &"N={N}, Simple: {clockSimpleStop - clockSimpleStart:>4.4f}s, Multi: {clockMultiStop - clockMultiStart:>4.4f}s"
+  doAssert bool GTsimple == GTmulti
+
+for _ in 0 ..< 3:
+  rng.testFinalExpHard()
+  rng.testBilinearity()
+
+staticFor i, 1, 6:
+  rng.testMultiPairing(N = i)
+
+# Pairs are processed by chunks of 16, cover partial and multiple chunks
+rng.testMultiPairing(N = 16)
+rng.testMultiPairing(N = 17)
+rng.testMultiPairing(N = 35)
@@ -0,0 +1,51 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Standard library
+  std/times,
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/math/[arithmetic, extension_fields],
+  constantine/math/io/io_extfields,
+  constantine/named/algebras,
+  constantine/math/pairings/pairings_generic,
+  # Test utilities
+  helpers/prng_unsafe
+
+# Testing batched final exponentiation
+# ----------------------------------------------
+
+var rng: RngState
+let timeseed = uint32(toUnix(getTime()) and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+seed(rng, timeseed)
+echo "\n------------------------------------------------------\n"
+echo "test_pairing_final_exp_batch xoshiro512** seed: ", timeseed
+
+proc testFinalExpBatch(rng: var RngState, Name: static Algebra) =
+  for N in [0, 1, 2, 5, 16]:
+    var fs = newSeq[Fp12[Name]](N)
+    var expected = newSeq[Fp12[Name]](N)
+    for i in 0 ..< N:
+      fs[i] = rng.random_unsafe(Fp12[Name])
+      expected[i] = fs[i]
+      expected[i].finalExp()
+
+    fs.finalExp_batch()
+
+    for i in 0 ..< N:
+      doAssert bool(fs[i] == expected[i]), $Name & ": batch final exponentiation mismatch (N=" & $N & ", i=" & $i & ")\n" &
+        "  expected: " & expected[i].toHex(indent = 12) & "\n" &
+        "  computed: " & fs[i].toHex(indent = 12)
+
+rng.testFinalExpBatch(BN254_Snarks)
+rng.testFinalExpBatch(BN254_Nogami)
+rng.testFinalExpBatch(BLS12_377)
+rng.testFinalExpBatch(BLS12_381)
+
+echo "test_pairing_final_exp_batch SUCCESS"
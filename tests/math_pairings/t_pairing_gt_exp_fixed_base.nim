@@ -0,0 +1,106 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Standard library
+  std/[unittest, times],
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/math/[arithmetic, extension_fields, ec_shortweierstrass],
+  constantine/math/io/io_extfields,
+  constantine/named/algebras,
+  constantine/math/pairings/[
+    pairings_generic,
+    gt_exponentiations_vartime,
+    gt_exponentiations_fixed_base],
+  # Test utilities
+  helpers/prng_unsafe
+
+# Random seed for reproducibility
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "𝔾ₜ fixed-base exponentiation", " xoshiro512** seed: ", seed
+
+const Iters = 6
+
+proc random_gt(rng: var RngState, Name: static Algebra): Fp12[Name] {.noInit.} =
+  let P = rng.random_unsafe(EC_ShortW_Aff[Fp[Name], G1])
+  let Q = rng.random_unsafe(EC_ShortW_Aff[Fp2[Name], G2])
+  result.pairing(P, Q)
+
+proc checkFixedBase(Name: static Algebra, numBlocks: int, exponent: BigInt) =
+  let a = rng.random_gt(Name)
+
+  var table: GtFixedBaseTable[Name]
+  var torusTable: GtFixedBaseTorusTable[Name]
+  table.init(a, numBlocks)
+  doAssert torusTable.compress(table)
+
+  var expected {.noInit.}, r {.noInit.}: Fp12[Name]
+  expected.gtExp_vartime(a, exponent)
+
+  r.gtExp_fixedBase(table, exponent)
+  doAssert bool(r == expected), $Name & " (" & $numBlocks & " blocks, constant-time):\n" &
+    "  expected: " & expected.toHex(indent = 12) & "\n" &
+    "  computed: " & r.toHex(indent = 12)
+
+  r.gtExp_fixedBase_vartime(table, exponent)
+  doAssert bool(r == expected), $Name & " (" & $numBlocks & " blocks, vartime)"
+
+  r.gtExp_fixedBase(torusTable, exponent)
+  doAssert bool(r == expected), $Name & " (" & $numBlocks & " blocks, torus, constant-time)"
+
+  r.gtExp_fixedBase_vartime(torusTable, exponent)
+  doAssert bool(r == expected), $Name & " (" & $numBlocks & " blocks, torus, vartime)"
+
+suite "Fixed-base exponentiation in 𝔾ₜ" & " [" & $WordBitWidth & "-bit words]":
+  test "Random exponents":
+    proc test(Name: static Algebra) =
+      for numBlocks in [1, 3, 8, gtFixedBaseMaxBlocks(Name)]:
+        for _ in 0 ..< Iters:
+          let k = rng.random_unsafe(Fr[Name]).toBig()
+          checkFixedBase(Name, numBlocks, k)
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "Edge case exponents":
+    proc test(Name: static Algebra) =
+      var zero, one, two, rMinus1: Fr[Name]
+      zero.setZero()
+      one.setOne()
+      two.setOne()
+      two.double()
+      rMinus1.setMinusOne()
+
+      for numBlocks in [1, 5]:
+        checkFixedBase(Name, numBlocks, zero.toBig())
+        checkFixedBase(Name, numBlocks, one.toBig())
+        checkFixedBase(Name, numBlocks, two.toBig())
+        checkFixedBase(Name, numBlocks, rMinus1.toBig())
+
+    test(BN254_Snarks)
+    test(BLS12_381)
+
+  test "Degenerate base 1 has no torus table":
+    proc test(Name: static Algebra) =
+      var one {.noInit.}: Fp12[Name]
+      one.setOne()
+      var table: GtFixedBaseTable[Name]
+      var torusTable: GtFixedBaseTorusTable[Name]
+      table.init(one, 4)
+      check: not torusTable.compress(table)
+
+      let k = rng.random_unsafe(Fr[Name]).toBig()
+      var r {.noInit.}: Fp12[Name]
+      r.gtExp_fixedBase(table, k)
+      check: bool r.isOne()
+
+    test(BN254_Snarks)
+    test(BLS12_381)
@@ -0,0 +1,92 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Standard library
+  std/[times, strformat],
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/math/[arithmetic, extension_fields, ec_shortweierstrass],
+  constantine/math/io/io_extfields,
+  constantine/named/algebras,
+  constantine/math/pairings/[pairings_generic, miller_loops_prepared],
+  # Test utilities
+  helpers/prng_unsafe
+
+# Testing pairings with prepared G2 points
+# ----------------------------------------------
+
+var rng: RngState
+let timeseed = uint32(toUnix(getTime()) and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+seed(rng, timeseed)
+echo "\n------------------------------------------------------\n"
+echo "test_pairing_prepared_g2 xoshiro512** seed: ", timeseed
+
+proc testPreparedMultiPairing(rng: var RngState, Name: static Algebra, N, M: static int) =
+  ## N pairs with regular G2 points, M pairs with prepared G2 points
+  var
+    Ps {.noInit.}: array[N+M, EC_ShortW_Aff[Fp[Name], G1]]
+    Qs {.noInit.}: array[N+M, EC_ShortW_Aff[Fp2[Name], G2]]
+    prepared {.noInit.}: array[M, PreparedG2[Name]]
+
+  for i in 0 ..< N+M:
+    Ps[i] = rng.random_unsafe(typeof(Ps[0]))
+    Qs[i] = rng.random_unsafe(typeof(Qs[0]))
+  for j in 0 ..< M:
+    prepared[j].prepare(Qs[N+j])
+
+  var expected {.noInit.}, gt {.noInit.}: Name.getGT()
+  expected.pairing(Ps, Qs)
+
+  gt.millerLoopPrepared(
+    Qs.toOpenArray(0, N-1), Ps.toOpenArray(0, N-1),
+    prepared, Ps.toOpenArray(N, N+M-1))
+  gt.finalExp()
+
+  doAssert bool(gt == expected), &"Prepared multi-pairing mismatch for {Name}, N={N}, M={M}"
+
+proc testPreparedPairingCheck(rng: var RngState, Name: static Algebra) =
+  ## e(P, Q).e(-P, Q) = 1 and e([a]P, Q).e(-P, [a]Q) = 1
+  var
+    P {.noInit.}, nP {.noInit.}, aP {.noInit.}: EC_ShortW_Aff[Fp[Name], G1]
+    Q {.noInit.}, aQ {.noInit.}: EC_ShortW_Aff[Fp2[Name], G2]
+    prepQ {.noInit.}, prepAQ {.noInit.}: PreparedG2[Name]
+
+  P = rng.random_unsafe(typeof(P))
+  Q = rng.random_unsafe(typeof(Q))
+  nP.neg(P)
+  prepQ.prepare(Q)
+
+  doAssert pairing_check(P, Q, nP, prepQ)
+  doAssert pairing_check(P, prepQ, nP, prepQ)
+  doAssert not pairing_check(P, Q, P, prepQ)
+
+  let a = rng.random_unsafe(Fr[Name]).toBig()
+  var aPjac {.noInit.}: EC_ShortW_Jac[Fp[Name], G1]
+  var aQjac {.noInit.}: EC_ShortW_Jac[Fp2[Name], G2]
+  aPjac.fromAffine(P)
+  aPjac.scalarMul_vartime(a)
+  aP.affine(aPjac)
+  aQjac.fromAffine(Q)
+  aQjac.scalarMul_vartime(a)
+  aQ.affine(aQjac)
+  prepAQ.prepare(aQ)
+
+  doAssert pairing_check(aP, Q, nP, prepAQ)
+  doAssert pairing_check(aP, prepQ, nP, prepAQ)
+
+staticFor i, 0, 4:
+  staticFor j, 1, 4:
+    rng.testPreparedMultiPairing(BN254_Snarks, N = i, M = j)
+    rng.testPreparedMultiPairing(BLS12_381, N = i, M = j)
+
+for _ in 0 ..< 4:
+  rng.testPreparedPairingCheck(BN254_Snarks)
+  rng.testPreparedPairingCheck(BLS12_381)
+
+echo "test_pairing_prepared_g2 SUCCESS"
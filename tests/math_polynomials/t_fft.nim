@@ -486,6 +486,142 @@ proc testInPlaceECFFT*(EC: typedesc, F: typedesc[Fr]) =
 
   echo "  ✓ In-place EC FFT tests PASSED"
 
+proc testBatchFFT*(F: typedesc[Fr]) =
+  echo "Testing batched FFT (row-major and column-major)..."
+
+  proc check(order, batchSize: int) =
+    let fftDesc = createFFTDescriptor(F, order)
+
+    # Row-major input, polynomial b at [b*order, (b+1)*order)
+    var rows = newSeq[F](order*batchSize)
+    for i in 0 ..< rows.len:
+      rows[i].fromUint(uint64(i*i + 7))
+
+    var cols = newSeq[F](order*batchSize)
+    for b in 0 ..< batchSize:
+      for k in 0 ..< order:
+        cols[k*batchSize + b] = rows[b*order + k]
+
+    var expected_nr = newSeq[F](order*batchSize)
+    var expected_nn = newSeq[F](order*batchSize)
+    for b in 0 ..< batchSize:
+      doAssert fft_nr(fftDesc,
+        expected_nr.toOpenArray(b*order, (b+1)*order-1),
+        rows.toOpenArray(b*order, (b+1)*order-1)) == FFT_Success
+      doAssert fft_nn(fftDesc,
+        expected_nn.toOpenArray(b*order, (b+1)*order-1),
+        rows.toOpenArray(b*order, (b+1)*order-1)) == FFT_Success
+
+    var rows_nr = newSeq[F](order*batchSize)
+    var rows_nn = newSeq[F](order*batchSize)
+    var cols_nr = newSeq[F](order*batchSize)
+    var cols_nn = cols
+    doAssert fft_nr_batch(fftDesc, rows_nr, rows, batchSize, kRowMajor) == FFT_Success
+    doAssert fft_nn_batch(fftDesc, rows_nn, rows, batchSize) == FFT_Success
+    doAssert fft_nr_batch(fftDesc, cols_nr, cols, batchSize, kColMajor) == FFT_Success
+    doAssert fft_nn_batch(fftDesc, cols_nn, cols_nn, batchSize, kColMajor) == FFT_Success # In-place
+
+    for b in 0 ..< batchSize:
+      for k in 0 ..< order:
+        doAssert (expected_nr[b*order + k] == rows_nr[b*order + k]).bool,
+          "Row-major batch NR mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+        doAssert (expected_nn[b*order + k] == rows_nn[b*order + k]).bool,
+          "Row-major batch NN mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+        doAssert (expected_nr[b*order + k] == cols_nr[k*batchSize + b]).bool,
+          "Column-major batch NR mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+        doAssert (expected_nn[b*order + k] == cols_nn[k*batchSize + b]).bool,
+          "Column-major batch NN mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+
+  for order in [1, 2, 4, 16, 64]:
+    for batchSize in [1, 3, 8, 13]:
+      check(order, batchSize)
+
+  # Four-step path for large row-major transforms
+  check(1 shl fftFourStepThreshold, 2)
+
+  # Size validation
+  block:
+    let fftDesc = createFFTDescriptor(F, 16)
+    var vals = newSeq[F](48)
+    var output = newSeq[F](48)
+    doAssert fft_nr_batch(fftDesc, output, vals, 5) == FFT_BatchSizeMismatch
+    doAssert fft_nr_batch(fftDesc, output, vals, 0) == FFT_BatchSizeMismatch
+    doAssert fft_nr_batch(fftDesc, output, vals, 4) == FFT_SizeNotPowerOfTwo
+    doAssert fft_nr_batch(fftDesc, output, vals, 3) == FFT_Success
+
+  echo "  ✓ Batched FFT tests PASSED"
+
+proc testBatchIFFTAndCoset*(F: typedesc[Fr]) =
+  echo "Testing batched IFFT and coset FFT (row-major and column-major)..."
+
+  proc check(order, batchSize: int) =
+    let fftDesc = createFFTDescriptor(F, order)
+    let cosetShift = F.fromUint(5'u32)
+    # Same descriptor with cached fused coset twiddles
+    var cachedDesc = createFFTDescriptor(F, order)
+    if order >= 2:
+      cachedDesc.precomputeCosetTwiddles(cosetShift, order)
+
+    var rows = newSeq[F](order*batchSize)
+    for i in 0 ..< rows.len:
+      rows[i].fromUint(uint64(3*i*i + 11))
+
+    var cols = newSeq[F](order*batchSize)
+    for b in 0 ..< batchSize:
+      for k in 0 ..< order:
+        cols[k*batchSize + b] = rows[b*order + k]
+
+    var expected_irn = newSeq[F](order*batchSize)
+    var expected_inn = newSeq[F](order*batchSize)
+    var expected_cnr = newSeq[F](order*batchSize)
+    var expected_cirn = newSeq[F](order*batchSize)
+    for b in 0 ..< batchSize:
+      template row(s: untyped): untyped = s.toOpenArray(b*order, (b+1)*order-1)
+      doAssert ifft_rn(fftDesc, row(expected_irn), row(rows)) == FFT_Success
+      doAssert ifft_nn(fftDesc, row(expected_inn), row(rows)) == FFT_Success
+      doAssert coset_fft_nr(fftDesc, row(expected_cnr), row(rows), cosetShift) == FFT_Success
+      doAssert coset_ifft_rn(fftDesc, row(expected_cirn), row(rows), cosetShift) == FFT_Success
+
+    for layout in [kRowMajor, kColMajor]:
+      let input = if layout == kRowMajor: rows else: cols
+      var irn = newSeq[F](order*batchSize)
+      var inn = input
+      var cnr = newSeq[F](order*batchSize)
+      var cirn = input
+      doAssert ifft_rn_batch(fftDesc, irn, input, batchSize, layout) == FFT_Success
+      doAssert ifft_nn_batch(fftDesc, inn, inn, batchSize, layout) == FFT_Success # In-place
+      doAssert coset_fft_nr_batch(fftDesc, cnr, input, batchSize, cosetShift, layout) == FFT_Success
+      doAssert coset_ifft_rn_batch(fftDesc, cirn, cirn, batchSize, cosetShift, layout) == FFT_Success # In-place
+      var cached_cnr = input
+      var cached_cirn = newSeq[F](order*batchSize)
+      doAssert coset_fft_nr_batch(cachedDesc, cached_cnr, cached_cnr, batchSize, cosetShift, layout) == FFT_Success # In-place
+      doAssert coset_ifft_rn_batch(cachedDesc, cached_cirn, input, batchSize, cosetShift, layout) == FFT_Success
+
+      for b in 0 ..< batchSize:
+        for k in 0 ..< order:
+          let i = if layout == kRowMajor: b*order + k else: k*batchSize + b
+          doAssert (expected_irn[b*order + k] == irn[i]).bool,
+            $layout & " batch IFFT RN mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+          doAssert (expected_inn[b*order + k] == inn[i]).bool,
+            $layout & " batch IFFT NN mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+          doAssert (expected_cnr[b*order + k] == cnr[i]).bool,
+            $layout & " batch coset FFT NR mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+          doAssert (expected_cirn[b*order + k] == cirn[i]).bool,
+            $layout & " batch coset IFFT RN mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+          doAssert (expected_cnr[b*order + k] == cached_cnr[i]).bool,
+            $layout & " cached twiddles batch coset FFT NR mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+          doAssert (expected_cirn[b*order + k] == cached_cirn[i]).bool,
+            $layout & " cached twiddles batch coset IFFT RN mismatch (order=" & $order & ", batch=" & $batchSize & ")"
+
+  for order in [1, 2, 4, 16, 64]:
+    for batchSize in [1, 3, 8, 13]:
+      check(order, batchSize)
+
+  # Four-step path for large row-major transforms
+  check(1 shl fftFourStepThreshold, 2)
+
+  echo "  ✓ Batched IFFT and coset FFT tests PASSED"
+
 when isMainModule:
   echo "========================================"
   echo "    FFT/IFFT Correctness Tests"
@@ -508,6 +644,10 @@ when isMainModule:
   testInPlaceFFT(Fr[BLS12_381])
   echo ""
   testInPlaceECFFT(EC_ShortW_Prj[Fp[BLS12_381], G1], Fr[BLS12_381])
+  echo ""
+  testBatchFFT(Fr[BLS12_381])
+  echo ""
+  testBatchIFFTAndCoset(Fr[BLS12_381])
 
   echo "\n========================================"
   echo "    All FFT tests PASSED ✓"
@@ -106,6 +106,64 @@ proc testCosetFFTSpecificSizes*(F: typedesc[Fr]) =
 
   echo "  ✓ Coset FFT PeerDAS-specific tests PASSED"
 
+proc testFusedCosetFFT*(F: typedesc[Fr]) =
+  echo "Testing fused Coset FFT (cached twiddles) vs shift + FFT..."
+
+  var shift_factor: F
+  shift_factor.fromUint(5'u64)
+
+  var other_shift: F
+  other_shift.fromUint(7'u64)
+
+  # Descriptor order larger than the FFT size to exercise roots subsampling,
+  # and a size above the four-step threshold for the half-size sub-FFTs.
+  for (order, n) in [(2, 2), (64, 4), (64, 32), (128, 128), (1 shl (fftFourStepThreshold+1), 1 shl (fftFourStepThreshold+1))]:
+    let plainDesc = createFFTDescriptor(F, order)
+    var fusedDesc = createFFTDescriptor(F, order)
+    fusedDesc.precomputeCosetTwiddles(shift_factor, n)
+
+    var data = newSeq[F](n)
+    for i in 0 ..< n:
+      data[i].fromUint(uint64(3*i + 1))
+
+    var expected_nr = newSeq[F](n)
+    var expected_nn = newSeq[F](n)
+    var expected_inv_rn = newSeq[F](n)
+    var expected_inv_nn = newSeq[F](n)
+    doAssert plainDesc.coset_fft_nr(expected_nr, data, shift_factor) == FFT_Success
+    doAssert plainDesc.coset_fft_nn(expected_nn, data, shift_factor) == FFT_Success
+    doAssert plainDesc.coset_ifft_rn(expected_inv_rn, data, shift_factor) == FFT_Success
+    doAssert plainDesc.coset_ifft_nn(expected_inv_nn, data, shift_factor) == FFT_Success
+
+    var fused_nr = newSeq[F](n)
+    var fused_nn = data
+    var fused_inv_rn = newSeq[F](n)
+    var fused_inv_nn = data
+    doAssert fusedDesc.coset_fft_nr(fused_nr, data, shift_factor) == FFT_Success
+    doAssert fusedDesc.coset_fft_nn(fused_nn, fused_nn, shift_factor) == FFT_Success # In-place
+    doAssert fusedDesc.coset_ifft_rn(fused_inv_rn, data, shift_factor) == FFT_Success
+    doAssert fusedDesc.coset_ifft_nn(fused_inv_nn, fused_inv_nn, shift_factor) == FFT_Success # In-place
+
+    # A different shift falls back to the unfused path
+    var expected_other = newSeq[F](n)
+    var fused_other = newSeq[F](n)
+    doAssert plainDesc.coset_fft_nr(expected_other, data, other_shift) == FFT_Success
+    doAssert fusedDesc.coset_fft_nr(fused_other, data, other_shift) == FFT_Success
+
+    # Roundtrip through the fused paths
+    var recovered = newSeq[F](n)
+    doAssert fusedDesc.coset_ifft_rn(recovered, fused_nr, shift_factor) == FFT_Success
+
+    for i in 0 ..< n:
+      doAssert (expected_nr[i] == fused_nr[i]).bool, "Fused coset FFT NR mismatch at size " & $n & " index " & $i
+      doAssert (expected_nn[i] == fused_nn[i]).bool, "Fused coset FFT NN mismatch at size " & $n & " index " & $i
+      doAssert (expected_inv_rn[i] == fused_inv_rn[i]).bool, "Fused coset IFFT RN mismatch at size " & $n & " index " & $i
+      doAssert (expected_inv_nn[i] == fused_inv_nn[i]).bool, "Fused coset IFFT NN mismatch at size " & $n & " index " & $i
+      doAssert (expected_other[i] == fused_other[i]).bool, "Coset FFT NR fallback mismatch at size " & $n & " index " & $i
+      doAssert (data[i] == recovered[i]).bool, "Fused coset roundtrip failed at size " & $n & " index " & $i
+
+  echo "  ✓ All fused Coset FFT tests PASSED"
+
 when isMainModule:
   echo "========================================"
   echo "    Coset FFT/IFFT Correctness Tests"
@@ -114,6 +172,8 @@ when isMainModule:
   testCosetFFTRoundtrip(Fr[BLS12_381])
   echo ""
   testCosetFFTSpecificSizes(Fr[BLS12_381])
+  echo ""
+  testFusedCosetFFT(Fr[BLS12_381])
 
   echo "\n========================================"
   echo "    All Coset FFT tests PASSED ✓"
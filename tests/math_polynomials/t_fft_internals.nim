@@ -314,6 +314,79 @@ proc testFrIFFTRNConsistency*() =
 
   echo "  ✓ Fr IFFT RN: IFFT_RN(FFT_NR(x)) roundtrip successful"
 
+proc testFrFFTFourStepConsistency*() =
+  echo "Testing Fr FFT NR four-step vs iterative DIF..."
+
+  # The descriptor order is larger than the FFT sizes
+  # to also exercise roots of unity subsampling.
+  let fftDesc = createFFTDescriptor(F, 1 shl 12)
+
+  for logN in 0 .. 11:
+    let order = 1 shl logN
+
+    var vals = newSeq[F](order)
+    for i in 0..<order:
+      vals[i].fromUint(uint64(i*i + 3))
+
+    var output_dif = newSeq[F](order)
+    discard fft_nr_iterative_dif(fftDesc, output_dif, vals)
+
+    var output_four_step = newSeq[F](order)
+    doAssert fft_nr_four_step(fftDesc, output_four_step, vals) == FFT_Success
+
+    # In-place
+    var inplace = vals
+    doAssert fft_nr_four_step(fftDesc, inplace, inplace) == FFT_Success
+
+    for i in 0..<order:
+      doAssert (output_dif[i] == output_four_step[i]).bool,
+        "NR DIF vs NR four-step mismatch at index " & $i & " (order=" & $order & ")"
+      doAssert (output_dif[i] == inplace[i]).bool,
+        "NR DIF vs NR four-step in-place mismatch at index " & $i & " (order=" & $order & ")"
+
+  echo "  ✓ Fr FFT NR: Four-step and iterative DIF produce identical results"
+
+proc testFrFFTRadixConsistency*() =
+  echo "Testing Fr FFT radix-4 and radix-8 kernels vs radix-2..."
+
+  var fftDesc = createFFTDescriptor(F, 1 shl 10)
+
+  for radix in [kRadix4, kRadix8]:
+    for logN in 0 .. 10:
+      let order = 1 shl logN
+
+      var vals = newSeq[F](order)
+      for i in 0..<order:
+        vals[i].fromUint(uint64(i*i + 3))
+
+      fftDesc.radix = kRadix2
+      var expected_nr = newSeq[F](order)
+      var expected_rn = newSeq[F](order)
+      discard fft_nr_iterative_dif(fftDesc, expected_nr, vals)
+      discard fft_rn_iterative_dit(fftDesc, expected_rn, vals)
+
+      fftDesc.radix = radix
+      var output_nr = newSeq[F](order)
+      var output_rn = newSeq[F](order)
+      var output_four_step = newSeq[F](order)
+      var recovered = newSeq[F](order)
+      doAssert fft_nr_iterative_dif(fftDesc, output_nr, vals) == FFT_Success
+      doAssert fft_rn_iterative_dit(fftDesc, output_rn, vals) == FFT_Success
+      doAssert fft_nr_four_step(fftDesc, output_four_step, vals) == FFT_Success
+      doAssert ifft_rn_iterative_dit(fftDesc, recovered, output_nr) == FFT_Success
+
+      for i in 0..<order:
+        doAssert (expected_nr[i] == output_nr[i]).bool,
+          "NR DIF " & $radix & " mismatch at index " & $i & " (order=" & $order & ")"
+        doAssert (expected_rn[i] == output_rn[i]).bool,
+          "RN DIT " & $radix & " mismatch at index " & $i & " (order=" & $order & ")"
+        doAssert (expected_nr[i] == output_four_step[i]).bool,
+          "NR four-step " & $radix & " mismatch at index " & $i & " (order=" & $order & ")"
+        doAssert (vals[i] == recovered[i]).bool,
+          "IFFT RN " & $radix & " roundtrip mismatch at index " & $i & " (order=" & $order & ")"
+
+  echo "  ✓ Fr FFT: Radix-4 and radix-8 kernels match radix-2"
+
 when isMainModule:
   echo "========================================"
   echo "    Low-Level FFT Algorithm Tests"
@@ -330,6 +403,8 @@ when isMainModule:
   testFrFFTNRConsistency()
   testFrFFTRNConsistency()
   testFrIFFTRNConsistency()
+  testFrFFTFourStepConsistency()
+  testFrFFTRadixConsistency()
 
   echo ""
   echo "========================================"
@@ -12,10 +12,12 @@ import
   # Internals
   constantine/math/arithmetic,
   constantine/named/algebras,
-  constantine/math/polynomials/polynomials,
+  constantine/math/polynomials/polynomials {.all.},
+  constantine/platforms/primitives,
   constantine/math/io/io_fields,
   # Test utilities
-  helpers/prng_unsafe
+  helpers/prng_unsafe,
+  ./fft_utils
 
 const Degree = 42
 const NumCoefs = Degree+1
@@ -90,3 +92,148 @@ suite "Polynomials":
         doAssert bool(dvz == dvz3)
 
     t_vanishing()
+
+suite "Subquadratic polynomial arithmetic":
+  # Banderwagon's Fr has a 2-adicity of 32 but no precomputed root table here
+  # so NTT-based paths are tested over BLS12-381 Fr.
+  type Fr381 = Fr[BLS12_381]
+
+  proc randomPoly(len: int): seq[Fr381] =
+    result.setLen(len)
+    for i in 0 ..< len:
+      result[i] = rng.random_unsafe(Fr381)
+
+  proc naiveMul(a, b: seq[Fr381]): seq[Fr381] =
+    result.setLen(a.len+b.len-1)
+    for i in 0 ..< a.len:
+      for j in 0 ..< b.len:
+        var t: Fr381
+        t.prod(a[i], b[j])
+        result[i+j] += t
+
+  let fftDesc = createFFTDescriptor(Fr381, 1 shl 11)
+
+  test "Polynomial multiplication matches schoolbook for non power-of-2 sizes":
+    proc t_mul() =
+      for (la, lb) in [(1, 1), (1, 17), (7, 5), (33, 33), (45, 100), (129, 131), (300, 257), (513, 700)]:
+        let a = randomPoly(la)
+        let b = randomPoly(lb)
+        let expected = naiveMul(a, b)
+
+        var r = newSeq[Fr381](la+lb-1)
+        r.polyMul(a, b, fftDesc)
+        var r2 = newSeq[Fr381](la+lb-1)
+        r2.polyMul(a, b)
+
+        for i in 0 ..< expected.len:
+          doAssert bool(r[i] == expected[i]), "la=" & $la & ", lb=" & $lb & ", i=" & $i
+          doAssert bool(r2[i] == expected[i]), "la=" & $la & ", lb=" & $lb & ", i=" & $i
+
+    t_mul()
+
+  test "Power series inverse":
+    proc t_inverse() =
+      for (la, n) in [(1, 1), (1, 9), (5, 20), (70, 70), (200, 150), (300, 513)]:
+        var a = randomPoly(la)
+        if a[0].isZero().bool():
+          a[0].setOne()
+
+        var inv = newSeq[Fr381](n)
+        inv.polyInverse(a, fftDesc)
+
+        let p = naiveMul(a, inv)
+        doAssert p[0].isOne().bool()
+        for i in 1 ..< n:
+          doAssert p[i].isZero().bool(), "la=" & $la & ", n=" & $n & ", i=" & $i
+
+    t_inverse()
+
+  test "Division with remainder":
+    proc t_divrem() =
+      for (la, lb) in [(3, 5), (10, 1), (20, 7), (100, 100), (400, 90), (600, 201), (700, 550)]:
+        let a = randomPoly(la)
+        var b = randomPoly(lb)
+        if b[lb-1].isZero().bool():
+          b[lb-1].setOne()
+
+        var q = newSeq[Fr381](max(la-lb+1, 0))
+        var rem = newSeq[Fr381](lb-1)
+        polyDivRem(q, rem, a, b, fftDesc)
+
+        # a == q*b + rem
+        var recomposed = newSeq[Fr381](max(la, lb-1))
+        if q.len > 0:
+          let qb = naiveMul(q, b)
+          for i in 0 ..< qb.len:
+            recomposed[i] = qb[i]
+        for i in 0 ..< rem.len:
+          recomposed[i] += rem[i]
+        for i in 0 ..< recomposed.len:
+          if i < la:
+            doAssert bool(recomposed[i] == a[i]), "la=" & $la & ", lb=" & $lb & ", i=" & $i
+          else:
+            doAssert recomposed[i].isZero().bool()
+
+    t_divrem()
+
+  test "Subproduct tree multipoint evaluation and interpolation":
+    proc t_subproduct_tree() =
+      for n in [1, 2, 5, 33, 100, 300]:
+        let points = randomPoly(n)
+        var tree: SubproductTree[Fr381]
+        tree.init(points, fftDesc)
+
+        # Vanishing polynomial
+        let M = tree.vanishingPoly()
+        for i in 0 ..< n:
+          var v: Fr381
+          v.evalHorner(M, n+1, points[i])
+          doAssert v.isZero().bool()
+
+        # Evaluation, with polynomials smaller and larger than the tree
+        for polyLen in [max(1, n div 2), n, 2*n+3]:
+          let poly = randomPoly(polyLen)
+          var evals = newSeq[Fr381](n)
+          tree.multipointEval(evals, poly, fftDesc)
+          for i in 0 ..< n:
+            var expected: Fr381
+            expected.evalHorner(poly.asUnchecked(), polyLen, points[i])
+            doAssert bool(evals[i] == expected), "n=" & $n & ", polyLen=" & $polyLen & ", i=" & $i
+
+        # Interpolation
+        let values = randomPoly(n)
+        var coefs = newSeq[Fr381](n)
+        tree.interpolate(coefs, values, fftDesc)
+        for i in 0 ..< n:
+          var v: Fr381
+          v.evalHorner(coefs.asUnchecked(), n, points[i])
+          doAssert bool(v == values[i]), "n=" & $n & ", i=" & $i
+
+    t_subproduct_tree()
+
+
+  test "Batched barycentric evaluation over roots of unity":
+    proc t_batch_eval() =
+      const N = 64
+      let domain = Fr381.computeRootsOfUnity(N)
+
+      for (M, K) in [(1, 1), (3, 1), (1, 7), (5, 9)]:
+        var polys = newSeq[PolynomialEval[N, Fr381, kNaturalOrder]](M)
+        for m in 0 ..< M:
+          rng.random_unsafe(polys[m].evals)
+
+        # Include a point in the domain
+        var zs = randomPoly(K)
+        if K > 1:
+          zs[K-1] = domain.rootsOfUnity[5]
+
+        var r = newSeq[Fr381](M*K)
+        domain.evalPolysAt(r, polys, zs)
+
+        for m in 0 ..< M:
+          for k in 0 ..< K:
+            var expected: Fr381
+            domain.evalPolyAt(expected, polys[m], zs[k])
+            doAssert bool(r[m*K + k] == expected), "M=" & $M & ", K=" & $K & ", m=" & $m & ", k=" & $k
+
+    t_batch_eval()
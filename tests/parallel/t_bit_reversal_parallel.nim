@@ -0,0 +1,61 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel Bit-Reversal Permutation Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_bit_reversal_parallel.nim
+
+import
+  constantine/math/polynomials/fft_common_parallel {.all.},
+  constantine/platforms/bithacks,
+  constantine/threadpool/threadpool
+
+type
+  Point96 = array[12, uint64]
+    ## Stand-in for a 96-byte elliptic curve point
+
+func init(T: type int64, i: int): T = T(i)
+func init(T: type Point96, i: int): T =
+  for j in 0 ..< result.len:
+    result[j] = uint64(i) * uint64(j+1)
+
+proc testParallelBitReversal[T](tp: Threadpool, maxLogN: int) =
+  echo "Testing parallel bit-reversal for " & $sizeof(T) & "-byte elements (logN=1.." & $maxLogN & ")..."
+
+  for logN in 1 .. maxLogN:
+    let N = 1 shl logN
+
+    var src = newSeq[T](N)
+    for i in 0 ..< N:
+      src[i] = T.init(i)
+
+    # Out-of-place
+    var dst = newSeq[T](N)
+    tp.bit_reversal_permutation_parallel(dst, src)
+
+    # In-place
+    var buf = src
+    tp.bit_reversal_permutation_parallel(buf)
+
+    for i in 0 ..< N:
+      let rev_i = int reverseBits(uint32(i), uint32(logN))
+      doAssert dst[i] == T.init(rev_i),
+        "Parallel out-of-place failed at logN=" & $logN & " index=" & $i
+      doAssert buf[i] == T.init(rev_i),
+        "Parallel in-place failed at logN=" & $logN & " index=" & $i
+
+  echo "  ✓ Parallel bit-reversal PASSED"
+
+when isMainModule:
+  let tp = Threadpool.new()
+
+  tp.testParallelBitReversal[:int64](bitReversalParallelThreshold + 4)
+  tp.testParallelBitReversal[:Point96](bitReversalParallelThreshold + 2)
+
+  tp.shutdown()
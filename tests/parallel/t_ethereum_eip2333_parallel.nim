@@ -0,0 +1,54 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel EIP-2333 Key Derivation Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_ethereum_eip2333_parallel.nim
+
+import
+  constantine/named/algebras,
+  constantine/math/arithmetic/bigints,
+  constantine/ethereum_eip2333_bls12381_key_derivation_parallel,
+  constantine/threadpool/threadpool,
+  helpers/prng_unsafe
+
+type SecretKey = Fr[BLS12_381].getBigInt()
+
+proc testParallelKeyDerivation(tp: Threadpool, rng: var RngState) =
+  echo "Testing parallel EIP-2333 child key derivation..."
+
+  var seed: array[32, byte]
+  for i in 0 ..< 32:
+    seed[i] = byte rng.next()
+
+  var master: SecretKey
+  doAssert master.derive_master_secretKey(seed)
+
+  for n in [0, 1, 7, 100]:
+    var indices = newSeq[uint32](n)
+    for i in 0 ..< n:
+      indices[i] = uint32 rng.next()
+
+    var expected = newSeq[SecretKey](n)
+    var children = newSeq[SecretKey](n)
+    doAssert expected.derive_child_secretKeys(master, indices)
+    doAssert tp.derive_child_secretKeys_parallel(children, master, indices)
+    for i in 0 ..< n:
+      doAssert bool(children[i] == expected[i]),
+        "Parallel child derivation failed for index " & $indices[i]
+
+  echo "  ✓ Parallel EIP-2333 child key derivation PASSED"
+
+when isMainModule:
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  let tp = Threadpool.new()
+  tp.testParallelKeyDerivation(rng)
+  tp.shutdown()
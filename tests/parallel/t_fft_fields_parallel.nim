@@ -0,0 +1,152 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel FFT Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_fft_fields_parallel.nim
+
+import
+  std/times,
+  constantine/named/algebras,
+  constantine/math/arithmetic,
+  constantine/math/polynomials/fft_fields {.all.},
+  constantine/math/polynomials/fft_fields_parallel {.all.},
+  constantine/threadpool/threadpool,
+  helpers/prng_unsafe,
+  ../math_polynomials/fft_utils
+
+type
+  F = Fr[BLS12_381]
+
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "\n------------------------------------------------------\n"
+echo "t_fft_fields_parallel xoshiro512** seed: ", seed
+
+proc testFrFFTFourStepParallel(tp: Threadpool) =
+  echo "Testing parallel Fr FFT NR four-step vs iterative DIF..."
+
+  let fftDesc = createFFTDescriptor(F, 1 shl 12)
+
+  for logN in 0 .. 12:
+    let order = 1 shl logN
+
+    var vals = newSeq[F](order)
+    for i in 0 ..< order:
+      vals[i] = rng.random_unsafe(F)
+
+    var expected = newSeq[F](order)
+    discard fft_nr_iterative_dif(fftDesc, expected, vals)
+
+    var output = newSeq[F](order)
+    doAssert tp.fft_nr_four_step_parallel(fftDesc, output, vals) == FFT_Success
+
+    for i in 0 ..< order:
+      doAssert (expected[i] == output[i]).bool,
+        "NR DIF vs parallel NR four-step mismatch at index " & $i & " (order=" & $order & ")"
+
+  echo "  ✓ Fr FFT NR: Parallel four-step and iterative DIF produce identical results"
+
+proc testFrFFTDispatchParallel(tp: Threadpool) =
+  echo "Testing parallel Fr FFT NN dispatch vs serial, above the four-step threshold..."
+
+  let logN = fftFourStepThreshold + 1
+  let order = 1 shl logN
+  let fftDesc = createFFTDescriptor(F, order)
+
+  var vals = newSeq[F](order)
+  for i in 0 ..< order:
+    vals[i] = rng.random_unsafe(F)
+
+  var expected = newSeq[F](order)
+  discard fft_nn_via_iterative_dif_and_bitrev(fftDesc, expected, vals)
+
+  var output_serial = newSeq[F](order)
+  doAssert fft_nn(fftDesc, output_serial, vals) == FFT_Success
+
+  var output_parallel = newSeq[F](order)
+  doAssert tp.fft_nn_parallel(fftDesc, output_parallel, vals) == FFT_Success
+
+  for i in 0 ..< order:
+    doAssert (expected[i] == output_serial[i]).bool,
+      "NN DIF+BitRev vs NN dispatch mismatch at index " & $i & " (order=" & $order & ")"
+    doAssert (expected[i] == output_parallel[i]).bool,
+      "NN DIF+BitRev vs parallel NN dispatch mismatch at index " & $i & " (order=" & $order & ")"
+
+  echo "  ✓ Fr FFT NN: Parallel and serial dispatch produce identical results"
+
+proc testFrFFTBatchParallel(tp: Threadpool) =
+  echo "Testing parallel batched Fr FFT vs serial batched FFT..."
+
+  for (order, batchSize) in [(16, 1), (64, 13), (256, 64), (1 shl fftFourStepThreshold, 3)]:
+    let fftDesc = createFFTDescriptor(F, order)
+    var cachedDesc = createFFTDescriptor(F, order)
+    cachedDesc.precomputeCosetTwiddles(F.fromUint(5'u32), order)
+
+    var vals = newSeq[F](order*batchSize)
+    for i in 0 ..< vals.len:
+      vals[i] = rng.random_unsafe(F)
+
+    for layout in [kRowMajor, kColMajor]:
+      var expected_nr = newSeq[F](vals.len)
+      var expected_nn = newSeq[F](vals.len)
+      doAssert fft_nr_batch(fftDesc, expected_nr, vals, batchSize, layout) == FFT_Success
+      doAssert fft_nn_batch(fftDesc, expected_nn, vals, batchSize, layout) == FFT_Success
+
+      var output_nr = newSeq[F](vals.len)
+      var output_nn = vals
+      doAssert tp.fft_nr_batch_parallel(fftDesc, output_nr, vals, batchSize, layout) == FFT_Success
+      doAssert tp.fft_nn_batch_parallel(fftDesc, output_nn, output_nn, batchSize, layout) == FFT_Success
+
+      for i in 0 ..< vals.len:
+        doAssert (expected_nr[i] == output_nr[i]).bool,
+          "Batch NR vs parallel batch NR mismatch at index " & $i & " (order=" & $order & ", layout=" & $layout & ")"
+        doAssert (expected_nn[i] == output_nn[i]).bool,
+          "Batch NN vs parallel batch NN mismatch at index " & $i & " (order=" & $order & ", layout=" & $layout & ")"
+
+      let cosetShift = F.fromUint(5'u32)
+      var expected_cnr = newSeq[F](vals.len)
+      var expected_cirn = newSeq[F](vals.len)
+      doAssert coset_fft_nr_batch(fftDesc, expected_cnr, vals, batchSize, cosetShift, layout) == FFT_Success
+      doAssert coset_ifft_rn_batch(fftDesc, expected_cirn, vals, batchSize, cosetShift, layout) == FFT_Success
+
+      var output_cnr = newSeq[F](vals.len)
+      var output_cirn = vals
+      doAssert tp.coset_fft_nr_batch_parallel(fftDesc, output_cnr, vals, batchSize, cosetShift, layout) == FFT_Success
+      doAssert tp.coset_ifft_rn_batch_parallel(fftDesc, output_cirn, output_cirn, batchSize, cosetShift, layout) == FFT_Success
+
+      for i in 0 ..< vals.len:
+        doAssert (expected_cnr[i] == output_cnr[i]).bool,
+          "Batch coset NR vs parallel batch coset NR mismatch at index " & $i & " (order=" & $order & ", layout=" & $layout & ")"
+        doAssert (expected_cirn[i] == output_cirn[i]).bool,
+          "Batch coset IFFT RN vs parallel batch coset IFFT RN mismatch at index " & $i & " (order=" & $order & ", layout=" & $layout & ")"
+
+      # Cached fused coset twiddles
+      var cached_cnr = newSeq[F](vals.len)
+      var cached_cirn = vals
+      doAssert tp.coset_fft_nr_batch_parallel(cachedDesc, cached_cnr, vals, batchSize, cosetShift, layout) == FFT_Success
+      doAssert tp.coset_ifft_rn_batch_parallel(cachedDesc, cached_cirn, cached_cirn, batchSize, cosetShift, layout) == FFT_Success
+
+      for i in 0 ..< vals.len:
+        doAssert (expected_cnr[i] == cached_cnr[i]).bool,
+          "Batch coset NR vs parallel cached batch coset NR mismatch at index " & $i & " (order=" & $order & ", layout=" & $layout & ")"
+        doAssert (expected_cirn[i] == cached_cirn[i]).bool,
+          "Batch coset IFFT RN vs parallel cached batch coset IFFT RN mismatch at index " & $i & " (order=" & $order & ", layout=" & $layout & ")"
+
+  echo "  ✓ Fr FFT batch: Parallel and serial batched FFTs produce identical results"
+
+when isMainModule:
+  let tp = Threadpool.new()
+
+  testFrFFTFourStepParallel(tp)
+  testFrFFTDispatchParallel(tp)
+  testFrFFTBatchParallel(tp)
+
+  tp.shutdown()
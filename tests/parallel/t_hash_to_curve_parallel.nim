@@ -0,0 +1,49 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel Batch Hash-to-Curve Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_hash_to_curve_parallel.nim
+
+import
+  constantine/named/algebras,
+  constantine/math/extension_fields,
+  constantine/math/ec_shortweierstrass,
+  constantine/hash_to_curve/hash_to_curve_parallel,
+  constantine/hashes,
+  constantine/threadpool/threadpool,
+  helpers/prng_unsafe
+
+proc testParallelHashToCurve[EC: EC_ShortW_Aff](tp: Threadpool, rng: var RngState, curve: typedesc[EC]) =
+  echo "Testing parallel batch hash-to-curve for ", $EC.F.Name, " ", $EC.G, "..."
+
+  for n in [0, 1, 7, 100]:
+    var msgs = newSeq[seq[byte]](n)
+    for i in 0 ..< n:
+      msgs[i] = rng.random_byte_seq(int rng.random_unsafe(100))
+
+    var expected = newSeq[EC](n)
+    var points = newSeq[EC](n)
+    sha256.hashToCurve_batch(128, expected, msgs, "H2C-CONSTANTINE-TESTSUITE")
+    tp.hashToCurve_batch_parallel(sha256, 128, points, msgs, "H2C-CONSTANTINE-TESTSUITE")
+    for i in 0 ..< n:
+      doAssert bool(points[i] == expected[i]),
+        "Parallel batch hash-to-curve failed for message " & $i
+
+  echo "  ✓ Parallel batch hash-to-curve PASSED"
+
+when isMainModule:
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  let tp = Threadpool.new()
+  tp.testParallelHashToCurve(rng, EC_ShortW_Aff[Fp[BLS12_381], G1])
+  tp.testParallelHashToCurve(rng, EC_ShortW_Aff[Fp2[BLS12_381], G2])
+  tp.testParallelHashToCurve(rng, EC_ShortW_Aff[Fp[BN254_Snarks], G1])
+  tp.shutdown()
@@ -0,0 +1,50 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel SHA256 Merkle Tree Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_merkle_sha256_parallel.nim
+
+import
+  constantine/hashes/merkle/merkle_sha256_parallel,
+  constantine/threadpool/threadpool,
+  helpers/prng_unsafe
+
+proc random_chunks(rng: var RngState, n: int): seq[array[32, byte]] =
+  result.setLen(n)
+  for i in 0 ..< n:
+    for j in 0 ..< 32:
+      result[i][j] = byte rng.next()
+
+proc testParallelMerkle(tp: Threadpool, rng: var RngState) =
+  echo "Testing parallel SHA256 Merkle trees..."
+
+  for n in [0, 1, 5, 2*merkleParallelMinPairs - 1, 4*merkleParallelMinPairs + 3, 100_000]:
+    let chunks = rng.random_chunks(n)
+    for limit in [-1, 1 shl 20]:
+      var expected, root: array[32, byte]
+      doAssert expected.merkleize(chunks, limit) == Merkle_Success
+      doAssert tp.merkleize_parallel(root, chunks, limit) == Merkle_Success
+      doAssert root == expected,
+        "Parallel merkleize failed for " & $n & " chunks and limit " & $limit
+
+      var tree: MerkleTree
+      doAssert tp.init_parallel(tree, chunks, limit) == Merkle_Success
+      doAssert tree.root() == expected,
+        "Parallel tree construction failed for " & $n & " chunks and limit " & $limit
+
+  echo "  ✓ Parallel SHA256 Merkle trees PASSED"
+
+when isMainModule:
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  let tp = Threadpool.new()
+  tp.testParallelMerkle(rng)
+  tp.shutdown()
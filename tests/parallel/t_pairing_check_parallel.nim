@@ -0,0 +1,121 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel Multi-Pairing Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_pairing_check_parallel.nim
+
+import
+  # Standard library
+  std/times,
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/math/[arithmetic, extension_fields, ec_shortweierstrass],
+  constantine/named/algebras,
+  constantine/math/pairings/[
+    pairings_generic, pairings_generic_parallel,
+    pairings_bw6_761, pairings_bw6_761_parallel],
+  constantine/threadpool,
+  # Test utilities
+  helpers/prng_unsafe
+
+var rng: RngState
+let timeseed = uint32(toUnix(getTime()) and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+seed(rng, timeseed)
+echo "\n------------------------------------------------------\n"
+echo "t_pairing_check_parallel xoshiro512** seed: ", timeseed
+
+proc testMultiPairingParallel(tp: Threadpool, Name: static Algebra) =
+  echo "Testing parallel multi-pairing vs serial for ", $Name, "..."
+
+  for N in [1, 2, 7, 8, 9, 33, 100]:
+    var Ps = newSeq[EC_ShortW_Aff[Fp[Name], G1]](N)
+    var Qs = newSeq[EC_ShortW_Aff[Fp2[Name], G2]](N)
+
+    for i in 0 ..< N:
+      Ps[i] = rng.random_unsafe(EC_ShortW_Aff[Fp[Name], G1])
+      Qs[i] = rng.random_unsafe(EC_ShortW_Aff[Fp2[Name], G2])
+
+    var expected {.noInit.}, gt {.noInit.}: Name.getGT()
+    expected.pairing(Ps, Qs)
+    tp.pairing_parallel(gt, Ps, Qs)
+    doAssert bool(expected == gt), "Multi-pairing mismatch (N=" & $N & ")"
+
+    # e(P₀, Q₀) ... e(Pₙ₋₁, Qₙ₋₁) . e(-P₀, Q₀) ... e(-Pₙ₋₁, Qₙ₋₁) == 1
+    # with a point at infinity inserted
+    var Ps2 = Ps
+    var Qs2 = Qs
+    for i in 0 ..< N:
+      var negP = Ps[i]
+      negP.neg()
+      Ps2.add negP
+      Qs2.add Qs[i]
+    var inf: EC_ShortW_Aff[Fp[Name], G1]
+    inf.setNeutral()
+    Ps2.add inf
+    Qs2.add Qs[0]
+
+    doAssert tp.pairing_check_parallel(Ps2, Qs2), "Pairing check failed (N=" & $N & ")"
+    doAssert not tp.pairing_check_parallel(Ps, Qs), "Pairing check succeeded on random pairs (N=" & $N & ")"
+
+  # Empty product is 1, mismatched lengths are rejected
+  block:
+    var Ps = newSeq[EC_ShortW_Aff[Fp[Name], G1]](0)
+    var Qs = newSeq[EC_ShortW_Aff[Fp2[Name], G2]](0)
+    doAssert tp.pairing_check_parallel(Ps, Qs), "Empty pairing check must succeed"
+    Qs.add rng.random_unsafe(EC_ShortW_Aff[Fp2[Name], G2])
+    doAssert not tp.pairing_check_parallel(Ps, Qs), "Mismatched lengths must be rejected"
+
+  echo "  ✓ ", $Name, ": Parallel and serial multi-pairings produce identical results"
+
+proc testFinalExpBatchParallel(tp: Threadpool, Name: static Algebra) =
+  echo "Testing parallel batched final exponentiation vs serial for ", $Name, "..."
+
+  for N in [1, 3, 8, 33]:
+    var fs = newSeq[Fp12[Name]](N)
+    var expected = newSeq[Fp12[Name]](N)
+    for i in 0 ..< N:
+      fs[i] = rng.random_unsafe(Fp12[Name])
+      expected[i] = fs[i]
+      expected[i].finalExp()
+
+    tp.finalExp_batch_parallel(fs)
+    for i in 0 ..< N:
+      doAssert bool(expected[i] == fs[i]), "Batched final exponentiation mismatch (N=" & $N & ", i=" & $i & ")"
+
+  echo "  ✓ ", $Name, ": Parallel batched and serial final exponentiations produce identical results"
+
+proc testBW6_761MultiPairingParallel(tp: Threadpool) =
+  echo "Testing parallel multi-pairing vs serial for BW6_761..."
+
+  for N in [1, 2, 7, 9]:
+    var Ps = newSeq[EC_ShortW_Aff[Fp[BW6_761], G1]](N)
+    var Qs = newSeq[EC_ShortW_Aff[Fp[BW6_761], G2]](N)
+
+    for i in 0 ..< N:
+      Ps[i] = rng.random_unsafe(EC_ShortW_Aff[Fp[BW6_761], G1])
+      Qs[i] = rng.random_unsafe(EC_ShortW_Aff[Fp[BW6_761], G2])
+
+    var expected {.noInit.}, gt {.noInit.}: Fp6[BW6_761]
+    expected.pairing_bw6_761(Ps, Qs)
+    tp.pairing_bw6_761_parallel(gt, Ps, Qs)
+    doAssert bool(expected == gt), "BW6_761 multi-pairing mismatch (N=" & $N & ")"
+
+  echo "  ✓ BW6_761: Parallel and serial multi-pairings produce identical results"
+
+when isMainModule:
+  let tp = Threadpool.new()
+
+  tp.testMultiPairingParallel(BN254_Snarks)
+  tp.testMultiPairingParallel(BLS12_381)
+  tp.testFinalExpBatchParallel(BN254_Snarks)
+  tp.testFinalExpBatchParallel(BLS12_381)
+  tp.testBW6_761MultiPairingParallel()
+
+  tp.shutdown()
@@ -0,0 +1,102 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+# Parallel Polynomials Tests
+#
+# Compile and run with:
+#   nim c -r -d:release --threads:on --hints:off --warnings:off --outdir:build/tmp --nimcache:nimcache/tmp tests/parallel/t_polynomials_parallel.nim
+
+import
+  std/times,
+  constantine/named/algebras,
+  constantine/math/arithmetic,
+  constantine/math/polynomials/polynomials_parallel,
+  constantine/threadpool/threadpool,
+  helpers/prng_unsafe,
+  ../math_polynomials/fft_utils
+
+type
+  F = Fr[BLS12_381]
+
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "\n------------------------------------------------------\n"
+echo "t_polynomials_parallel xoshiro512** seed: ", seed
+
+proc testSubproductTreeParallel(tp: Threadpool) =
+  echo "Testing parallel subproduct tree build vs serial..."
+
+  let fftDesc = createFFTDescriptor(F, 1 shl 12)
+
+  for n in [1, 3, 64, 257, 1000]:
+    var points = newSeq[F](n)
+    for i in 0 ..< n:
+      points[i] = rng.random_unsafe(F)
+
+    var treeSerial, treeParallel: SubproductTree[F]
+    treeSerial.init(points, fftDesc)
+    tp.init_parallel(treeParallel, points, fftDesc)
+
+    let mS = treeSerial.vanishingPoly()
+    let mP = treeParallel.vanishingPoly()
+    for i in 0 .. n:
+      doAssert bool(mS[i] == mP[i]),
+        "Vanishing polynomial mismatch at index " & $i & " (n=" & $n & ")"
+
+    var values = newSeq[F](n)
+    for i in 0 ..< n:
+      values[i] = rng.random_unsafe(F)
+
+    var coefs = newSeq[F](n)
+    treeParallel.interpolate(coefs, values, fftDesc)
+
+    var evals = newSeq[F](n)
+    treeParallel.multipointEval(evals, coefs, fftDesc)
+    for i in 0 ..< n:
+      doAssert bool(evals[i] == values[i]),
+        "Interpolation round-trip mismatch at index " & $i & " (n=" & $n & ")"
+
+  echo "  ✓ Subproduct tree: Parallel and serial builds produce identical results"
+
+proc testBatchedEvalParallel(tp: Threadpool) =
+  echo "Testing parallel batched barycentric evaluation vs serial..."
+
+  const N = 256
+  let domain = F.computeRootsOfUnity(N)
+
+  for (M, K) in [(1, 1), (4, 13), (17, 3)]:
+    var polys = newSeq[PolynomialEval[N, F, kNaturalOrder]](M)
+    for m in 0 ..< M:
+      for i in 0 ..< N:
+        polys[m].evals[i] = rng.random_unsafe(F)
+
+    var zs = newSeq[F](K)
+    for k in 0 ..< K:
+      zs[k] = rng.random_unsafe(F)
+    zs[0] = domain.rootsOfUnity[N-1]
+
+    var expected = newSeq[F](M*K)
+    domain.evalPolysAt(expected, polys, zs)
+
+    var r = newSeq[F](M*K)
+    tp.evalPolysAt_parallel(domain, r, polys, zs)
+
+    for i in 0 ..< M*K:
+      doAssert bool(r[i] == expected[i]),
+        "Batched evaluation mismatch at index " & $i & " (M=" & $M & ", K=" & $K & ")"
+
+  echo "  ✓ Batched evaluation: Parallel and serial produce identical results"
+
+when isMainModule:
+  let tp = Threadpool.new()
+
+  testSubproductTreeParallel(tp)
+  testBatchedEvalParallel(tp)
+
+  tp.shutdown()
@@ -0,0 +1,142 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  std/[unittest, times],
+  constantine/ciphers/aead_chacha20_poly1305,
+  helpers/prng_unsafe
+
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "\n------------------------------------------------------\n"
+echo "chacha20-poly1305 xoshiro512** seed: ", seed
+
+suite "[AEAD] ChaCha20-Poly1305":
+  test "Test vector 1 - RFC8439 §2.8.2":
+    let plaintext = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for the future, sunscreen would be it."
+    let aad = [byte 0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7]
+    let key = [
+      byte 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+           0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+           0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+           0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+    ]
+    let nonce = [byte 0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47]
+    let ciphertext = [
+      byte 0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2,
+           0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe, 0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6,
+           0x3d, 0xbe, 0xa4, 0x5e, 0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+           0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36,
+           0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c, 0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58,
+           0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+           0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce, 0xc6, 0x4b,
+           0x61, 0x16
+    ]
+    let expectedTag = [
+      byte 0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a,
+           0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91
+    ]
+
+    var data = newSeq[byte](plaintext.len)
+    copyMem(data[0].addr, plaintext[0].unsafeAddr, plaintext.len)
+
+    var tag: array[16, byte]
+    chacha20poly1305.seal(tag, data, key, nonce, aad)
+    doAssert data == ciphertext
+    doAssert tag == expectedTag
+
+    doAssert chacha20poly1305.open(data, tag, key, nonce, aad)
+    doAssert data == cast[seq[byte]](plaintext)
+
+  test "Forgeries are rejected":
+    var key: array[32, byte]
+    var nonce: array[12, byte]
+    for i in 0 ..< key.len:
+      key[i] = byte(rng.next() and 0xFF)
+    for i in 0 ..< nonce.len:
+      nonce[i] = byte(rng.next() and 0xFF)
+
+    let plaintext = rng.random_byte_seq(300)
+    let aad = rng.random_byte_seq(20)
+
+    var ciphertext = plaintext
+    var tag: array[16, byte]
+    chacha20poly1305.seal(tag, ciphertext, key, nonce, aad)
+
+    block: # Tampered ciphertext
+      var data = ciphertext
+      data[137] = data[137] xor 1
+      doAssert not chacha20poly1305.open(data, tag, key, nonce, aad)
+      doAssert data == newSeq[byte](data.len), "Unauthenticated plaintext must be wiped"
+
+    block: # Tampered tag
+      var data = ciphertext
+      var badTag = tag
+      badTag[15] = badTag[15] xor 0x80
+      doAssert not chacha20poly1305.open(data, badTag, key, nonce, aad)
+
+    block: # Tampered AAD
+      var data = ciphertext
+      var badAad = aad
+      badAad[0] = badAad[0] xor 1
+      doAssert not chacha20poly1305.open(data, tag, key, nonce, badAad)
+
+    block: # Genuine
+      var data = ciphertext
+      doAssert chacha20poly1305.open(data, tag, key, nonce, aad)
+      doAssert data == plaintext
+
+  test "Streaming matches one-shot":
+    # Lengths straddle the ChaCha20 multi-block kernels,
+    # the 4-way Poly1305 and the 4KiB interleaving chunks.
+    for len in [0, 1, 15, 16, 63, 64, 65, 255, 256, 257, 511, 512, 1000, 4095, 4096, 4097, 10000]:
+      var key: array[32, byte]
+      var nonce: array[12, byte]
+      for i in 0 ..< key.len:
+        key[i] = byte(rng.next() and 0xFF)
+      for i in 0 ..< nonce.len:
+        nonce[i] = byte(rng.next() and 0xFF)
+
+      let plaintext = rng.random_byte_seq(len)
+      let aad = rng.random_byte_seq(int(rng.random_unsafe(40)))
+
+      var expected = plaintext
+      var expectedTag: array[16, byte]
+      chacha20poly1305.seal(expectedTag, expected, key, nonce, aad)
+
+      # Seal by random chunks
+      var data = plaintext
+      var ctx: chacha20poly1305
+      ctx.init(key, nonce)
+      var pos = 0
+      while pos < aad.len:
+        let chunk = 1 + int(rng.random_unsafe(8))
+        ctx.updateAAD(aad.toOpenArray(pos, min(pos+chunk, aad.len)-1))
+        pos += chunk
+      pos = 0
+      while pos < len:
+        let chunk = 1 + int(rng.random_unsafe(700))
+        ctx.sealUpdate(data.toOpenArray(pos, min(pos+chunk, len)-1))
+        pos += chunk
+      var tag: array[16, byte]
+      ctx.sealFinish(tag)
+
+      doAssert data == expected, "Ciphertext mismatch for length " & $len
+      doAssert tag == expectedTag, "Tag mismatch for length " & $len
+
+      # Open by random chunks
+      ctx.init(key, nonce)
+      ctx.updateAAD(aad)
+      pos = 0
+      while pos < len:
+        let chunk = 1 + int(rng.random_unsafe(5000))
+        ctx.openUpdate(data.toOpenArray(pos, min(pos+chunk, len)-1))
+        pos += chunk
+      doAssert ctx.openFinish(tag), "Authentication failure for length " & $len
+      doAssert data == plaintext, "Plaintext mismatch for length " & $len
@@ -7,8 +7,15 @@
 # at your option. This file may not be copied, modified, or distributed except according to those terms.
 
 import
-  std/unittest,
-  constantine/ciphers/chacha20
+  std/[unittest, times],
+  constantine/ciphers/chacha20,
+  helpers/prng_unsafe
+
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "\n------------------------------------------------------\n"
+echo "chacha20 xoshiro512** seed: ", seed
 
 suite "[Cipher] Chacha20":
   test "Test vector 1 - RFC8439":
@@ -41,3 +48,36 @@ suite "[Cipher] Chacha20":
 
     discard chacha20_cipher(key, counter = 1, nonce, data)
     doAssert data == cast[seq[byte]](plaintext)
+
+  test "Multi-block keystream matches block-by-block keystream":
+    # Messages of 512 bytes or more use the 8-block AVX2
+    # and 16-block AVX512 kernels when available.
+    # Each 64-byte block is processed by the scalar path.
+    var key: array[32, byte]
+    var nonce: array[12, byte]
+    for i in 0 ..< key.len:
+      key[i] = byte(rng.next() and 0xFF)
+    for i in 0 ..< nonce.len:
+      nonce[i] = byte(rng.next() and 0xFF)
+
+    for len in [0, 1, 63, 64, 65, 511, 512, 513, 1023, 1024, 1025, 1600, 2047, 2048, 5000]:
+      # The counter may wrap around
+      for counter in [0'u32, 1, 0xFFFFFFF5'u32, uint32(rng.next() and 0xFFFFFFFF'u64)]:
+        let plaintext = rng.random_byte_seq(len)
+
+        var data = plaintext
+        let ctr = chacha20_cipher(key, counter, nonce, data)
+        doAssert ctr == counter + uint32((len + 63) div 64)
+
+        var expected = plaintext
+        var pos = 0
+        var blockCounter = counter
+        while pos < len:
+          blockCounter = chacha20_cipher(key, blockCounter, nonce, expected.toOpenArray(pos, min(pos+64, len)-1))
+          pos += 64
+        doAssert data == expected, "Mismatch for length " & $len & " and counter " & $counter
+
+        var keystream = newSeq[byte](len)
+        discard chacha20_keystream(key, counter, nonce, keystream)
+        for i in 0 ..< len:
+          doAssert keystream[i] == (plaintext[i] xor data[i])
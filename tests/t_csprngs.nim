@@ -8,7 +8,8 @@
 
 import
   std/unittest,
-  constantine/csprngs/sysrand
+  constantine/csprngs/[sysrand, csprng_chacha20],
+  constantine/ciphers/chacha20
 
 suite "[CSPRNG] sysrand":
   test "Non-nil initialization":
@@ -29,3 +30,92 @@ suite "[CSPRNG] sysrand":
   # TODO:
   # - Hamming weight average 50%
   # - statistics/hypothesis tests
+
+suite "[CSPRNG] ChaCha20 with fast key erasure":
+  const seed = block:
+    var s: array[32, byte]
+    for i in 0 ..< s.len:
+      s[i] = byte(i*7 + 3)
+    s
+  const zeroNonce = default(array[12, byte])
+
+  test "Buffered output is the keystream after the next key":
+    var rng: ChaCha20Csprng
+    rng.seed(seed)
+
+    var keystream: array[2048, byte]
+    discard chacha20_keystream(seed, counter = 0, zeroNonce, keystream.toOpenArray(0, 1023))
+    var nextKey: array[32, byte]
+    for i in 0 ..< 32:
+      nextKey[i] = keystream[i]
+    discard chacha20_keystream(nextKey, counter = 0, zeroNonce, keystream.toOpenArray(1024, 2047))
+
+    # Small requests are served from the buffer, in order,
+    # across a refill with the rotated key.
+    var output: array[992 + 992, byte]
+    var pos = 0
+    for len in [1, 7, 32, 100, 500, 352, 992]:
+      rng.fill(output.toOpenArray(pos, pos+len-1))
+      pos += len
+    doAssert pos == output.len
+
+    doAssert output.toOpenArray(0, 991) == keystream.toOpenArray(32, 1023)
+    doAssert output.toOpenArray(992, 1983) == keystream.toOpenArray(1024+32, 2047)
+
+  test "Bulk output is the keystream from block 1":
+    var rng: ChaCha20Csprng
+    rng.seed(seed)
+
+    var output = newSeq[byte](5000)
+    rng.fill(output)
+
+    var expected = newSeq[byte](5000)
+    discard chacha20_keystream(seed, counter = 1, zeroNonce, expected)
+    doAssert output == expected
+
+    # The following output uses the key from block 0
+    var nextKey: array[32, byte]
+    discard chacha20_keystream(seed, counter = 0, zeroNonce, nextKey)
+    var keystream: array[64, byte]
+    discard chacha20_keystream(nextKey, counter = 0, zeroNonce, keystream)
+    var next32: array[32, byte]
+    rng.fill(next32)
+    doAssert next32 == keystream.toOpenArray(32, 63)
+
+  test "Filling machine words":
+    var rng: ChaCha20Csprng
+    rng.seed(seed)
+    var words = newSeq[uint64](1000)
+    rng.fill(words)
+
+    var bytes = newSeq[byte](8000)
+    var rng2: ChaCha20Csprng
+    rng2.seed(seed)
+    rng2.fill(bytes)
+    doAssert equalMem(words[0].addr, bytes[0].addr, 8000)
+
+  test "Forked generators are independent":
+    var rng: ChaCha20Csprng
+    doAssert rng.init()
+
+    var children: array[4, ChaCha20Csprng]
+    rng.fork(children)
+
+    var outputs: array[5, array[64, byte]]
+    rng.fill(outputs[4])
+    for i in 0 ..< 4:
+      children[i].fill(outputs[i])
+    for i in 0 ..< 5:
+      for j in i+1 ..< 5:
+        doAssert outputs[i] != outputs[j]
+
+  test "Reseeding changes the stream":
+    var rng1, rng2: ChaCha20Csprng
+    rng1.seed(seed)
+    rng2.seed(seed)
+    doAssert rng2.reseed()
+
+    var out1, out2: array[64, byte]
+    rng1.fill(out1)
+    rng2.fill(out2)
+    doAssert out1 != out2
@@ -113,6 +113,23 @@ proc test3 =
   doAssert bool  eChild.fromDecimal(expectedChild)
   doAssert bool(child == eChild)
 
+proc testBatch =
+  let seed = toBytes"0x3141592653589793238462643383279502884197169399375105820974944592"
+  let indices = [0'u32, 1, 42, 3141592653'u32, 4294967295'u32]
+
+  var master: SecretKey
+  doAssert master.derive_master_secretKey(seed)
+
+  var children: array[indices.len, SecretKey]
+  doAssert children.derive_child_secretKeys(master, indices)
+  for i in 0 ..< indices.len:
+    var child: SecretKey
+    doAssert child.derive_child_secretKey(master, indices[i])
+    doAssert bool(children[i] == child)
+
+  var tooFew: array[2, SecretKey]
+  doAssert not tooFew.derive_child_secretKeys(master, indices)
+
 suite "Key Derivation (EIP-2333)":
   test "Test 0":
     test0()
@@ -122,3 +139,5 @@ suite "Key Derivation (EIP-2333)":
     test2()
   test "Test 3":
     test3()
+  test "Batch child derivation":
+    testBatch()
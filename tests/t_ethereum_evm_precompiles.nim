@@ -164,6 +164,9 @@ proc testRipemd160() =
 testSha256()
 testRipemd160()
 
+runPrecompileTests("blake2F.json", eth_evm_blake2f, 64)
+runPrecompileTests("fail-blake2f.json", eth_evm_blake2f, 64)
+
 runPrecompileTests("modexp.json", eth_evm_modexp, 0)
 runPrecompileTests("modexp_eip2565.json", eth_evm_modexp, 0)
 
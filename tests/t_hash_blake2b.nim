@@ -0,0 +1,105 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/hashes,
+  constantine/hashes/blake2b/blake2b_generic,
+  constantine/platforms/abstractions,
+  constantine/serialization/codecs,
+  # Helpers
+  helpers/prng_unsafe
+
+when UseASM_X86_32:
+  import constantine/hashes/blake2b/blake2b_x86_avx2
+
+# Test cases
+# --------------------------------------------------------------------
+
+proc sanityTestVectors() =
+  ## Test vectors from:
+  ## https://www.rfc-editor.org/rfc/rfc7693#appendix-A
+  ## https://en.wikipedia.org/wiki/BLAKE_(hash_function)#BLAKE2b_algorithm
+  let vectors = {
+    "":    "0x786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce",
+    "abc": "0xba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923",
+  }
+
+  for (input, digest) in vectors:
+    let exp = array[64, byte].fromHex(digest)
+    var dgst: array[64, byte]
+    blake2b.hash(dgst, input)
+    doAssert dgst == exp, "Test failed for message \"" & input & "\""
+
+proc chunkTest(rng: var RngState, sizeRange: Slice[int]) =
+  ## Incremental hashing must not depend on how the message is split,
+  ## in particular at block boundaries.
+  let size = rng.random_unsafe(sizeRange)
+  let msg = rng.random_byte_seq(size)
+
+  var bufOnePass: array[64, byte]
+  blake2b.hash(bufOnePass, msg)
+
+  for chunkSize in [1, 7, 127, 128, 129, 256]:
+    var bufChunked: array[64, byte]
+    var ctx: Blake2bContext
+    ctx.init()
+    var cur = 0
+    while cur < size:
+      let len = min(chunkSize, size - cur)
+      ctx.update(msg.toOpenArray(cur, cur+len-1))
+      cur += len
+    ctx.finish(bufChunked)
+    doAssert bufOnePass == bufChunked, "Test failed with message of length " & $size & " and chunks of size " & $chunkSize
+
+when UseASM_X86_32:
+  proc compressTest(rng: var RngState) =
+    ## Compare the AVX2 compression function against the generic one
+    ## for arbitrary number of rounds
+    var h0: array[8, uint64]
+    var m: Blake2b_MessageWords
+    for i in 0 ..< 8:
+      h0[i] = rng.next()
+    for i in 0 ..< 16:
+      m[i] = rng.next()
+    let t0 = rng.next()
+    let t1 = rng.next()
+    let lastBlock = rng.random_unsafe(0 .. 1) == 1
+
+    for rounds in [0'u32, 1, 9, 10, 11, 12, 20, 1000]:
+      var hGeneric = h0
+      var hAvx2 = h0
+      blake2b_compress_generic(hGeneric, m, t0, t1, lastBlock, rounds)
+      blake2b_compress_avx2(hAvx2, m, t0, t1, lastBlock, rounds)
+      doAssert hGeneric == hAvx2, "AVX2 compression mismatch with " & $rounds & " rounds"
+
+# --------------------------------------------------------------------
+
+proc main() =
+  echo "\n------------------------------------------------------\n"
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  echo "BLAKE2b - sanity checks"
+  sanityTestVectors()
+
+  echo "BLAKE2b - incremental hashing"
+  for _ in 0 ..< 64:
+    rng.chunkTest(0 .. 1000)
+
+  when UseASM_X86_32:
+    if hasAvx2():
+      echo "BLAKE2b - AVX2 vs generic compression"
+      for _ in 0 ..< 64:
+        rng.compressTest()
+    else:
+      echo "BLAKE2b - AVX2 vs generic compression [SKIPPED]"
+
+  echo "BLAKE2b - SUCCESS"
+
+main()
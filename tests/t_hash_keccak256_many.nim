@@ -0,0 +1,133 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/hashes,
+  constantine/platforms/abstractions,
+  # Helpers
+  helpers/prng_unsafe
+
+when UseASM_X86_32:
+  import
+    constantine/platforms/isa_x86/cpudetect_x86,
+    constantine/hashes/keccak/[
+      keccak_x86_avx2_x4,
+      keccak_x86_avx512_x8]
+
+# Multi-buffer Keccak256 vs one message at a time
+# --------------------------------------------------------------------
+#
+# `hashMany` picks the widest SIMD kernel available
+# so the narrower kernels are also tested directly
+# whenever the CPU supports them.
+
+const MsgLens = [0, 1, 32, 64, 135, 136, 137, 271, 272, 273, 500, 1000]
+
+proc hashOneByOne(H: typedesc, digests: var seq[array[32, byte]], messages: seq[seq[byte]]) =
+  digests.setLen(messages.len)
+  for i in 0 ..< messages.len:
+    H.hash(digests[i], messages[i])
+
+proc testHashMany(H: typedesc, rng: var RngState, msgLen, numMessages: int) =
+  let messages = rng.random_byte_seq(msgLen*numMessages)
+
+  var split = newSeq[seq[byte]](numMessages)
+  for i in 0 ..< numMessages:
+    split[i] = messages[i*msgLen ..< (i+1)*msgLen]
+
+  var expected: seq[array[32, byte]]
+  H.hashOneByOne(expected, split)
+
+  var digests = newSeq[array[32, byte]](numMessages)
+  if numMessages > 0:
+    H.hashMany(digests.asUnchecked(), messages.asUnchecked(), msgLen, numMessages)
+  doAssert digests == expected, "hashMany failed for " & $numMessages & " messages of length " & $msgLen
+
+  if msgLen > 0:
+    var digests2 = newSeq[array[32, byte]](numMessages)
+    H.hashMany(digests2, messages)
+    doAssert digests2 == expected, "hashMany (openArray) failed for " & $numMessages & " messages of length " & $msgLen
+
+proc testHashManyVarLen(H: typedesc, rng: var RngState, numMessages: int) =
+  var messages = newSeq[seq[byte]](numMessages)
+  var ptrs = newSeq[ptr UncheckedArray[byte]](numMessages)
+  var lens = newSeq[int](numMessages)
+  for i in 0 ..< numMessages:
+    lens[i] = rng.random_unsafe(0 .. 600)
+    messages[i] = rng.random_byte_seq(lens[i])
+    ptrs[i] = if lens[i] == 0: nil else: messages[i].asUnchecked()
+
+  var expected: seq[array[32, byte]]
+  H.hashOneByOne(expected, messages)
+
+  var digests = newSeq[array[32, byte]](numMessages)
+  H.hashMany(digests.asUnchecked(), ptrs.asUnchecked(), lens.asUnchecked(), numMessages)
+  doAssert digests == expected, "hashMany (variable-length) failed for " & $numMessages & " messages"
+
+when UseASM_X86_32:
+  template testKernel(H: typedesc, rng: var RngState, Lanes: static int, delimiter: byte, kernel: untyped) =
+    var messages: array[Lanes, seq[byte]]
+    var dsts: array[Lanes, ptr array[32, byte]]
+    var msgs: array[Lanes, ptr UncheckedArray[byte]]
+    var lens: array[Lanes, int]
+    var digests: array[Lanes, array[32, byte]]
+    for l in 0 ..< Lanes:
+      lens[l] = MsgLens[rng.random_unsafe(0 ..< MsgLens.len)]
+      messages[l] = rng.random_byte_seq(lens[l])
+      msgs[l] = if lens[l] == 0: nil else: messages[l].asUnchecked()
+      dsts[l] = digests[l].addr
+
+    var expected: seq[array[32, byte]]
+    H.hashOneByOne(expected, @messages)
+
+    kernel(dsts, msgs, lens, delimiter)
+    doAssert @digests == expected, astToStr(kernel) & " failed for messages of lengths " & $lens
+
+# --------------------------------------------------------------------
+
+proc main() =
+  echo "\n------------------------------------------------------\n"
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  echo "Keccak256 - hashMany vs one message at a time"
+  for msgLen in MsgLens:
+    for numMessages in [0, 1, 3, 4, 5, 8, 9, 13, 16, 17]:
+      keccak256.testHashMany(rng, msgLen, numMessages)
+
+  echo "SHA3-256 - hashMany vs one message at a time"
+  for msgLen in MsgLens:
+    for numMessages in [1, 4, 8, 13]:
+      sha3_256.testHashMany(rng, msgLen, numMessages)
+
+  echo "Keccak256 - hashMany variable-length vs one message at a time"
+  for numMessages in [0, 1, 4, 7, 8, 12, 31]:
+    keccak256.testHashManyVarLen(rng, numMessages)
+    sha3_256.testHashManyVarLen(rng, numMessages)
+
+  when UseASM_X86_32:
+    if hasAvx2():
+      echo "Keccak256 - AVX2 4 lanes"
+      for _ in 0 ..< 32:
+        keccak256.testKernel(rng, 4, 0x01, hashMessages_avx2_x4)
+        sha3_256.testKernel(rng, 4, 0x06, hashMessages_avx2_x4)
+    else:
+      echo "Keccak256 - AVX2 4 lanes [SKIPPED]"
+
+    if hasAvx512f():
+      echo "Keccak256 - AVX512 8 lanes"
+      for _ in 0 ..< 32:
+        keccak256.testKernel(rng, 8, 0x01, hashMessages_avx512_x8)
+        sha3_256.testKernel(rng, 8, 0x06, hashMessages_avx512_x8)
+    else:
+      echo "Keccak256 - AVX512 8 lanes [SKIPPED]"
+
+  echo "Keccak256 - multi-buffer - SUCCESS"
+
+main()
@@ -0,0 +1,131 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/platforms/abstractions,
+  constantine/named/algebras,
+  constantine/math/arithmetic,
+  constantine/math/io/io_fields,
+  constantine/hashes/poseidon2/poseidon2,
+  # Helpers
+  helpers/prng_unsafe
+
+# Poseidon2 test vectors
+# --------------------------------------------------------------------
+#
+# - permutation of [0, 1, ..., t-1]
+#   from https://github.com/HorizenLabs/poseidon2 for BN254 and Goldilocks
+# - permutation of [0, 1, ..., t-1] for BLS12-381 and of [-1, -1, ..., -1] for all instances
+#   from sage/derive_poseidon2.sage
+
+proc eq[N: static int, F](a, b: array[N, F]): bool =
+  for i in 0 ..< N:
+    if not bool(a[i] == b[i]):
+      return false
+  return true
+
+proc fromHex[N: static int](F: typedesc, hexes: array[N, string]): array[N, F] =
+  for i in 0 ..< N:
+    result[i].fromHex(hexes[i])
+
+proc testKAT[N: static int](F: typedesc, expectedIota, expectedMinusOne: array[N, string]) =
+  var state: array[N, F]
+  for i in 0 ..< N:
+    state[i].fromUint(uint64 i)
+  poseidon2.permute(state)
+  doAssert eq(state, F.fromHex(expectedIota)), "Poseidon2 KAT [0, 1, ...] failure for " & $F.Name
+
+  for i in 0 ..< N:
+    state[i].setMinusOne()
+  poseidon2.permute(state)
+  doAssert eq(state, F.fromHex(expectedMinusOne)), "Poseidon2 KAT [-1, -1, ...] failure for " & $F.Name
+
+proc testBatch(rng: var RngState, F: typedesc) =
+  const N = poseidon2.width(F)
+  const D = poseidon2.digestLen(F)
+
+  for n in [0, 1, 3, 4, 5, 9, 16]:
+    var states = newSeq[array[N, F]](n)
+    var expected = newSeq[array[N, F]](n)
+    for i in 0 ..< n:
+      for j in 0 ..< N:
+        states[i][j] = rng.random_unsafe(F)
+      expected[i] = states[i]
+      poseidon2.permute(expected[i])
+
+    poseidon2.permuteMany(states)
+    for i in 0 ..< n:
+      doAssert eq(states[i], expected[i]), "Poseidon2 permuteMany failure for " & $F.Name
+
+  for n in [0, 1, 3, 4, 5, 9, 16]:
+    var children = newSeq[array[D, F]](2*n)
+    for i in 0 ..< 2*n:
+      for j in 0 ..< D:
+        children[i][j] = rng.random_unsafe(F)
+
+    var expected = newSeq[array[D, F]](n)
+    for i in 0 ..< n:
+      var s: array[N, F]
+      for j in 0 ..< D:
+        s[j] = children[2*i][j]
+        s[D+j] = children[2*i+1][j]
+      poseidon2.permute(s)
+      for j in 0 ..< D:
+        expected[i][j] = s[j]
+
+      var digest: array[D, F]
+      poseidon2.compress(digest, children[2*i], children[2*i+1])
+      doAssert eq(digest, expected[i]), "Poseidon2 compress failure for " & $F.Name
+
+    var parents = newSeq[array[D, F]](n)
+    poseidon2.compressMany(parents, children)
+    for i in 0 ..< n:
+      doAssert eq(parents[i], expected[i]), "Poseidon2 compressMany failure for " & $F.Name
+
+    # In-place Merkle level
+    if n > 0:
+      poseidon2.compressMany(children.asUnchecked(), children.asUnchecked(), n)
+      for i in 0 ..< n:
+        doAssert eq(children[i], expected[i]), "Poseidon2 in-place compressMany failure for " & $F.Name
+
+# --------------------------------------------------------------------
+
+proc main() =
+  echo "\n------------------------------------------------------\n"
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  echo "Poseidon2 - test vectors"
+  testKAT(Fr[BN254_Snarks],
+    ["0x0bb61d24daca55eebcb1929a82650f328134334da98ea4f847f760054f4a3033",
+     "0x303b6f7c86d043bfcbcc80214f26a30277a15d3f74ca654992defe7ff8d03570",
+     "0x1ed25194542b12eef8617361c3ba7c52e660b145994427cc86296242cf766ec8"],
+    ["0x2cb3ba164e837aade429a17d6b9929a676625e975f2ace88f62e7fd795009256",
+     "0x094bd6ebeca478509efc011dc7bc259b0fd27e79fa0b98cf8200ec76061155e8",
+     "0x1cf5120535e49dec450e16fcbfdbd40b4cf35fbcb03560d5531adffa51db3ddc"])
+  testKAT(Fr[BLS12_381],
+    ["0x1b152349b1950b6a8ca75ee4407b6e26ca5cca5650534e56ef3fd45761fbf5f0",
+     "0x4c5793c87d51bdc2c08a32108437dc0000bd0275868f09ebc5f36919af5b3891",
+     "0x1fc8ed171e67902ca49863159fe5ba6325318843d13976143b8125f08b50dc6b"],
+    ["0x7152a530a21ae331808f58f1cb788b55b4fe96d76d2d09bfbe86e210901eb681",
+     "0x3397c0f744bc52cc01c68caeb33646368e061fd571d54926b33ea38413695b92",
+     "0x19d480131e31c787c971b555bf4d40d4d248448e40d9d46470234eea59a31048"])
+  testKAT(Fp[Goldilocks],
+    ["0xc5fb1cfe0b4697bb", "0x4a4a32ff849af473", "0xd2fd266077f8efba", "0xf4ad9b74e833916d",
+     "0xe6648eb0acc11463", "0x8d5529a930d75194", "0xe8c993aa10da6c90", "0xa73104a95b68031c"],
+    ["0x5caed410a9fd6849", "0x31151f18cf2b97fb", "0x0edda42264f38cda", "0xff14843277766957",
+     "0x6421bfe1b7a30c8d", "0xe64b19fa554471ad", "0x2da3087bf1b4a9ec", "0xbd4766960009480e"])
+
+  echo "Poseidon2 - batched permutations and Merkle compression"
+  rng.testBatch(Fr[BN254_Snarks])
+  rng.testBatch(Fr[BLS12_381])
+  rng.testBatch(Fp[Goldilocks])
+  echo "Poseidon2 - SUCCESS"
+
+main()
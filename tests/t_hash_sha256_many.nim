@@ -0,0 +1,122 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/hashes,
+  constantine/platforms/abstractions,
+  # Helpers
+  helpers/prng_unsafe
+
+when UseASM_X86_32:
+  import
+    constantine/platforms/isa_x86/cpudetect_x86,
+    constantine/hashes/sha256/[
+      sha256_x86_sse2_x4,
+      sha256_x86_avx2_x8,
+      sha256_x86_avx512_x16]
+
+# Multi-buffer SHA256 vs one message at a time
+# --------------------------------------------------------------------
+#
+# `hashMany` uses the SHA extensions when available
+# so the SIMD kernels are also tested directly
+# whenever the CPU supports them.
+
+const MsgLens = [0, 1, 32, 55, 56, 63, 64, 65, 119, 120, 128, 200, 1000]
+
+proc hashOneByOne(digests: var seq[array[32, byte]], messages: seq[byte], msgLen, numMessages: int) =
+  digests.setLen(numMessages)
+  for i in 0 ..< numMessages:
+    sha256.hash(digests[i], messages.toOpenArray(i*msgLen, (i+1)*msgLen-1))
+
+proc testHashMany(rng: var RngState, msgLen, numMessages: int) =
+  let messages = rng.random_byte_seq(msgLen*numMessages)
+
+  var expected: seq[array[32, byte]]
+  expected.hashOneByOne(messages, msgLen, numMessages)
+
+  var digests = newSeq[array[32, byte]](numMessages)
+  if numMessages > 0:
+    sha256.hashMany(digests.asUnchecked(), messages.asUnchecked(), msgLen, numMessages)
+  doAssert digests == expected, "hashMany failed for " & $numMessages & " messages of length " & $msgLen
+
+  if msgLen > 0:
+    var digests2 = newSeq[array[32, byte]](numMessages)
+    sha256.hashMany(digests2, messages)
+    doAssert digests2 == expected, "hashMany (openArray) failed for " & $numMessages & " messages of length " & $msgLen
+
+proc testSha256_x8(rng: var RngState, msgLen: int) =
+  let messages = rng.random_byte_seq(msgLen*8)
+
+  var expected: seq[array[32, byte]]
+  expected.hashOneByOne(messages, msgLen, 8)
+
+  var ptrs: array[8, ptr UncheckedArray[byte]]
+  for l in 0 ..< 8:
+    ptrs[l] = messages.asUnchecked() +% (l*msgLen)
+
+  var digests: array[8, array[32, byte]]
+  sha256_x8(digests, ptrs, msgLen)
+  doAssert @digests == expected, "sha256_x8 failed for messages of length " & $msgLen
+
+when UseASM_X86_32:
+  template testKernel(rng: var RngState, Lanes: static int, msgLen: int, kernel: untyped) =
+    let messages = rng.random_byte_seq(msgLen*Lanes)
+
+    var expected: seq[array[32, byte]]
+    expected.hashOneByOne(messages, msgLen, Lanes)
+
+    var digests: array[Lanes, array[32, byte]]
+    var dsts: array[Lanes, ptr array[32, byte]]
+    var msgs: array[Lanes, ptr UncheckedArray[byte]]
+    for l in 0 ..< Lanes:
+      dsts[l] = digests[l].addr
+      msgs[l] = messages.asUnchecked() +% (l*msgLen)
+
+    kernel(dsts, msgs, msgLen)
+    doAssert @digests == expected, astToStr(kernel) & " failed for messages of length " & $msgLen
+
+# --------------------------------------------------------------------
+
+proc main() =
+  echo "\n------------------------------------------------------\n"
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  echo "SHA256 - hashMany vs one message at a time"
+  for msgLen in MsgLens:
+    for numMessages in [0, 1, 3, 4, 7, 8, 9, 16, 17, 31, 40]:
+      rng.testHashMany(msgLen, numMessages)
+
+  echo "SHA256 - sha256_x8 vs one message at a time"
+  for msgLen in MsgLens:
+    rng.testSha256_x8(msgLen)
+
+  when UseASM_X86_32:
+    echo "SHA256 - SSE2 4 lanes"
+    for msgLen in MsgLens:
+      rng.testKernel(4, msgLen, hashMessages_sse2_x4)
+
+    if hasAvx2():
+      echo "SHA256 - AVX2 8 lanes"
+      for msgLen in MsgLens:
+        rng.testKernel(8, msgLen, hashMessages_avx2_x8)
+    else:
+      echo "SHA256 - AVX2 8 lanes [SKIPPED]"
+
+    if hasAvx512f():
+      echo "SHA256 - AVX512 16 lanes"
+      for msgLen in MsgLens:
+        rng.testKernel(16, msgLen, hashMessages_avx512_x16)
+    else:
+      echo "SHA256 - AVX512 16 lanes [SKIPPED]"
+
+  echo "SHA256 - multi-buffer - SUCCESS"
+
+main()
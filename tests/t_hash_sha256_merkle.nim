@@ -0,0 +1,150 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/hashes,
+  constantine/hashes/merkle/merkle_sha256,
+  constantine/serialization/codecs,
+  # Helpers
+  helpers/prng_unsafe
+
+# SHA256 Merkle trees vs a naive reference
+# --------------------------------------------------------------------
+
+proc hashPair(left, right: array[32, byte]): array[32, byte] =
+  var ctx: Sha256Context
+  ctx.init()
+  ctx.update(left)
+  ctx.update(right)
+  ctx.finish(result)
+
+proc merkleize_reference(chunks: seq[array[32, byte]], depth: int): array[32, byte] =
+  ## Pad to 2^depth leaves and hash level by level
+  var level = chunks
+  level.setLen(1 shl depth)
+  for _ in 0 ..< depth:
+    var next = newSeq[array[32, byte]](level.len div 2)
+    for i in 0 ..< next.len:
+      next[i] = hashPair(level[2*i], level[2*i+1])
+    level = next
+  level[0]
+
+proc random_chunks(rng: var RngState, n: int): seq[array[32, byte]] =
+  result.setLen(n)
+  for i in 0 ..< n:
+    for j in 0 ..< 32:
+      result[i][j] = byte rng.next()
+
+proc testZeroHashes() =
+  # sha256 of 64 zero bytes
+  doAssert zeroHash(1) == array[32, byte].fromHex(
+    "f5a5fd42d16a20302798ef6ed309979b43003d2320d9f0e8ea9831a92759fb4b")
+
+  var expected: array[32, byte]
+  for d in 0 ..< MerkleMaxDepth:
+    doAssert zeroHash(d) == expected, "Zero hash mismatch at depth " & $d
+    expected = hashPair(expected, expected)
+
+proc testHash64B(rng: var RngState) =
+  for _ in 0 ..< 64:
+    let pair = rng.random_chunks(2)
+    var msg: array[64, byte]
+    for i in 0 ..< 32:
+      msg[i] = pair[0][i]
+      msg[32+i] = pair[1][i]
+
+    var digest: array[32, byte]
+    sha256.hash_64B(digest, msg)
+    doAssert digest == sha256.hash(msg)
+
+proc testMerkleize(rng: var RngState) =
+  for n in 0 .. 70:
+    let chunks = rng.random_chunks(n)
+    for limit in [-1, n, n+1, 2*n+3, 1000]:
+      if limit >= 0 and limit < n:
+        continue
+      let depth = merkleDepth(if limit < 0: n else: limit)
+      let expected = merkleize_reference(chunks, depth)
+
+      var root: array[32, byte]
+      doAssert root.merkleize(chunks, limit) == Merkle_Success
+      doAssert root == expected, "merkleize failed for " & $n & " chunks and limit " & $limit
+
+      var tree: MerkleTree
+      doAssert tree.init(chunks, limit) == Merkle_Success
+      doAssert tree.root() == expected, "MerkleTree failed for " & $n & " chunks and limit " & $limit
+
+  # Large limits only materialize the populated subtree
+  let chunks = rng.random_chunks(5)
+  var root, root2: array[32, byte]
+  doAssert root.merkleize(chunks, limit = 1 shl 40) == Merkle_Success
+  root2 = merkleize_reference(chunks, 3)
+  for d in 3 ..< 40:
+    root2 = hashPair(root2, zeroHash(d))
+  doAssert root == root2
+
+  doAssert root.merkleize(chunks, limit = 4) == Merkle_TooManyChunks
+
+proc testMixInLength() =
+  var root: array[32, byte]
+  var lenChunk: array[32, byte]
+  lenChunk[0] = 0x39
+  lenChunk[1] = 0x05
+  let expected = hashPair(root, lenChunk)
+  root.mixInLength(1337)
+  doAssert root == expected
+
+proc testUpdates(rng: var RngState) =
+  for n in [1, 2, 3, 17, 64, 100]:
+    var chunks = rng.random_chunks(n)
+    var tree: MerkleTree
+    doAssert tree.init(chunks, limit = 128) == Merkle_Success
+
+    # Single updates
+    for _ in 0 ..< 8:
+      let i = rng.random_unsafe(0 ..< n)
+      let leaf = rng.random_chunks(1)[0]
+      chunks[i] = leaf
+      doAssert tree.update(i, leaf) == Merkle_Success
+      doAssert tree.root() == merkleize_reference(chunks, 7), "Single update failed"
+
+    # Batch updates, sorted or not, with duplicates
+    for _ in 0 ..< 8:
+      let k = rng.random_unsafe(1 .. n)
+      var indices = newSeq[int](k)
+      let leaves = rng.random_chunks(k)
+      for j in 0 ..< k:
+        indices[j] = rng.random_unsafe(0 ..< n)
+      for j in 0 ..< k:
+        chunks[indices[j]] = leaves[j]
+      doAssert tree.update(indices, leaves) == Merkle_Success
+      doAssert tree.root() == merkleize_reference(chunks, 7), "Batch update failed"
+
+    doAssert tree.update(n, chunks[0]) == Merkle_IndexOutOfBounds
+
+# --------------------------------------------------------------------
+
+proc main() =
+  echo "\n------------------------------------------------------\n"
+  var rng: RngState
+  rng.seed(0xFACADE)
+
+  echo "SHA256 Merkle - zero hashes"
+  testZeroHashes()
+  echo "SHA256 Merkle - 64-byte compression"
+  rng.testHash64B()
+  echo "SHA256 Merkle - merkleize vs reference"
+  rng.testMerkleize()
+  echo "SHA256 Merkle - mix_in_length"
+  testMixInLength()
+  echo "SHA256 Merkle - incremental updates"
+  rng.testUpdates()
+  echo "SHA256 Merkle - SUCCESS"
+
+main()
@@ -0,0 +1,162 @@
+# Constantine
+# Copyright (c) 2018-2019    Status Research & Development GmbH
+# Copyright (c) 2020-Present Mamy André-Ratsimbazafy
+# Licensed and distributed under either of
+#   * MIT license (license terms in the root directory or at http://opensource.org/licenses/MIT).
+#   * Apache v2 license (license terms in the root directory or at http://www.apache.org/licenses/LICENSE-2.0).
+# at your option. This file may not be copied, modified, or distributed except according to those terms.
+
+import
+  # Internals
+  constantine/hashes,
+  constantine/hash_to_curve/h2c_hash_to_field,
+  constantine/serialization/codecs,
+  # Helpers
+  helpers/prng_unsafe
+
+# SHAKE128 / SHAKE256 test vectors
+# --------------------------------------------------------------------
+#
+# 200-byte outputs span multiple squeezed blocks:
+# the rate is 168 bytes for SHAKE128 and 136 bytes for SHAKE256.
+
+proc t_shake128_empty =
+  var output: array[32, byte]
+  shake128.xof(output, default(array[0, byte]))
+  doAssert output == array[32, byte].fromHex("7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26")
+
+proc t_shake128_abc_200B =
+  var output: array[200, byte]
+  shake128.xof(output, [byte 'a', byte 'b', byte 'c'])
+  doAssert output == array[200, byte].fromHex(
+    "5881092dd818bf5cf8a3ddb793fbcba74097d5c526a6d35f97b83351940f2cc8" &
+    "44c50af32acd3f2cdd066568706f509bc1bdde58295dae3f891a9a0fca578378" &
+    "9a41f8611214ce612394df286a62d1a2252aa94db9c538956c717dc2bed4f232" &
+    "a0294c857c730aa16067ac1062f1201fb0d377cfb9cde4c63599b27f3462bba4" &
+    "a0ed296c801f9ff7f57302bb3076ee145f97a32ae68e76ab66c48d51675bd49a" &
+    "cc29082f5647584e6aa01b3f5af057805f973ff8ecb8b226ac32ada6f01c1fcd" &
+    "4818cb006aa5b4cd")
+
+proc t_shake256_empty =
+  var output: array[64, byte]
+  shake256.xof(output, default(array[0, byte]))
+  doAssert output == array[64, byte].fromHex(
+    "46b9dd2b0ba88d13233b3feb743eeb243fcd52ea62b81b82b50c27646ed5762f" &
+    "d75dc4ddd8c0f200cb05019d67b592f6fc821c49479ab48640292eacb3b7c4be")
+
+proc t_shake256_abc_200B =
+  var output: array[200, byte]
+  shake256.xof(output, [byte 'a', byte 'b', byte 'c'])
+  doAssert output == array[200, byte].fromHex(
+    "483366601360a8771c6863080cc4114d8db44530f8f1e1ee4f94ea37e78b5739" &
+    "d5a15bef186a5386c75744c0527e1faa9f8726e462a12a4feb06bd8801e751e4" &
+    "1385141204f329979fd3047a13c5657724ada64d2470157b3cdc288620944d78" &
+    "dbcddbd912993f0913f164fb2ce95131a2d09a3e6d51cbfc622720d7a75c6334" &
+    "e8a2d7ec71a7cc29cf0ea610eeff1a588290a53000faa79932becec0bd3cd0b3" &
+    "3a7e5d397fed1ada9442b99903f4dcfd8559ed3950faf40fe6f3b5d710ed3b67" &
+    "7513771af6bfe119")
+
+# Streaming
+# --------------------------------------------------------------------
+
+proc streamTest(rng: var RngState, H: typedesc, msgLen, outLen: int) =
+  ## Absorbing and squeezing in random chunks
+  ## must match the one-shot XOF
+  let msg = rng.random_byte_seq(msgLen)
+  var expected = newSeq[byte](outLen)
+  H.xof(expected, msg)
+
+  var ctx {.noInit.}: H
+  ctx.init()
+  var cur = 0
+  ctx.absorb(default(array[0, byte]))
+  while cur < msgLen:
+    let len = min(int rng.random_unsafe(0 .. 200), msgLen - cur)
+    ctx.absorb(msg.toOpenArray(cur, cur+len-1))
+    cur += len
+
+  var output = newSeq[byte](outLen)
+  cur = 0
+  while cur < outLen:
+    let len = min(int rng.random_unsafe(0 .. 400), outLen - cur)
+    ctx.squeeze(output.toOpenArray(cur, cur+len-1))
+    cur += len
+
+  doAssert output == expected, block:
+    "Streaming test failed for " & $H & " with message of length " & $msgLen &
+    " and output of length " & $outLen
+
+# expand_message_xof
+# --------------------------------------------------------------------
+#
+# https://www.rfc-editor.org/rfc/rfc9380#appendix-K.3
+# https://www.rfc-editor.org/rfc/rfc9380#appendix-K.4
+
+template testExpandMessageXOF(H, dst, message, expected: untyped) =
+  block:
+    const len_in_bytes = expected.len div 2
+    var uniform_bytes: array[len_in_bytes, byte]
+    H.expandMessageXOF(
+      uniform_bytes,
+      augmentation = "",
+      message,
+      dst
+    )
+    doAssert uniform_bytes == array[len_in_bytes, byte].fromHex(expected), ( "\n" &
+      "Expected " & expected & "\n" &
+      "Computed " & toHex(uniform_bytes)
+    )
+
+proc t_expandMessageXOF =
+  const dst128 = "QUUX-V01-CS02-with-expander-SHAKE128"
+  testExpandMessageXOF(shake128, dst128, "",
+    "86518c9cd86581486e9485aa74ab35ba150d1c75c88e26b7043e44e2acd735a2")
+  testExpandMessageXOF(shake128, dst128, "abc",
+    "8696af52a4d862417c0763556073f47bc9b9ba43c99b505305cb1ec04a9ab468")
+  testExpandMessageXOF(shake128, dst128, "abcdef0123456789",
+    "912c58deac4821c3509dbefa094df54b34b8f5d01a191d1d3108a2c89077acca")
+  testExpandMessageXOF(shake128, dst128, "",
+    "7314ff1a155a2fb99a0171dc71b89ab6e3b2b7d59e38e64419b8b6294d03ffee" &
+    "42491f11370261f436220ef787f8f76f5b26bdcd850071920ce023f3ac468477" &
+    "44f4612b8714db8f5db83205b2e625d95afd7d7b4d3094d3bdde815f52850bb4" &
+    "1ead9822e08f22cf41d615a303b0d9dde73263c049a7b9898208003a739a2e57")
+  testExpandMessageXOF(shake128, dst128, "abc",
+    "c952f0c8e529ca8824acc6a4cab0e782fc3648c563ddb00da7399f2ae35654f4" &
+    "860ec671db2356ba7baa55a34a9d7f79197b60ddae6e64768a37d699a7832349" &
+    "6db3878c8d64d909d0f8a7de4927dcab0d3dbbc26cb20a49eceb0530b431cdf4" &
+    "7bc8c0fa3e0d88f53b318b6739fbed7d7634974f1b5c386d6230c76260d5337a")
+
+  const dst256 = "QUUX-V01-CS02-with-expander-SHAKE256"
+  testExpandMessageXOF(shake256, dst256, "",
+    "2ffc05c48ed32b95d72e807f6eab9f7530dd1c2f013914c8fed38c5ccc15ad76")
+  testExpandMessageXOF(shake256, dst256, "abc",
+    "b39e493867e2767216792abce1f2676c197c0692aed061560ead251821808e07")
+  testExpandMessageXOF(shake256, dst256, "",
+    "7a1361d2d7d82d79e035b8880c5a3c86c5afa719478c007d96e6c88737a3f631" &
+    "dd74a2c88df79a4cb5e5d9f7504957c70d669ec6bfedc31e01e2bacc4ff3fdf9" &
+    "b6a00b17cc18d9d72ace7d6b81c2e481b4f73f34f9a7505dccbe8f5485f3d20c" &
+    "5409b0310093d5d6492dea4e18aa6979c23c8ea5de01582e9689612afbb353df")
+
+# --------------------------------------------------------------------
+
+proc main() =
+  echo "\n------------------------------------------------------\n"
+  echo "SHAKE128 & SHAKE256 - test vectors"
+  t_shake128_empty()
+  t_shake128_abc_200B()
+  t_shake256_empty()
+  t_shake256_abc_200B()
+
+  echo "SHAKE128 & SHAKE256 - streaming absorb and squeeze"
+  var rng: RngState
+  rng.seed(0xFACADE)
+  for msgLen in [0, 1, 135, 136, 137, 167, 168, 169, 1000]:
+    for outLen in [0, 1, 32, 136, 168, 300, 1000]:
+      rng.streamTest(shake128, msgLen, outLen)
+      rng.streamTest(shake256, msgLen, outLen)
+
+  echo "expand_message_xof - RFC 9380 test vectors"
+  t_expandMessageXOF()
+  echo "SHAKE - SUCCESS"
+
+main()
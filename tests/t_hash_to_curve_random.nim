@@ -8,7 +8,7 @@
 
 import
   # Standard library
-  std/[unittest, times],
+  std/[unittest, times, strutils],
   # Internals
   constantine/named/algebras,
   constantine/named/zoo_subgroups,
@@ -57,6 +57,78 @@ suite "Hash-to-curve produces points on curve and in correct subgroup":
     for i in 0 ..< Iters:
       testH2C_consistency(EC_ShortW_Aff[Fp2[BN254_Snarks], G2])
 
+proc testH2C_xof_consistency[EC: EC_ShortW](curve: typedesc[EC], H: typedesc) =
+  var P{.noInit.}: EC
+  let msg = rng.random_byte_seq(32)
+  H.hashToCurve(
+    k = 128,
+    output = P,
+    augmentation = "",
+    message = msg,
+    domainSepTag = "H2C-CONSTANTINE-TESTSUITE"
+  )
+
+  doAssert bool isOnCurve(P.x, P.y,  EC.G)
+  doAssert bool isInSubgroup(P)
+
+suite "Hash-to-curve with expand_message_xof produces points on curve and in correct subgroup":
+  test "BLS12-381 G1":
+    for i in 0 ..< Iters:
+      testH2C_xof_consistency(EC_ShortW_Aff[Fp[BLS12_381], G1], shake128)
+      testH2C_xof_consistency(EC_ShortW_Aff[Fp[BLS12_381], G1], shake256)
+  test "BLS12-381 G2":
+    for i in 0 ..< Iters:
+      testH2C_xof_consistency(EC_ShortW_Aff[Fp2[BLS12_381], G2], shake128)
+      testH2C_xof_consistency(EC_ShortW_Aff[Fp2[BLS12_381], G2], shake256)
+  test "BN254_Snarks G1":
+    for i in 0 ..< Iters:
+      testH2C_xof_consistency(EC_ShortW_Aff[Fp[BN254_Snarks], G1], shake128)
+      testH2C_xof_consistency(EC_ShortW_Aff[Fp[BN254_Snarks], G1], shake256)
+
+proc testH2C_batch[EC: EC_ShortW_Aff](curve: typedesc[EC], sameLength: bool) =
+  # Batch sizes straddle the multi-buffer SHA256 lanes
+  for N in [1, 3, 16, 21]:
+    var msgs = newSeq[seq[byte]](N)
+    for i in 0 ..< N:
+      let len = if sameLength: 32 else: int rng.random_unsafe(200)
+      msgs[i] = rng.random_byte_seq(len)
+
+    for dst in ["H2C-CONSTANTINE-TESTSUITE", 'D'.repeat(300)]:
+      var expected = newSeq[EC](N)
+      for i in 0 ..< N:
+        sha256.hashToCurve(
+          k = 128,
+          output = expected[i],
+          augmentation = "",
+          message = msgs[i],
+          domainSepTag = dst
+        )
+
+      var batch = newSeq[EC](N)
+      sha256.hashToCurve_batch(
+        k = 128,
+        output = batch,
+        messages = msgs,
+        domainSepTag = dst
+      )
+
+      for i in 0 ..< N:
+        doAssert bool(batch[i] == expected[i])
+
+suite "Batch hash-to-curve matches hash-to-curve":
+  test "BLS12-381 G1":
+    testH2C_batch(EC_ShortW_Aff[Fp[BLS12_381], G1], sameLength = true)
+    testH2C_batch(EC_ShortW_Aff[Fp[BLS12_381], G1], sameLength = false)
+  test "BLS12-381 G2":
+    testH2C_batch(EC_ShortW_Aff[Fp2[BLS12_381], G2], sameLength = true)
+    testH2C_batch(EC_ShortW_Aff[Fp2[BLS12_381], G2], sameLength = false)
+  test "BN254_Snarks G1":
+    testH2C_batch(EC_ShortW_Aff[Fp[BN254_Snarks], G1], sameLength = true)
+    testH2C_batch(EC_ShortW_Aff[Fp[BN254_Snarks], G1], sameLength = false)
+  test "BN254_Snarks G2":
+    testH2C_batch(EC_ShortW_Aff[Fp2[BN254_Snarks], G2], sameLength = true)
+    testH2C_batch(EC_ShortW_Aff[Fp2[BN254_Snarks], G2], sameLength = false)
+
 proc testH2C_guidovranken_fuzz_failure_2() =
   # From Guido Vranken differential fuzzing
   # Summing elliptic curve on an isogeny was mistakenly not fully reducing HHH_or_Mpre
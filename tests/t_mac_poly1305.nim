@@ -7,8 +7,15 @@
 # at your option. This file may not be copied, modified, or distributed except according to those terms.
 
 import
-  std/unittest,
-  constantine/mac/mac_poly1305
+  std/[unittest, times],
+  constantine/mac/mac_poly1305,
+  helpers/prng_unsafe
+
+var rng: RngState
+let seed = uint32(getTime().toUnix() and (1'i64 shl 32 - 1)) # unixTime mod 2^32
+rng.seed(seed)
+echo "\n------------------------------------------------------\n"
+echo "poly1305 xoshiro512** seed: ", seed
 
 suite "[Message Authentication Code] Poly1305":
   test "Test vector 1 - RFC8439":
@@ -29,3 +36,61 @@ suite "[Message Authentication Code] Poly1305":
     poly1305.mac(tag, message, ikm)
 
     doAssert tag == expectedTag
+
+  test "Long message":
+    # Messages of 256 bytes or more use the 4-way AVX2 path when available.
+    var ikm: array[32, byte]
+    for i in 0 ..< ikm.len:
+      ikm[i] = byte(i)
+    var message = newSeq[byte](1000)
+    for i in 0 ..< message.len:
+      message[i] = byte((i*7 + 3) and 0xFF)
+
+    let expectedTag = [
+      byte 0xb7, 0x4c, 0xe6, 0x6f, 0x76, 0xa2, 0x56, 0x6f,
+           0xb0, 0x05, 0x29, 0x67, 0xc1, 0x46, 0xde, 0x6d
+    ]
+
+    var tag: array[16, byte]
+    poly1305.mac(tag, message, ikm)
+
+    doAssert tag == expectedTag
+
+  test "One-shot matches block-by-block updates":
+    for len in [0, 15, 16, 255, 256, 257, 319, 320, 1000, 4096, 4099]:
+      var ikm: array[32, byte]
+      for i in 0 ..< ikm.len:
+        ikm[i] = byte(rng.next() and 0xFF)
+      # Maximal limbs to stress carries in the vectorized path
+      var message = newSeq[byte](len)
+      if (rng.next() and 1) == 0:
+        message = rng.random_byte_seq(len)
+      else:
+        for i in 0 ..< len:
+          message[i] = 0xFF
+
+      var tag: array[16, byte]
+      poly1305.mac(tag, message, ikm)
+
+      var ctx: poly1305
+      ctx.init(ikm)
+      var pos = 0
+      while pos < len:
+        ctx.update(message.toOpenArray(pos, min(pos+16, len)-1))
+        pos += 16
+      var expected: array[16, byte]
+      ctx.finish(expected)
+
+      doAssert tag == expected, "Mismatch for length " & $len
+
+      # Unaligned streaming, the vectorized path resumes mid-message
+      ctx.init(ikm)
+      pos = 0
+      while pos < len:
+        let chunk = 1 + int(rng.random_unsafe(300))
+        ctx.update(message.toOpenArray(pos, min(pos+chunk, len)-1))
+        pos += chunk
+      var streamed: array[16, byte]
+      ctx.finish(streamed)
+
+      doAssert streamed == expected, "Streaming mismatch for length " & $len